@@ -0,0 +1,79 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <chrono>
+#include <filesystem>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <parallel_hashmap/phmap.h>
+#include <string>
+#include <vector>
+
+namespace aetherium {
+    /**
+     * This class watches a directory tree for changed files. On Linux the watcher is backed by inotify, the events
+     * are read without blocking when the changes are taken. Changes are debounced, so a file is only reported after
+     * no further events were received for it within the debounce time.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class FileWatcher final {
+        int _inotify_handle;
+        std::chrono::milliseconds _debounce_time;
+        phmap::flat_hash_map<int, std::filesystem::path> _watched_directories {};
+        phmap::flat_hash_map<std::string, std::chrono::steady_clock::time_point> _pending_changes {};
+
+        auto watch_directory(const std::filesystem::path& directory) noexcept -> kstd::Result<void>;
+        auto read_events() noexcept -> void;
+        auto rescan(std::chrono::steady_clock::time_point now) noexcept -> void;
+
+        public:
+        /**
+         * This constructor creates the watcher without any watched directories.
+         *
+         * @param debounce_time The time without events, after which a changed file is reported
+         *
+         * @author              Cedric Hammes
+         * @since               16/10/2026
+         */
+        explicit FileWatcher(std::chrono::milliseconds debounce_time) noexcept;
+        ~FileWatcher() noexcept;
+        KSTD_NO_MOVE_COPY(FileWatcher, FileWatcher);
+
+        /**
+         * This function starts watching the specified directory and all subdirectories of it. Subdirectories, which
+         * are created later, are watched automatically.
+         *
+         * @param directory The directory to watch
+         * @return          Success or an error
+         *
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        auto watch(const std::filesystem::path& directory) noexcept -> kstd::Result<void>;
+
+        /**
+         * This function reads the pending events and returns the normalized paths of all changed files, which
+         * received no events within the debounce time. The returned files are removed from the pending changes.
+         *
+         * @return The paths of the changed files
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto take_changes() noexcept -> std::vector<std::filesystem::path>;
+    };
+}// namespace aetherium
@@ -14,34 +14,294 @@
 
 #pragma once
 
+#include "aetherium/renderer/vulkan/bindless_heap.hpp"
+#include "aetherium/renderer/vulkan/command_recorder.hpp"
 #include "aetherium/renderer/vulkan/context.hpp"
+#include "aetherium/renderer/vulkan/descriptor_allocator.hpp"
 #include "aetherium/renderer/vulkan/device.hpp"
+#include "aetherium/renderer/vulkan/pipeline.hpp"
+#include "aetherium/renderer/vulkan/pipeline_cache.hpp"
+#include "aetherium/renderer/vulkan/pipeline_layout.hpp"
+#include "aetherium/renderer/vulkan/render_graph.hpp"
+#include "aetherium/renderer/vulkan/semaphore.hpp"
 #include "aetherium/renderer/vulkan/swapchain.hpp"
+#include "aetherium/renderer/vulkan/uniform_allocator.hpp"
 #include <kstd/result.hpp>
-#include <kstd/tuple.hpp>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace aetherium::renderer {
+    /**
+     * This struct contains the options, which are used by the renderer while the creation.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct RendererOptions {
+        /**
+         * The count of frames, which can be recorded by the CPU while the GPU is still working on the previous frames
+         */
+        uint32_t frames_in_flight = 2;
+
+        /**
+         * The count of threads, which record the secondary command buffers of the draw recorders. Zero uses the count
+         * of hardware threads.
+         */
+        uint32_t recording_threads = 0;
+
+        /**
+         * The size of the per-frame buffer, from which the constants of the draws are allocated
+         */
+        VkDeviceSize uniform_buffer_size = 4ull * 1024 * 1024;
+
+        /**
+         * The file, in which the pipeline cache is stored between runs. An empty path disables the persistence.
+         */
+        std::string pipeline_cache_path {};
+
+        /**
+         * The count of threads, which create pipelines in the background. The default is small, because the compile
+         * threads run next to the recording threads and the resource workers. Zero uses the count of hardware threads.
+         */
+        uint32_t pipeline_compile_threads = 2;
+
+        /**
+         * Whether the renderer creates the bindless descriptor heap. The device must support descriptor indexing.
+         */
+        bool bindless = false;
+
+        /**
+         * The sizes of the descriptor arrays of the bindless descriptor heap
+         */
+        vulkan::BindlessHeapLimits bindless_limits {};
+
+        /**
+         * The preferred present mode and image count of the swapchain. MAILBOX or IMMEDIATE enable the low-latency
+         * presentation for interactive tools.
+         */
+        vulkan::SwapchainOptions swapchain {};
+    };
+
+    /**
+     * This class holds all objects which are needed to record and submit a single frame. The renderer owns one frame
+     * per frame in flight and only waits for the last submit of a frame when it comes back around to it.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class RenderFrame final {
+        const vulkan::VulkanDevice* _vulkan_device;
+        vulkan::CommandPool _command_pool;
+        vulkan::CommandBuffer _command_buffer;
+        VkSemaphore _image_available_semaphore;
+        VkSemaphore _rendering_done_semaphore;
+        uint64_t _timeline_value;
+        vulkan::CommandPoolRegistry _command_pool_registry;
+        vulkan::UniformAllocator _uniform_allocator;
+        vulkan::DescriptorAllocator _descriptor_allocator;
+        vulkan::RenderGraph _render_graph;
+        vulkan::RenderGraphResource _backbuffer;
+        std::vector<std::pair<vulkan::RenderGraphResource, vulkan::RenderGraphUsage>> _main_pass_inputs {};
+
+        public:
+        friend class VulkanRenderer;
+
+        /**
+         * This constructor creates the command pool, command buffer and the binary semaphores for the swapchain
+         * acquire and present of the frame.
+         *
+         * @param vulkan_device       The device on which the objects are created
+         * @param uniform_buffer_size The size of the uniform buffer of the frame
+         *
+         * @author                    Cedric Hammes
+         * @since                     16/10/2026
+         */
+        RenderFrame(const vulkan::VulkanDevice* vulkan_device, VkDeviceSize uniform_buffer_size);
+        ~RenderFrame() noexcept;
+        KSTD_NO_MOVE_COPY(RenderFrame, RenderFrame);
+    };
+
     class VulkanRenderer {
         vulkan::VulkanContext& _vulkan_context;
         vulkan::VulkanDevice _vulkan_device;
-        vulkan::CommandPool _command_pool;
-        vulkan::CommandBuffer _command_buffer;
         vulkan::Swapchain _swapchain;
-        VkSemaphore _image_available_semaphore {};
-        VkSemaphore _rendering_done_semaphore {};
+        vulkan::TimelineSemaphore _frame_timeline;
+        uint64_t _frame_counter;
+        std::vector<std::unique_ptr<RenderFrame>> _frames {};
+        uint32_t _current_frame;
+        bool _is_frame_begun;
+        std::unique_ptr<ThreadPool> _recording_pool;
+        std::vector<vulkan::RecordFunction> _draw_recorders {};
+        std::unique_ptr<vulkan::PipelineCache> _pipeline_cache;
+        std::unique_ptr<vulkan::PipelineLayoutCache> _pipeline_layout_cache;
+        std::unique_ptr<vulkan::PipelineManager> _pipeline_manager;
+        std::unique_ptr<vulkan::BindlessHeap> _bindless_heap;
+        std::unique_ptr<vulkan::DescriptorSetCache> _descriptor_set_cache;
 
         public:
-        explicit VulkanRenderer(vulkan::VulkanContext& context);
+        explicit VulkanRenderer(vulkan::VulkanContext& context, const RendererOptions& options = RendererOptions {});
         VulkanRenderer(VulkanRenderer&& other) noexcept;
         ~VulkanRenderer() noexcept;
         KSTD_NO_COPY(VulkanRenderer, VulkanRenderer);
+
+        /**
+         * This function waits until the GPU is done with the frame slot, which is recorded next, resets its per-frame
+         * resources and acquires the next swapchain image as backbuffer of the render graph. The function must be
+         * called before allocating from the uniform allocator or adding passes to the render graph of the frame,
+         * otherwise it is called by the render function. If the swapchain is out of date, it's recreated. While the
+         * window is minimized, no frame is begun and the render function skips the frame.
+         *
+         * @return Success or error
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto begin_frame() noexcept -> kstd::Result<void>;
         [[nodiscard]] auto render() noexcept -> kstd::Result<void>;
         [[nodiscard]] auto get_device() const noexcept -> const vulkan::VulkanDevice&;
+        [[nodiscard]] auto get_frames_in_flight() const noexcept -> uint32_t;
 
-        auto operator=(VulkanRenderer&& other) noexcept -> VulkanRenderer&;
-    };
+        /**
+         * This function returns the timeline semaphore, which is signaled with the frame counter after every
+         * submitted frame. This allows the developer to poll the progress of the GPU without blocking.
+         *
+         * @return The frame timeline semaphore
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_frame_timeline() const noexcept -> const vulkan::TimelineSemaphore&;
+
+        /**
+         * This function returns the uniform allocator of the frame, which is recorded next. The allocations are valid
+         * until the frame slot is reused, so they can be referenced by the draws of the current frame. The frame has
+         * to be begun before the first allocation.
+         *
+         * @return The uniform allocator of the current frame
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_uniform_allocator() noexcept -> vulkan::UniformAllocator&;
+
+        /**
+         * This function returns the descriptor allocator of the frame, which is recorded next. All descriptor sets of
+         * the allocator are freed at once, when the frame slot is reused, so the sets must only be used by the draws
+         * of the current frame. The frame has to be begun before the first allocation.
+         *
+         * @return The descriptor allocator of the current frame
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_descriptor_allocator() noexcept -> vulkan::DescriptorAllocator&;
+
+        /**
+         * This function returns the render graph of the frame, which is recorded next. Passes, which are added after
+         * the frame was begun, are executed before the main pass, which executes the draw recorders. The frame has to
+         * be begun before the first pass is added.
+         *
+         * @return The render graph of the current frame
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_render_graph() noexcept -> vulkan::RenderGraph&;
+        [[nodiscard]] auto get_backbuffer() const noexcept -> vulkan::RenderGraphResource;
+
+        /**
+         * This function declares that the main pass of the current frame reads the specified image of the render
+         * graph, so the pass, which writes the image, isn't culled and the image is transitioned before the draw
+         * recorders run.
+         *
+         * @param resource The image, which is read by the main pass
+         * @param usage    How the main pass uses the image
+         *
+         * @author         Cedric Hammes
+         * @since          16/10/2026
+         */
+        auto add_main_pass_input(vulkan::RenderGraphResource resource,
+                                 vulkan::RenderGraphUsage usage = vulkan::SHADER_READ) noexcept -> void;
 
-    [[nodiscard]] auto access_mask_flags(VkImageLayout old_layout, VkImageLayout new_layout) noexcept
-            -> kstd::Option<kstd::Tuple<VkAccessFlags, VkAccessFlags>>;
+        /**
+         * This function returns the descriptor set cache of the renderer, which shares the immutable descriptor sets
+         * between all requests with the same layout and descriptors.
+         *
+         * @return The descriptor set cache of the renderer
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_descriptor_set_cache() const noexcept -> vulkan::DescriptorSetCache&;
 
+        /**
+         * This function returns the pipeline cache of the renderer. Pipelines should be created through the compile
+         * threads of the cache while loading, so the first frame, which uses them, doesn't stall.
+         *
+         * @return The pipeline cache of the renderer
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_pipeline_cache() const noexcept -> vulkan::PipelineCache&;
+
+        /**
+         * This function returns the pipeline manager of the renderer, which shares one pipeline between all
+         * requests with the same pipeline state.
+         *
+         * @return The pipeline manager of the renderer
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_pipeline_manager() const noexcept -> vulkan::PipelineManager&;
+
+        /**
+         * This function returns the layout cache of the renderer, which creates the pipeline layouts by the reflection
+         * of the shaders and shares them between all pipelines with the same interface.
+         *
+         * @return The pipeline layout cache of the renderer
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_pipeline_layout_cache() const noexcept -> vulkan::PipelineLayoutCache&;
+
+        /**
+         * This function returns the bindless descriptor heap of the renderer. In bindless mode, all pipelines use
+         * the pipeline layout of the heap and the draws select their resources by the indices in the push constants.
+         * This function must only be called, if the renderer was created with the bindless option.
+         *
+         * @return The bindless descriptor heap of the renderer
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_bindless_heap() const noexcept -> vulkan::BindlessHeap&;
+        [[nodiscard]] auto is_bindless() const noexcept -> bool;
+
+        /**
+         * This function adds a draw recorder to the renderer. Every frame, each draw recorder records into its own
+         * secondary command buffer on one of the recording threads and the buffers are executed in the order of
+         * insertion inside the rendering of the swapchain image.
+         *
+         * @param recorder The function, which records the draw commands
+         *
+         * @author         Cedric Hammes
+         * @since          16/10/2026
+         */
+        auto add_draw_recorder(vulkan::RecordFunction recorder) noexcept -> void;
+
+        /**
+         * This function removes all draw recorders from the renderer.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        auto clear_draw_recorders() noexcept -> void;
+
+        auto operator=(VulkanRenderer&& other) noexcept -> VulkanRenderer&;
+    };
 }// namespace aetherium::renderer
\ No newline at end of file
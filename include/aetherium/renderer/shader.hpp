@@ -13,21 +13,171 @@
 // limitations under the License.
 
 #pragma once
+#include "aetherium/renderer/vulkan/reflection.hpp"
 #include "aetherium/resource.hpp"
 #include <shaderc/shaderc.hpp>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace aetherium::renderer {
+    namespace vulkan {
+        class VulkanDevice;
+    }
+
+    /**
+     * This struct contains the options, with which a shader is compiled. All options are part of the key of the
+     * SPIR-V cache.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct ShaderCompileOptions {
+        std::vector<std::pair<std::string, std::string>> macros {};
+        bool optimize = true;
+        bool generate_debug_info = false;
+    };
+
+    /**
+     * This struct contains the statistics of the SPIR-V cache of all shaders. Cold loads compile the shader with
+     * shaderc and warm loads read the SPIR-V from the cache.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct ShaderCacheStatistics {
+        uint32_t hits = 0;
+        uint32_t misses = 0;
+        double warm_milliseconds = 0.0;
+        double cold_milliseconds = 0.0;
+    };
+
+    /**
+     * This class is a GLSL shader resource. While the reload, the shader is compiled into SPIR-V or loaded from the
+     * content-addressed SPIR-V cache in the base directory of the resource manager. The key of the cache contains the
+     * source, the directory of the shader relative to the base directory, the hashes of all included files, the
+     * macros and the compile options, so warm starts skip shaderc and the cache stays valid when the project is moved.
+     * Shaders are reloaded in parallel and every worker compiles with its own shaderc compiler. Asynchronous loads
+     * compile the shader on a worker and create the shader module on the owning thread. After the reload, the
+     * interface of the shader is reflected from the SPIR-V, so the pipeline layouts can be created by the reflection.
+     * Shaders with a device create the shader module after every reload, shaders without a device only contain the
+     * SPIR-V and the reflection.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
     class Shader final : public Resource {
-        shaderc_compiler* _compiler;
+        const vulkan::VulkanDevice* _vulkan_device;
+        ShaderCompileOptions _compile_options;
+        std::vector<uint32_t> _spirv {};
+        vulkan::ShaderReflection _reflection {};
+        VkShaderModule _shader_module;
+        uint64_t _module_id;
+
+        [[nodiscard]] auto compile(std::string_view source, const aetherium::ResourceManager& resource_manager) noexcept
+                -> kstd::Result<void>;
+        [[nodiscard]] auto create_shader_module() noexcept -> kstd::Result<void>;
+        auto update_reflection() noexcept -> kstd::Result<void>;
 
         public:
-        Shader(const fs::path& resource_path, const kstd::reflect::RTTI* runtime_type) :
-                Resource {resource_path, runtime_type} {
-            _compiler = shaderc_compiler_initialize();
-        }
+        /**
+         * This constructor creates the shader without SPIR-V, the shader is compiled by the reload.
+         *
+         * @param resource_path   The path of the GLSL file
+         * @param runtime_type    The runtime type of the shader resource
+         * @param vulkan_device   The device, on which the shader module is created, or nullptr
+         * @param compile_options The options, with which the shader is compiled
+         *
+         * @author                Cedric Hammes
+         * @since                 16/10/2026
+         */
+        Shader(const fs::path& resource_path, const kstd::reflect::RTTI* runtime_type,
+               const vulkan::VulkanDevice* vulkan_device = nullptr,
+               ShaderCompileOptions compile_options = ShaderCompileOptions {});
         ~Shader() noexcept override;
         KSTD_NO_MOVE_COPY(Shader, Shader);
 
+        /**
+         * This function reads the shader file and loads the SPIR-V from the cache. If the cache contains no SPIR-V
+         * for the current source, includes, macros and options, the shader is compiled and written into the cache.
+         *
+         * @param resource_manager The resource manager, which owns the shader
+         * @return                 Success or error
+         *
+         * @author                 Cedric Hammes
+         * @since                  16/10/2026
+         */
         auto reload(const aetherium::ResourceManager& resource_manager) noexcept -> kstd::Result<void> override;
+
+        [[nodiscard]] inline auto supports_parallel_reload() const noexcept -> bool override {
+            return true;
+        }
+
+        [[nodiscard]] inline auto supports_staged_load() const noexcept -> bool override {
+            return true;
+        }
+
+        /**
+         * This function compiles the GLSL source, which was read by the I/O thread of the asynchronous loader, or
+         * loads the SPIR-V from the cache. The shader module is created by finalize.
+         *
+         * @param data             The GLSL source of the shader
+         * @param resource_manager The resource manager, which loads the shader
+         * @return                 Success or error
+         *
+         * @author                 Cedric Hammes
+         * @since                  16/10/2026
+         */
+        auto decode(std::vector<uint8_t> data, const aetherium::ResourceManager& resource_manager) noexcept
+                -> kstd::Result<void> override;
+
+        /**
+         * This function creates the shader module with the SPIR-V of the decode on the thread, which owns the
+         * resource manager.
+         *
+         * @param resource_manager The resource manager, which loads the shader
+         * @return                 Success or error
+         *
+         * @author                 Cedric Hammes
+         * @since                  16/10/2026
+         */
+        auto finalize(const aetherium::ResourceManager& resource_manager) noexcept -> kstd::Result<void> override;
+
+        [[nodiscard]] auto get_spirv() const noexcept -> const std::vector<uint32_t>&;
+        [[nodiscard]] auto operator*() const noexcept -> VkShaderModule;
+
+        /**
+         * This function returns the id of the current shader module. Every created shader module gets a new id, so
+         * the id is used instead of the handle to identify the pipelines of the shader after a reload.
+         *
+         * @return The id of the shader module or zero, if no shader module was created
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_module_id() const noexcept -> uint64_t;
+
+        /**
+         * This function returns the descriptor bindings, push constant ranges and vertex inputs, which are reflected
+         * from the SPIR-V of the shader while the last reload.
+         *
+         * @return The reflection of the shader
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_reflection() const noexcept -> const vulkan::ShaderReflection&;
+
+        /**
+         * This function returns the statistics of the SPIR-V cache over all shaders, which are loaded since the
+         * start of the program.
+         *
+         * @return The statistics of the SPIR-V cache
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] static auto get_cache_statistics() noexcept -> ShaderCacheStatistics;
     };
 }// namespace aetherium::renderer
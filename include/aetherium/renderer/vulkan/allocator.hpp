@@ -0,0 +1,506 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include "aetherium/utils.hpp"
+#include <array>
+#include <functional>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace aetherium::renderer::vulkan {
+    /**
+     * This struct describes a range, which was allocated by the TLSF allocator. The block index identifies the range
+     * while freeing.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct TlsfAllocation {
+        uint64_t offset;
+        uint32_t block_index;
+    };
+
+    /**
+     * This class is a two-level segregated fit (TLSF) allocator, which manages the offsets of a range with the
+     * specified size. Allocations and frees run in constant time and neighbouring free blocks are merged, so the range
+     * fragments slowly. The allocator doesn't touch the memory itself, so it can be used for device memory.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class TlsfAllocator final {
+        static constexpr uint32_t SECOND_LEVEL_BITS = 4;
+        static constexpr uint32_t SECOND_LEVEL_COUNT = 1u << SECOND_LEVEL_BITS;
+        static constexpr uint32_t FIRST_LEVEL_COUNT = 64;
+
+        struct Block {
+            uint64_t offset;
+            uint64_t size;
+            uint32_t previous_physical;
+            uint32_t next_physical;
+            uint32_t previous_free;
+            uint32_t next_free;
+            bool is_free;
+        };
+
+        uint64_t _size;
+        uint64_t _used_size;
+        uint32_t _allocation_count;
+        std::vector<Block> _blocks {};
+        std::vector<uint32_t> _unused_blocks {};
+        uint64_t _first_level_bitmap;
+        std::array<uint32_t, FIRST_LEVEL_COUNT> _second_level_bitmaps {};
+        std::array<uint32_t, FIRST_LEVEL_COUNT * SECOND_LEVEL_COUNT> _free_lists {};
+
+        [[nodiscard]] static auto get_list_index(uint64_t size) noexcept -> std::pair<uint32_t, uint32_t>;
+        [[nodiscard]] auto find_free_block(uint64_t size) const noexcept -> uint32_t;
+        [[nodiscard]] auto create_block() noexcept -> uint32_t;
+        [[nodiscard]] auto split_block(uint32_t block_index, uint64_t size) noexcept -> uint32_t;
+        auto merge_blocks(uint32_t block_index, uint32_t next_block_index) noexcept -> void;
+        auto insert_free_block(uint32_t block_index) noexcept -> void;
+        auto remove_free_block(uint32_t block_index) noexcept -> void;
+
+        public:
+        static constexpr uint64_t MIN_BLOCK_SIZE = SECOND_LEVEL_COUNT;
+        static constexpr uint32_t NO_BLOCK = std::numeric_limits<uint32_t>::max();
+
+        /**
+         * This constructor creates the allocator for a range with the specified size. The size is rounded down to the
+         * minimal block size.
+         *
+         * @param size The size of the managed range
+         *
+         * @author     Cedric Hammes
+         * @since      16/10/2026
+         */
+        explicit TlsfAllocator(uint64_t size) noexcept;
+        ~TlsfAllocator() noexcept = default;
+        KSTD_DEFAULT_MOVE_COPY(TlsfAllocator, TlsfAllocator);
+
+        /**
+         * This function allocates a range with the specified size and alignment. The size is rounded up to the minimal
+         * block size and the alignment must be a power of two.
+         *
+         * @param size      The size of the range
+         * @param alignment The alignment of the offset of the range
+         * @return          The allocated range or an error
+         *
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        [[nodiscard]] auto allocate(uint64_t size, uint64_t alignment = MIN_BLOCK_SIZE) noexcept
+                -> kstd::Result<TlsfAllocation>;
+
+        /**
+         * This function gives the specified range back to the allocator and merges it with its free neighbours.
+         *
+         * @param block_index The block index of the allocated range
+         *
+         * @author            Cedric Hammes
+         * @since             16/10/2026
+         */
+        auto free(uint32_t block_index) noexcept -> void;
+
+        /**
+         * This function calls the specified function with every allocated range and its size, ordered by the offset.
+         *
+         * @tparam F       The function type
+         * @param function The function itself
+         *
+         * @author         Cedric Hammes
+         * @since          16/10/2026
+         */
+        template<typename F>
+        auto for_each_allocation(F&& function) const noexcept -> void {
+            for(uint32_t block_index = 0; block_index != NO_BLOCK; block_index = _blocks[block_index].next_physical) {
+                const auto& block = _blocks[block_index];
+                if(!block.is_free && block.size > 0) {
+                    function(TlsfAllocation {block.offset, block_index}, block.size);
+                }
+            }
+        }
+
+        /**
+         * This function returns the size of the largest free range. Every allocation up to this size without extra
+         * alignment succeeds.
+         *
+         * @return The size of the largest free range
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_largest_free_size() const noexcept -> uint64_t;
+
+        /**
+         * This function returns the fragmentation of the free space between 0 and 1. Zero means all free space is a
+         * single range.
+         *
+         * @return The fragmentation of the free space
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_fragmentation() const noexcept -> float;
+
+        [[nodiscard]] auto get_allocation_size(uint32_t block_index) const noexcept -> uint64_t;
+        [[nodiscard]] auto get_size() const noexcept -> uint64_t;
+        [[nodiscard]] auto get_used_size() const noexcept -> uint64_t;
+        [[nodiscard]] auto get_allocation_count() const noexcept -> uint32_t;
+        [[nodiscard]] auto is_empty() const noexcept -> bool;
+    };
+
+    /**
+     * This class is a linear allocator, which bumps an offset through a range with the specified size. Single ranges
+     * can't be freed, instead the whole allocator is reset at once. This fits data, which lives for a single frame.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class LinearAllocator final {
+        uint64_t _size;
+        uint64_t _offset;
+
+        public:
+        /**
+         * This constructor creates the allocator for a range with the specified size.
+         *
+         * @param size The size of the managed range
+         *
+         * @author     Cedric Hammes
+         * @since      16/10/2026
+         */
+        explicit LinearAllocator(uint64_t size = 0) noexcept;
+        ~LinearAllocator() noexcept = default;
+        KSTD_DEFAULT_MOVE_COPY(LinearAllocator, LinearAllocator);
+
+        /**
+         * This function allocates a range with the specified size and alignment behind the last allocation. The
+         * alignment must be a power of two.
+         *
+         * @param size      The size of the range
+         * @param alignment The alignment of the offset of the range
+         * @return          The offset of the range or an error
+         *
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        [[nodiscard]] auto allocate(uint64_t size, uint64_t alignment = 1) noexcept -> kstd::Result<uint64_t>;
+
+        /**
+         * This function frees all allocations at once.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        auto reset() noexcept -> void;
+
+        [[nodiscard]] auto get_size() const noexcept -> uint64_t;
+        [[nodiscard]] auto get_used_size() const noexcept -> uint64_t;
+    };
+
+    /**
+     * This enum describes for what the memory is used. The usage is mapped to the property flags of the memory type.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    enum MemoryUsage {
+        GPU_ONLY,
+        CPU_TO_GPU,
+        GPU_TO_CPU
+    };
+
+    /**
+     * This struct describes how an allocation is created. Dedicated allocations get their own device memory object,
+     * which is preferred by some drivers for large render targets.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct AllocationCreateInfo {
+        MemoryUsage usage = GPU_ONLY;
+        bool is_linear = true;
+        bool is_dedicated = false;
+        VkBuffer dedicated_buffer = VK_NULL_HANDLE;
+        VkImage dedicated_image = VK_NULL_HANDLE;
+    };
+
+    /**
+     * This struct describes a range of device memory, which was allocated by the memory allocator. Host visible memory
+     * is mapped persistently, so the mapped data points directly to the start of the range.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct Allocation {
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        VkDeviceSize offset = 0;
+        VkDeviceSize size = 0;
+        void* mapped_data = nullptr;
+        uint32_t memory_type_index = 0;
+        uint32_t block_index = TlsfAllocator::NO_BLOCK;
+        uint32_t range_index = TlsfAllocator::NO_BLOCK;
+    };
+
+    /**
+     * This struct contains the statistics of the memory allocator.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct MemoryStatistics {
+        VkDeviceSize used_bytes = 0;
+        VkDeviceSize reserved_bytes = 0;
+        uint32_t allocation_count = 0;
+        uint32_t block_count = 0;
+        uint32_t dedicated_allocation_count = 0;
+        uint32_t device_allocation_count = 0;
+        float fragmentation = 0.0f;
+    };
+
+    /**
+     * This struct contains the result of a defragmentation run.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct DefragmentationStatistics {
+        uint32_t moved_allocations = 0;
+        VkDeviceSize moved_bytes = 0;
+        uint32_t freed_blocks = 0;
+    };
+
+    /**
+     * This type is a function, which moves the content of the first allocation into the second allocation and rebinds
+     * the resource. If the function returns false, the defragmentation stops and the first allocation stays valid.
+     */
+    using MoveFunction = std::function<bool(const Allocation&, const Allocation&)>;
+
+    /**
+     * This class is a device memory allocator, which sub-allocates resources out of large blocks per memory type with
+     * a TLSF allocator. Linear resources (buffers) and optimal resources (images) never share a block, so the buffer
+     * image granularity doesn't need to be respected. Large resources get a dedicated allocation. The count of device
+     * memory objects is kept below the maxMemoryAllocationCount limit of the device.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class MemoryAllocator final {
+        struct MemoryBlock {
+            VkDeviceMemory memory;
+            void* mapped_data;
+            uint32_t memory_type_index;
+            bool is_linear;
+            TlsfAllocator allocator;
+            std::vector<VkDeviceSize> alignments;
+        };
+
+        VkDevice _device;
+        VkPhysicalDeviceMemoryProperties _memory_properties {};
+        uint32_t _max_allocation_count;
+        VkDeviceSize _block_size;
+        mutable std::mutex _mutex;
+        std::vector<std::unique_ptr<MemoryBlock>> _blocks {};
+        uint32_t _device_allocation_count;
+        uint32_t _dedicated_allocation_count;
+        VkDeviceSize _dedicated_size;
+
+        [[nodiscard]] auto find_memory_type(uint32_t memory_type_bits, MemoryUsage usage) const noexcept
+                -> kstd::Result<uint32_t>;
+        [[nodiscard]] auto allocate_device_memory(VkDeviceSize size, uint32_t memory_type_index,
+                                                  const void* next) noexcept -> kstd::Result<VkDeviceMemory>;
+        [[nodiscard]] auto allocate_dedicated(const VkMemoryRequirements& requirements, uint32_t memory_type_index,
+                                              const AllocationCreateInfo& create_info) noexcept
+                -> kstd::Result<Allocation>;
+        [[nodiscard]] auto allocate_from_block(uint32_t block_index, VkDeviceSize size, VkDeviceSize alignment) noexcept
+                -> kstd::Result<Allocation>;
+        [[nodiscard]] auto create_block(uint32_t memory_type_index, bool is_linear) noexcept -> kstd::Result<uint32_t>;
+        [[nodiscard]] auto get_block_size(uint32_t memory_type_index) const noexcept -> VkDeviceSize;
+        auto release_block(uint32_t block_index) noexcept -> void;
+        auto free_from_block(uint32_t block_index, uint32_t range_index) noexcept -> void;
+
+        public:
+        static constexpr VkDeviceSize DEFAULT_BLOCK_SIZE = 256ull * 1024 * 1024;
+
+        /**
+         * This constructor creates the allocator for the specified device. No memory is allocated until the first
+         * allocation.
+         *
+         * @param physical_device The physical device, from which the memory types are read
+         * @param device          The device, on which the memory is allocated
+         * @param block_size      The preferred size of the memory blocks
+         *
+         * @author                Cedric Hammes
+         * @since                 16/10/2026
+         */
+        MemoryAllocator(VkPhysicalDevice physical_device, VkDevice device,
+                        VkDeviceSize block_size = DEFAULT_BLOCK_SIZE) noexcept;
+        ~MemoryAllocator() noexcept;
+        KSTD_NO_MOVE_COPY(MemoryAllocator, MemoryAllocator);
+
+        /**
+         * This function allocates memory with the specified requirements. The allocation is served by a block of the
+         * matching memory type and only when no block has enough space, a new block is allocated.
+         *
+         * @param requirements The requirements of the resource
+         * @param create_info  The information how to allocate
+         * @return             The allocation or an error
+         *
+         * @author             Cedric Hammes
+         * @since              16/10/2026
+         */
+        [[nodiscard]] auto allocate(const VkMemoryRequirements& requirements,
+                                    const AllocationCreateInfo& create_info = AllocationCreateInfo {}) noexcept
+                -> kstd::Result<Allocation>;
+
+        /**
+         * This function allocates memory for the specified buffer and binds it. If the driver prefers a dedicated
+         * allocation for the buffer, the buffer gets its own memory object.
+         *
+         * @param buffer The buffer
+         * @param usage  The usage of the memory
+         * @return       The allocation or an error
+         *
+         * @author       Cedric Hammes
+         * @since        16/10/2026
+         */
+        [[nodiscard]] auto allocate_for_buffer(VkBuffer buffer, MemoryUsage usage = GPU_ONLY) noexcept
+                -> kstd::Result<Allocation>;
+
+        /**
+         * This function allocates memory for the specified image and binds it. If the driver prefers a dedicated
+         * allocation for the image, the image gets its own memory object.
+         *
+         * @param image     The image
+         * @param usage     The usage of the memory
+         * @param is_linear Whether the image uses linear tiling
+         * @return          The allocation or an error
+         *
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        [[nodiscard]] auto allocate_for_image(VkImage image, MemoryUsage usage = GPU_ONLY,
+                                              bool is_linear = false) noexcept -> kstd::Result<Allocation>;
+
+        /**
+         * This function frees the specified allocation. Empty blocks are given back to the driver as long as another
+         * block of the same kind exists.
+         *
+         * @param allocation The allocation
+         *
+         * @author           Cedric Hammes
+         * @since            16/10/2026
+         */
+        auto free(const Allocation& allocation) noexcept -> void;
+
+        /**
+         * This function moves the allocations out of the least used blocks (at most half used) into other blocks of
+         * the same kind and frees the blocks, which became empty. The specified function has to copy the content and
+         * rebind the resource for every move and must not call into the allocator. The GPU must not use the moved
+         * allocations.
+         *
+         * @param move_function The function, which moves a single allocation
+         * @return              The statistics of the defragmentation or an error
+         *
+         * @author              Cedric Hammes
+         * @since               16/10/2026
+         */
+        [[nodiscard]] auto defragment(const MoveFunction& move_function) noexcept
+                -> kstd::Result<DefragmentationStatistics>;
+
+        /**
+         * This function returns the statistics of the allocator like the used and reserved bytes and the
+         * fragmentation of the blocks.
+         *
+         * @return The statistics of the allocator
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_statistics() const noexcept -> MemoryStatistics;
+    };
+
+    /**
+     * This class is a linear pool of device memory for data, which lives for a single frame. The pool owns a single
+     * allocation, which is bump-allocated and reset at once when the frame is reused.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class LinearMemoryPool final {
+        MemoryAllocator* _memory_allocator;
+        Allocation _allocation;
+        LinearAllocator _linear_allocator;
+
+        public:
+        static constexpr VkDeviceSize BASE_ALIGNMENT = 4096;
+
+        /**
+         * This constructor creates an empty pool without memory.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        LinearMemoryPool() noexcept;
+
+        /**
+         * This constructor allocates the memory of the pool by the specified allocator. The memory is aligned to the
+         * base alignment, so all alignments up to the base alignment are respected by the allocations of the pool.
+         *
+         * @param memory_allocator The allocator of the pool memory
+         * @param size             The size of the pool
+         * @param usage            The usage of the pool memory
+         * @param memory_type_bits The allowed memory types of the pool memory
+         *
+         * @author                 Cedric Hammes
+         * @since                  16/10/2026
+         */
+        LinearMemoryPool(MemoryAllocator* memory_allocator, VkDeviceSize size, MemoryUsage usage = CPU_TO_GPU,
+                         uint32_t memory_type_bits = std::numeric_limits<uint32_t>::max());
+        LinearMemoryPool(LinearMemoryPool&& other) noexcept;
+        ~LinearMemoryPool() noexcept;
+        KSTD_NO_COPY(LinearMemoryPool, LinearMemoryPool);
+
+        /**
+         * This function allocates a range of the pool memory. The returned allocation must not be freed.
+         *
+         * @param size      The size of the range
+         * @param alignment The alignment of the range
+         * @return          The allocation or an error
+         *
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        [[nodiscard]] auto allocate(VkDeviceSize size, VkDeviceSize alignment = 1) noexcept -> kstd::Result<Allocation>;
+
+        /**
+         * This function frees all allocations of the pool at once. The GPU must be done with the pool memory.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        auto reset() noexcept -> void;
+
+        [[nodiscard]] auto get_allocation() const noexcept -> const Allocation&;
+        [[nodiscard]] auto get_used_size() const noexcept -> VkDeviceSize;
+
+        auto operator=(LinearMemoryPool&& other) noexcept -> LinearMemoryPool&;
+    };
+}// namespace aetherium::renderer::vulkan
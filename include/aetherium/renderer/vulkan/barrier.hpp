@@ -0,0 +1,169 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+#include "aetherium/utils.hpp"
+#include <vector>
+
+namespace aetherium::renderer::vulkan {
+    /**
+     * This struct describes the pipeline stages and memory accesses, in which an image in a specific layout is used.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct LayoutUsage {
+        VkPipelineStageFlags2 stage_mask;
+        VkAccessFlags2 access_mask;
+    };
+
+    /**
+     * This function returns the stages and accesses, in which an image in the specified layout can be used. The masks
+     * are used for layout transitions, when the exact usage of the image is unknown.
+     *
+     * @param layout The layout of the image
+     * @return       The stages and accesses of the layout
+     *
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    [[nodiscard]] auto get_layout_usage(VkImageLayout layout) noexcept -> LayoutUsage;
+
+    /**
+     * This function returns the aspects of an image with the specified format.
+     *
+     * @param format The format of the image
+     * @return       The aspects of the format
+     *
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    [[nodiscard]] auto get_aspect_mask(VkFormat format) noexcept -> VkImageAspectFlags;
+
+    /**
+     * This class collects image, buffer and global memory barriers and records all of them with a single
+     * vkCmdPipelineBarrier2 call. Barriers for the same image, buffer range or global memory are merged into one.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class BarrierBatch final {
+        std::vector<VkImageMemoryBarrier2> _image_barriers {};
+        std::vector<VkBufferMemoryBarrier2> _buffer_barriers {};
+        std::vector<VkMemoryBarrier2> _memory_barriers {};
+
+        public:
+        /**
+         * This function adds a layout transition of the whole image. The stages and accesses on both sides of the
+         * barrier are derived from the old and new layout.
+         *
+         * @param image       The image
+         * @param aspect_mask The aspects of the image
+         * @param old_layout  The layout before the barrier
+         * @param new_layout  The layout after the barrier
+         * @return            The batch itself
+         *
+         * @author            Cedric Hammes
+         * @since             16/10/2026
+         */
+        auto transition_image(VkImage image, VkImageAspectFlags aspect_mask, VkImageLayout old_layout,
+                              VkImageLayout new_layout) noexcept -> BarrierBatch&;
+
+        /**
+         * This function adds a barrier for the specified image range with explicit stages and accesses. The layout is
+         * transitioned, if the old and new layout differ.
+         *
+         * @param image             The image
+         * @param subresource_range The range of the image
+         * @param old_layout        The layout before the barrier
+         * @param new_layout        The layout after the barrier
+         * @param src_stage_mask    The stages, which are waited for
+         * @param src_access_mask   The accesses, which are made available
+         * @param dst_stage_mask    The stages, which wait for the barrier
+         * @param dst_access_mask   The accesses, which are made visible
+         * @return                  The batch itself
+         *
+         * @author                  Cedric Hammes
+         * @since                   16/10/2026
+         */
+        auto image_barrier(VkImage image, const VkImageSubresourceRange& subresource_range, VkImageLayout old_layout,
+                           VkImageLayout new_layout, VkPipelineStageFlags2 src_stage_mask,
+                           VkAccessFlags2 src_access_mask, VkPipelineStageFlags2 dst_stage_mask,
+                           VkAccessFlags2 dst_access_mask) noexcept -> BarrierBatch&;
+
+        /**
+         * This function adds a barrier for the specified buffer range.
+         *
+         * @param buffer          The buffer
+         * @param offset          The offset of the range
+         * @param size            The size of the range or VK_WHOLE_SIZE
+         * @param src_stage_mask  The stages, which are waited for
+         * @param src_access_mask The accesses, which are made available
+         * @param dst_stage_mask  The stages, which wait for the barrier
+         * @param dst_access_mask The accesses, which are made visible
+         * @return                The batch itself
+         *
+         * @author                Cedric Hammes
+         * @since                 16/10/2026
+         */
+        auto buffer_barrier(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size,
+                            VkPipelineStageFlags2 src_stage_mask, VkAccessFlags2 src_access_mask,
+                            VkPipelineStageFlags2 dst_stage_mask, VkAccessFlags2 dst_access_mask) noexcept
+                -> BarrierBatch&;
+
+        /**
+         * This function adds a global memory barrier, which applies to all resources. All global barriers of the
+         * batch are merged into a single barrier.
+         *
+         * @param src_stage_mask  The stages, which are waited for
+         * @param src_access_mask The accesses, which are made available
+         * @param dst_stage_mask  The stages, which wait for the barrier
+         * @param dst_access_mask The accesses, which are made visible
+         * @return                The batch itself
+         *
+         * @author                Cedric Hammes
+         * @since                 16/10/2026
+         */
+        auto memory_barrier(VkPipelineStageFlags2 src_stage_mask, VkAccessFlags2 src_access_mask,
+                            VkPipelineStageFlags2 dst_stage_mask, VkAccessFlags2 dst_access_mask) noexcept
+                -> BarrierBatch&;
+
+        /**
+         * This function records all barriers of the batch with a single vkCmdPipelineBarrier2 call into the specified
+         * command buffer. Nothing is recorded, if the batch is empty.
+         *
+         * @param command_buffer The command buffer
+         *
+         * @author               Cedric Hammes
+         * @since                16/10/2026
+         */
+        auto record(VkCommandBuffer command_buffer) const noexcept -> void;
+
+        /**
+         * This function records all barriers of the batch into the specified command buffer and clears the batch.
+         *
+         * @param command_buffer The command buffer
+         *
+         * @author               Cedric Hammes
+         * @since                16/10/2026
+         */
+        auto flush(VkCommandBuffer command_buffer) noexcept -> void;
+        auto clear() noexcept -> void;
+
+        [[nodiscard]] auto get_image_barriers() const noexcept -> const std::vector<VkImageMemoryBarrier2>&;
+        [[nodiscard]] auto get_barrier_count() const noexcept -> uint32_t;
+        [[nodiscard]] auto is_empty() const noexcept -> bool;
+    };
+}// namespace aetherium::renderer::vulkan
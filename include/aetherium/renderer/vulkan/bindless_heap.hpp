@@ -0,0 +1,203 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+#include "aetherium/renderer/vulkan/device.hpp"
+#include <array>
+#include <deque>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace aetherium::renderer::vulkan {
+    constexpr uint32_t BINDLESS_IMAGE_BINDING = 0;
+    constexpr uint32_t BINDLESS_BUFFER_BINDING = 1;
+    constexpr uint32_t BINDLESS_SAMPLER_BINDING = 2;
+
+    /**
+     * This struct contains the sizes of the descriptor arrays of the bindless descriptor heap. The sizes are clamped
+     * to the update-after-bind limits of the device.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct BindlessHeapLimits {
+        uint32_t max_images = 16384;
+        uint32_t max_buffers = 16384;
+        uint32_t max_samplers = 256;
+        uint32_t push_constant_size = 128;
+    };
+
+    /**
+     * This class is a single global descriptor set with large, partially bound arrays of sampled images, storage
+     * buffers and samplers. Resources register themselves once and get a stable index into their array, which is
+     * passed to the shaders by push constants. So all draws share the same descriptor set and the same pipeline
+     * layout, and per-draw descriptor binding goes away.
+     *
+     * The shaders declare the arrays in set 0 with the bindings BINDLESS_IMAGE_BINDING, BINDLESS_BUFFER_BINDING and
+     * BINDLESS_SAMPLER_BINDING. Freed indices are only reused after all frames in flight, which could still read the
+     * old descriptor, are done.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class BindlessHeap final {
+        struct IndexPool {
+            uint32_t capacity = 0;
+            uint32_t next_index = 0;
+            std::vector<uint32_t> free_indices {};
+            std::deque<std::pair<uint64_t, uint32_t>> retired_indices {};
+        };
+
+        VkDevice _virtual_device;
+        VkDescriptorPool _descriptor_pool;
+        VkDescriptorSetLayout _descriptor_set_layout;
+        VkPipelineLayout _pipeline_layout;
+        VkDescriptorSet _descriptor_set;
+        std::mutex _mutex;
+        std::array<IndexPool, 3> _index_pools {};
+        uint64_t _frame_index;
+        uint32_t _frames_in_flight;
+        uint32_t _push_constant_size;
+
+        auto destroy() noexcept -> void;
+        auto acquire_index(uint32_t binding) noexcept -> kstd::Result<uint32_t>;
+        auto release_index(uint32_t binding, uint32_t index) noexcept -> void;
+        auto write_descriptor(uint32_t binding, uint32_t index, const VkDescriptorImageInfo* image_info,
+                              const VkDescriptorBufferInfo* buffer_info) const noexcept -> void;
+
+        public:
+        /**
+         * This constructor creates the descriptor pool, the descriptor set layout, the pipeline layout and the global
+         * descriptor set of the heap. The device must support descriptor indexing.
+         *
+         * @param vulkan_device    The device, on which the heap is created
+         * @param limits           The sizes of the descriptor arrays
+         * @param frames_in_flight The count of frames, which could still use a freed index
+         *
+         * @author                 Cedric Hammes
+         * @since                  16/10/2026
+         */
+        BindlessHeap(const VulkanDevice* vulkan_device, const BindlessHeapLimits& limits, uint32_t frames_in_flight);
+        ~BindlessHeap() noexcept;
+        KSTD_NO_MOVE_COPY(BindlessHeap, BindlessHeap);
+
+        /**
+         * This function registers the specified image view in the sampled image array and returns its index.
+         *
+         * @param image_view   The image view
+         * @param image_layout The layout of the image, while it's read by the shaders
+         * @return             The index of the image or an error, if the array is full
+         *
+         * @author             Cedric Hammes
+         * @since              16/10/2026
+         */
+        [[nodiscard]] auto
+        register_image(VkImageView image_view,
+                       VkImageLayout image_layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) noexcept
+                -> kstd::Result<uint32_t>;
+
+        /**
+         * This function registers the specified range of a buffer in the storage buffer array and returns its index.
+         *
+         * @param buffer The buffer
+         * @param offset The offset of the range in the buffer
+         * @param range  The size of the range
+         * @return       The index of the buffer or an error, if the array is full
+         *
+         * @author       Cedric Hammes
+         * @since        16/10/2026
+         */
+        [[nodiscard]] auto register_buffer(VkBuffer buffer, VkDeviceSize offset = 0,
+                                           VkDeviceSize range = VK_WHOLE_SIZE) noexcept -> kstd::Result<uint32_t>;
+        [[nodiscard]] auto register_sampler(VkSampler sampler) noexcept -> kstd::Result<uint32_t>;
+
+        /**
+         * This function replaces the image view behind an already registered index. This is used when a resource is
+         * reloaded, so the index stays stable for all users of the resource.
+         *
+         * @param index        The index of the image
+         * @param image_view   The new image view
+         * @param image_layout The layout of the image, while it's read by the shaders
+         *
+         * @author             Cedric Hammes
+         * @since              16/10/2026
+         */
+        auto update_image(uint32_t index, VkImageView image_view,
+                          VkImageLayout image_layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) const noexcept -> void;
+        auto update_buffer(uint32_t index, VkBuffer buffer, VkDeviceSize offset = 0,
+                           VkDeviceSize range = VK_WHOLE_SIZE) const noexcept -> void;
+
+        auto unregister_image(uint32_t index) noexcept -> void;
+        auto unregister_buffer(uint32_t index) noexcept -> void;
+        auto unregister_sampler(uint32_t index) noexcept -> void;
+
+        /**
+         * This function advances the heap to the next frame and returns the indices, which were freed before all
+         * frames in flight, back to the free lists. The renderer calls this function once per frame.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        auto next_frame() noexcept -> void;
+
+        /**
+         * This function binds the global descriptor set to set 0 of the specified command buffer. Secondary command
+         * buffers don't inherit bound descriptor sets, so every draw recorder has to bind the heap itself.
+         *
+         * @param command_buffer The command buffer
+         * @param bind_point     The pipeline bind point, to which the set is bound
+         *
+         * @author               Cedric Hammes
+         * @since                16/10/2026
+         */
+        auto bind(VkCommandBuffer command_buffer,
+                  VkPipelineBindPoint bind_point = VK_PIPELINE_BIND_POINT_GRAPHICS) const noexcept -> void;
+
+        /**
+         * This function pushes the specified constants, which usually contain the indices of the resources used by
+         * the draw, with the pipeline layout of the heap. The constants must fit into the push constant range of the
+         * heap, which is clamped to the limit of the device.
+         *
+         * @tparam T             The type of the constants
+         * @param command_buffer The command buffer
+         * @param constants      The constants itself
+         * @return               Success or an error, if the constants are larger than the push constant range
+         *
+         * @author               Cedric Hammes
+         * @since                16/10/2026
+         */
+        template<typename T>
+        auto push_constants(VkCommandBuffer command_buffer, const T& constants) const noexcept -> kstd::Result<void> {
+            using namespace std::string_literals;
+            static_assert(std::is_trivially_copyable_v<T>, "Push constants must be trivially copyable");
+            static_assert(sizeof(T) % 4 == 0, "The size of push constants must be a multiple of 4");
+            if(sizeof(T) > _push_constant_size) {
+                return kstd::Error {"Unable to push constants: The constants exceed the push constant range"s};
+            }
+            vkCmdPushConstants(command_buffer, _pipeline_layout, VK_SHADER_STAGE_ALL, 0, sizeof(T), &constants);
+            return {};
+        }
+
+        [[nodiscard]] auto get_descriptor_set_layout() const noexcept -> VkDescriptorSetLayout;
+        [[nodiscard]] auto get_pipeline_layout() const noexcept -> VkPipelineLayout;
+
+        auto operator*() const noexcept -> VkDescriptorSet;
+    };
+}// namespace aetherium::renderer::vulkan
@@ -0,0 +1,129 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include "aetherium/thread_pool.hpp"
+#include "aetherium/utils.hpp"
+#include <functional>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <memory>
+#include <mutex>
+#include <parallel_hashmap/phmap.h>
+#include <thread>
+#include <vector>
+
+namespace aetherium::renderer::vulkan {
+    /**
+     * This type is a function, which records commands into the specified command buffer.
+     */
+    using RecordFunction = std::function<void(VkCommandBuffer)>;
+
+    /**
+     * This class is a registry of command pools per recording thread and queue family of a device. Command pools
+     * can't be used by multiple threads at the same time, so every thread, which records secondary command buffers,
+     * gets its own pool. The registry is owned by a frame and gets reset wholesale when the frame is reused.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class CommandPoolRegistry final {
+        struct ThreadCommandPool {
+            VkCommandPool command_pool;
+            std::vector<VkCommandBuffer> secondary_command_buffers;
+            size_t used_command_buffers;
+        };
+
+        struct PoolKey {
+            std::thread::id thread_id;
+            uint32_t queue_family_index;
+
+            [[nodiscard]] auto operator==(const PoolKey& other) const noexcept -> bool {
+                return thread_id == other.thread_id && queue_family_index == other.queue_family_index;
+            }
+        };
+
+        struct PoolKeyHash {
+            [[nodiscard]] auto operator()(const PoolKey& key) const noexcept -> size_t {
+                return phmap::HashState().combine(0, std::hash<std::thread::id> {}(key.thread_id),
+                                                  key.queue_family_index);
+            }
+        };
+
+        VkDevice _device;
+        std::mutex _mutex;
+        phmap::flat_hash_map<PoolKey, std::unique_ptr<ThreadCommandPool>, PoolKeyHash> _pools {};
+
+        [[nodiscard]] auto get_thread_pool(uint32_t queue_family_index) noexcept -> kstd::Result<ThreadCommandPool*>;
+
+        public:
+        /**
+         * This constructor creates an empty registry for the specified device.
+         *
+         * @param device The handle to the device
+         *
+         * @author       Cedric Hammes
+         * @since        16/10/2026
+         */
+        explicit CommandPoolRegistry(VkDevice device) noexcept;
+        ~CommandPoolRegistry() noexcept;
+        KSTD_NO_MOVE_COPY(CommandPoolRegistry, CommandPoolRegistry);
+
+        /**
+         * This function returns a secondary command buffer from the pool of the calling thread for the specified
+         * queue family. The pool gets created on the first use by the thread.
+         *
+         * @param queue_family_index The index of the queue family
+         * @return                   The secondary command buffer or an error
+         *
+         * @author                   Cedric Hammes
+         * @since                    16/10/2026
+         */
+        [[nodiscard]] auto acquire_secondary_command_buffer(uint32_t queue_family_index) noexcept
+                -> kstd::Result<VkCommandBuffer>;
+
+        /**
+         * This function resets all pools of the registry and makes their command buffers available again. The GPU
+         * must be done with all command buffers of the registry and no thread must record at the same time.
+         *
+         * @return Success or error
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto reset() noexcept -> kstd::Result<void>;
+    };
+
+    /**
+     * This function records the specified functions into secondary command buffers on the worker threads of the
+     * thread pool. The secondary command buffers continue the dynamic rendering described by the rendering info, so
+     * they can be stitched into the primary command buffer with vkCmdExecuteCommands. The order of the returned
+     * command buffers matches the order of the functions.
+     *
+     * @param thread_pool        The pool, on which the functions are recorded
+     * @param registry           The registry of the per-thread command pools
+     * @param queue_family_index The index of the queue family of the primary command buffer
+     * @param rendering_info     The inheritance info of the dynamic rendering
+     * @param functions          The functions, which record the commands
+     * @return                   The recorded secondary command buffers or an error
+     *
+     * @author                   Cedric Hammes
+     * @since                    16/10/2026
+     */
+    [[nodiscard]] auto record_secondary_command_buffers(ThreadPool& thread_pool, CommandPoolRegistry& registry,
+                                                        uint32_t queue_family_index,
+                                                        const VkCommandBufferInheritanceRenderingInfo& rendering_info,
+                                                        const std::vector<RecordFunction>& functions) noexcept
+            -> kstd::Result<std::vector<VkCommandBuffer>>;
+}// namespace aetherium::renderer::vulkan
@@ -0,0 +1,228 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include "aetherium/renderer/vulkan/queue.hpp"
+#include "aetherium/utils.hpp"
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <limits>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace aetherium::renderer::vulkan {
+    class CommandSubmitter;
+
+    /**
+     * This class is a waitable ticket for command buffers, which were emitted asynchronously. The ticket holds the
+     * value of the timeline semaphore, which gets signaled when the batch of the command buffer is done.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class SubmitTicket final {
+        CommandSubmitter* _command_submitter;
+        uint64_t _value;
+
+        public:
+        /**
+         * This constructor creates an empty ticket, which is always done
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        SubmitTicket() noexcept;
+
+        /**
+         * This constructor creates a ticket for the specified timeline value of the submitter.
+         *
+         * @param command_submitter The submitter, which has recorded the command buffer
+         * @param value             The timeline value of the batch
+         *
+         * @author                  Cedric Hammes
+         * @since                   16/10/2026
+         */
+        SubmitTicket(CommandSubmitter* command_submitter, uint64_t value) noexcept;
+        ~SubmitTicket() noexcept = default;
+        KSTD_DEFAULT_MOVE_COPY(SubmitTicket, SubmitTicket);
+
+        /**
+         * This function waits until the batch of the command buffer is executed. If the batch isn't submitted yet,
+         * the submitter gets flushed before the wait.
+         *
+         * @param timeout The maximal wait timeout
+         * @return        Success or error
+         *
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] auto wait(uint64_t timeout = std::numeric_limits<uint64_t>::max()) const noexcept
+                -> kstd::Result<void>;
+
+        /**
+         * This function returns whether the batch of the command buffer is executed without blocking.
+         *
+         * @return Whether the command buffer is done
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto is_done() const noexcept -> bool;
+        [[nodiscard]] auto get_value() const noexcept -> uint64_t;
+
+        /**
+         * This function returns the timeline semaphore, which reaches the value of the ticket after the batch. Other
+         * submits wait on the semaphore with the value to be ordered after the command buffer.
+         *
+         * @return The timeline semaphore or a null handle for an empty ticket
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_timeline_semaphore() const noexcept -> VkSemaphore;
+    };
+
+    /**
+     * This class records one-off command buffers into pooled transient command buffers and batches them into a
+     * single submit per flush. Every flushed batch signals the next value of a timeline semaphore, so the command
+     * buffers are recycled without any fence and the emitter can wait for or poll the batch by the ticket.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class CommandSubmitter final {
+        struct InFlightCommandBuffer {
+            VkCommandBuffer command_buffer;
+            uint64_t value;
+        };
+
+        VkDevice _device;
+        const Queue* _queue;
+        VkCommandPool _command_pool;
+        VkSemaphore _timeline_semaphore;
+        mutable std::mutex _mutex;
+        std::vector<VkCommandBuffer> _free_command_buffers {};
+        std::vector<VkCommandBuffer> _pending_command_buffers {};
+        std::vector<InFlightCommandBuffer> _in_flight_command_buffers {};
+        uint64_t _submitted_value;
+
+        [[nodiscard]] auto acquire_command_buffer() noexcept -> kstd::Result<VkCommandBuffer>;
+        auto collect_command_buffers() noexcept -> void;
+        [[nodiscard]] auto flush_pending() noexcept -> kstd::Result<void>;
+
+        public:
+        /**
+         * This constructor creates the transient command pool and the timeline semaphore of the submitter.
+         *
+         * @param device The handle to the device
+         * @param queue  The queue, to which the batches are submitted
+         *
+         * @author       Cedric Hammes
+         * @since        16/10/2026
+         */
+        CommandSubmitter(VkDevice device, const Queue* queue);
+        ~CommandSubmitter() noexcept;
+        KSTD_NO_MOVE_COPY(CommandSubmitter, CommandSubmitter);
+
+        /**
+         * This function records the specified function into a pooled command buffer and enqueues the command buffer
+         * into the next batch. The command buffer is submitted with the next flush, so this function doesn't block
+         * on the GPU. The function must not emit command buffers itself.
+         *
+         * @tparam F       The function type
+         * @param function The function, which records the commands
+         * @return         The ticket of the command buffer or an error
+         *
+         * @author         Cedric Hammes
+         * @since          16/10/2026
+         */
+        template<typename F>
+        [[nodiscard]] auto record(F&& function) noexcept -> kstd::Result<SubmitTicket> {
+            static_assert(std::is_invocable_v<F, VkCommandBuffer>, "Invalid command buffer consumer");
+            const std::lock_guard<std::mutex> lock {_mutex};
+
+            const auto command_buffer_result = acquire_command_buffer();
+            if(command_buffer_result.is_error()) {
+                return kstd::Error {command_buffer_result.get_error()};
+            }
+            const auto command_buffer = *command_buffer_result;
+
+            VkCommandBufferBeginInfo command_buffer_begin_info {};
+            command_buffer_begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            command_buffer_begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            if(const auto result = vkBeginCommandBuffer(command_buffer, &command_buffer_begin_info);
+               result != VK_SUCCESS) {
+                _free_command_buffers.push_back(command_buffer);
+                return kstd::Error {
+                        fmt::format("Unable to begin command buffer: {}", get_vulkan_error_message(result))};
+            }
+            function(command_buffer);
+            if(const auto result = vkEndCommandBuffer(command_buffer); result != VK_SUCCESS) {
+                _free_command_buffers.push_back(command_buffer);
+                return kstd::Error {fmt::format("Unable to end command buffer: {}", get_vulkan_error_message(result))};
+            }
+
+            _pending_command_buffers.push_back(command_buffer);
+            return SubmitTicket {this, _submitted_value + 1};
+        }
+
+        /**
+         * This function submits all pending command buffers with a single submit and recycles the command buffers of
+         * all finished batches. This function is called once per tick.
+         *
+         * @return The ticket of the last submitted batch or an error
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto flush() noexcept -> kstd::Result<SubmitTicket>;
+
+        /**
+         * This function waits until the batch with the specified timeline value is executed. If the batch isn't
+         * submitted yet, the pending command buffers are flushed before the wait.
+         *
+         * @param value   The timeline value of the batch
+         * @param timeout The maximal wait timeout
+         * @return        Success or error
+         *
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] auto wait(uint64_t value, uint64_t timeout = std::numeric_limits<uint64_t>::max()) noexcept
+                -> kstd::Result<void>;
+
+        /**
+         * This function returns whether the batch with the specified timeline value is executed without blocking.
+         *
+         * @param value The timeline value of the batch
+         * @return      Whether the batch is done
+         *
+         * @author      Cedric Hammes
+         * @since       16/10/2026
+         */
+        [[nodiscard]] auto is_done(uint64_t value) const noexcept -> bool;
+
+        /**
+         * This function returns the timeline semaphore of the submitter. Other submits can wait on the semaphore with
+         * the value of a ticket to be ordered after the emitted command buffers.
+         *
+         * @return The timeline semaphore handle
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_timeline_semaphore() const noexcept -> VkSemaphore;
+    };
+}// namespace aetherium::renderer::vulkan
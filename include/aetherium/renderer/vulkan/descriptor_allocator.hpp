@@ -0,0 +1,273 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+#include "aetherium/renderer/vulkan/device.hpp"
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <mutex>
+#include <parallel_hashmap/phmap.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace aetherium::renderer::vulkan {
+    /**
+     * This struct describes how many descriptors of a type are reserved per descriptor set in a pool.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct DescriptorPoolRatio {
+        VkDescriptorType descriptor_type;
+        float ratio;
+    };
+
+    /**
+     * This function returns the default count of descriptors per set and type, which are reserved in the pools of a
+     * descriptor allocator. All descriptor types, which are supported by the descriptor writes, are reserved.
+     *
+     * @return The default pool ratios
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    [[nodiscard]] auto get_default_pool_ratios() noexcept -> std::vector<DescriptorPoolRatio>;
+
+    /**
+     * This struct describes a single descriptor, which is written into a descriptor set. Depending on the type,
+     * either the image info, the buffer info or the texel buffer view is used.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct DescriptorWrite {
+        uint32_t binding;
+        uint32_t array_element;
+        VkDescriptorType descriptor_type;
+        VkDescriptorImageInfo image_info;
+        VkDescriptorBufferInfo buffer_info;
+        VkBufferView texel_buffer_view;
+    };
+
+    /**
+     * This struct contains the statistics of a descriptor allocator. An exhaustion is counted, when a pool has no
+     * space left for an allocation, and a growth, when a new pool is created after the first one.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct DescriptorAllocatorStatistics {
+        uint32_t pool_count;
+        uint32_t allocated_sets;
+        uint32_t exhaustions;
+        uint32_t growths;
+    };
+
+    /**
+     * This class allocates descriptor sets out of a growing list of descriptor pools. Individual sets are never
+     * freed, instead all pools are reset at once. Every frame owns an allocator, which is reset when the frame is
+     * reused, so the hot path never calls vkFreeDescriptorSets. If all pools are exhausted, a new pool with twice the
+     * size of the previous one is created.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class DescriptorAllocator final {
+        VkDevice _virtual_device;
+        std::vector<DescriptorPoolRatio> _pool_ratios;
+        uint32_t _sets_per_pool;
+        std::mutex _mutex;
+        std::vector<VkDescriptorPool> _ready_pools {};
+        std::vector<VkDescriptorPool> _full_pools {};
+        DescriptorAllocatorStatistics _statistics {};
+
+        auto create_pool() noexcept -> kstd::Result<VkDescriptorPool>;
+
+        public:
+        /**
+         * This constructor creates the descriptor allocator. The first pool is created with the first allocation.
+         *
+         * @param vulkan_device The device, on which the pools are created
+         * @param sets_per_pool The count of sets in the first pool
+         * @param pool_ratios   The count of descriptors per set and type, which are reserved in the pools
+         *
+         * @author              Cedric Hammes
+         * @since               16/10/2026
+         */
+        explicit DescriptorAllocator(const VulkanDevice* vulkan_device, uint32_t sets_per_pool = 64,
+                                     std::vector<DescriptorPoolRatio> pool_ratios = get_default_pool_ratios()) noexcept;
+        ~DescriptorAllocator() noexcept;
+        KSTD_NO_MOVE_COPY(DescriptorAllocator, DescriptorAllocator);
+
+        /**
+         * This function allocates a descriptor set with the specified layout. If the current pool is exhausted, the
+         * allocation is retried with a new pool.
+         *
+         * @param layout The layout of the descriptor set
+         * @return       The descriptor set or an error
+         *
+         * @author       Cedric Hammes
+         * @since        16/10/2026
+         */
+        [[nodiscard]] auto allocate(VkDescriptorSetLayout layout) noexcept -> kstd::Result<VkDescriptorSet>;
+
+        /**
+         * This function allocates a descriptor set with the specified layout and writes the specified descriptors
+         * into the set. Descriptors of a type without pool ratio are rejected before the allocation, because no new
+         * pool could ever satisfy them.
+         *
+         * @param layout The layout of the descriptor set
+         * @param writes The descriptors of the set
+         * @return       The descriptor set or an error
+         *
+         * @author       Cedric Hammes
+         * @since        16/10/2026
+         */
+        [[nodiscard]] auto allocate(VkDescriptorSetLayout layout, const std::vector<DescriptorWrite>& writes) noexcept
+                -> kstd::Result<VkDescriptorSet>;
+
+        /**
+         * This function writes the specified descriptors into a descriptor set, which was allocated by this
+         * allocator. The GPU must be done with the set.
+         *
+         * @param descriptor_set The descriptor set
+         * @param writes         The descriptors of the set
+         * @return               Success or an error, if a descriptor type isn't supported
+         *
+         * @author               Cedric Hammes
+         * @since                16/10/2026
+         */
+        [[nodiscard]] auto write(VkDescriptorSet descriptor_set, const std::vector<DescriptorWrite>& writes) noexcept
+                -> kstd::Result<void>;
+
+        /**
+         * This function resets all pools at once and frees all descriptor sets of the allocator. The GPU must be done
+         * with all sets.
+         *
+         * @return Success or error
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto reset() noexcept -> kstd::Result<void>;
+        [[nodiscard]] auto get_statistics() noexcept -> DescriptorAllocatorStatistics;
+    };
+
+    /**
+     * This class caches descriptor sets, which never change after their creation, like the sets of materials. The
+     * sets are keyed by their layout and the content of all descriptors, so equal requests share one set and the set
+     * is only written once. Evicted sets are kept per layout and rewritten by the next set with the same layout.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class DescriptorSetCache final {
+        // Handles of different object types may have the same value, so the type is part of the key
+        using HandleKey = std::pair<VkObjectType, uint64_t>;
+
+        struct CachedSet {
+            VkDescriptorSet descriptor_set;
+            VkDescriptorSetLayout layout;
+            std::vector<HandleKey> handle_keys;
+        };
+
+        DescriptorAllocator _descriptor_allocator;
+        std::mutex _mutex;
+        phmap::flat_hash_map<std::string, CachedSet> _descriptor_sets {};
+        phmap::flat_hash_map<HandleKey, std::vector<std::string>> _keys_by_handle {};
+        phmap::flat_hash_map<VkDescriptorSetLayout, std::vector<VkDescriptorSet>> _free_sets {};
+
+        auto evict_handle(const HandleKey& handle_key) noexcept -> void;
+
+        public:
+        /**
+         * This constructor creates the empty descriptor set cache.
+         *
+         * @param vulkan_device The device, on which the sets are created
+         * @param sets_per_pool The count of sets in the first pool
+         * @param pool_ratios   The count of descriptors per set and type, which are reserved in the pools
+         *
+         * @author              Cedric Hammes
+         * @since               16/10/2026
+         */
+        explicit DescriptorSetCache(const VulkanDevice* vulkan_device, uint32_t sets_per_pool = 64,
+                                    std::vector<DescriptorPoolRatio> pool_ratios = get_default_pool_ratios()) noexcept;
+        ~DescriptorSetCache() noexcept = default;
+        KSTD_NO_MOVE_COPY(DescriptorSetCache, DescriptorSetCache);
+
+        /**
+         * This function returns the descriptor set with the specified layout and descriptors. If the set doesn't
+         * exist yet, it's allocated and written.
+         *
+         * @param layout The layout of the descriptor set
+         * @param writes The descriptors of the set
+         * @return       The descriptor set or an error
+         *
+         * @author       Cedric Hammes
+         * @since        16/10/2026
+         */
+        [[nodiscard]] auto get_or_create(VkDescriptorSetLayout layout,
+                                         const std::vector<DescriptorWrite>& writes) noexcept
+                -> kstd::Result<VkDescriptorSet>;
+
+        /**
+         * This function removes all cached sets, which reference the specified image view. It has to be called
+         * before the image view is destroyed, because the driver may reuse the handle for a new view. The GPU must be
+         * done with the evicted sets, because they're rewritten by later sets with the same layout.
+         *
+         * @param image_view The image view, which is destroyed
+         *
+         * @author           Cedric Hammes
+         * @since            16/10/2026
+         */
+        auto evict_image_view(VkImageView image_view) noexcept -> void;
+
+        /**
+         * This function removes all cached sets, which reference the specified buffer. It has to be called before
+         * the buffer is destroyed, because the driver may reuse the handle for a new buffer.
+         *
+         * @param buffer The buffer, which is destroyed
+         *
+         * @author       Cedric Hammes
+         * @since        16/10/2026
+         */
+        auto evict_buffer(VkBuffer buffer) noexcept -> void;
+
+        /**
+         * This function removes all cached sets, which reference the specified texel buffer view. It has to be
+         * called before the view is destroyed, because the driver may reuse the handle for a new view.
+         *
+         * @param buffer_view The texel buffer view, which is destroyed
+         *
+         * @author            Cedric Hammes
+         * @since             16/10/2026
+         */
+        auto evict_buffer_view(VkBufferView buffer_view) noexcept -> void;
+
+        /**
+         * This function removes all cached sets and resets the pools of the cache, for example after a hot reload
+         * destroyed the resources of the sets. The GPU must be done with all sets of the cache.
+         *
+         * @return Success or error
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto clear() noexcept -> kstd::Result<void>;
+
+        [[nodiscard]] auto get_statistics() noexcept -> DescriptorAllocatorStatistics;
+    };
+}// namespace aetherium::renderer::vulkan
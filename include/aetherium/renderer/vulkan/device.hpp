@@ -13,14 +13,22 @@
 // limitations under the License.
 
 #pragma once
+#include "aetherium/renderer/vulkan/command_submitter.hpp"
+#include "aetherium/renderer/vulkan/queue.hpp"
 #include "aetherium/utils.hpp"
+#include <array>
 #include <kstd/defaults.hpp>
 #include <kstd/option.hpp>
 #include <kstd/result.hpp>
 #include <kstd/safe_alloc.hpp>
+#include <memory>
 #include <type_traits>
+#include <vector>
 
 namespace aetherium::renderer::vulkan {
+    class MemoryAllocator;
+    class StagingRing;
+
     /**
      * This class is a wrapper around the command buffer to perform actions and push them to the queue.
      *
@@ -30,7 +38,9 @@ namespace aetherium::renderer::vulkan {
     class CommandBuffer;
 
     /**
-     * This class is a wrapper around the Vulkan device handle and physical device handle.
+     * This class is a wrapper around the Vulkan device handle and physical device handle. While the creation, the
+     * device enumerates the queue families and creates a queue store with a graphics, a compute and a transfer queue.
+     * Dedicated compute and transfer families are preferred, so uploads and compute passes can overlap graphics work.
      *
      * @author Cedric Hammes
      * @since  04/02/2024
@@ -39,7 +49,13 @@ namespace aetherium::renderer::vulkan {
         VkPhysicalDevice _physical_device;
         VkDevice _virtual_device;
         VkPhysicalDeviceProperties _properties {};
-        VkQueue _graphics_queue;// TODO: Support multiple queues
+        bool _supports_descriptor_indexing;
+        std::vector<std::unique_ptr<Queue>> _queues;
+        std::array<Queue*, 3> _queues_by_type;
+        std::vector<std::unique_ptr<CommandSubmitter>> _command_submitters;
+        std::array<CommandSubmitter*, 3> _command_submitters_by_type;
+        std::unique_ptr<MemoryAllocator> _memory_allocator;
+        std::unique_ptr<StagingRing> _staging_ring;
 
         public:
         /**
@@ -63,22 +79,111 @@ namespace aetherium::renderer::vulkan {
         ~VulkanDevice() noexcept;
         KSTD_NO_COPY(VulkanDevice, VulkanDevice);
 
+        /**
+         * This function records the specified function into a pooled one-time command buffer and enqueues it into the
+         * next batch of the queue. The batch is submitted with the next flush, so this function doesn't wait for the
+         * GPU. The returned ticket can be used to wait for or to poll the execution.
+         *
+         * @tparam F         The function type
+         * @param function   The function itself
+         * @param queue_type The type of the queue, to which the command buffer is submitted
+         * @return           The ticket of the command buffer or an error
+         *
+         * @author           Cedric Hammes
+         * @since            16/10/2026
+         */
+        template<typename F>
+        [[nodiscard]] auto emit_command_buffer_async(F&& function, QueueType queue_type = GRAPHICS) const noexcept
+                -> kstd::Result<SubmitTicket> {
+            return get_command_submitter(queue_type).record(std::forward<F>(function));
+        }
+
         /**
          * This function creates a one-time command buffer and executes the specified function. After the run, the
          * command buffer get submitted into the queue and the program waits for the execution.
          *
-         * @tparam F       The function type
-         * @param function The function itself
-         * @return         Nothing or an error
+         * @tparam F         The function type
+         * @param function   The function itself
+         * @param queue_type The type of the queue, to which the command buffer is submitted
+         * @return           Nothing or an error
          *
-         * @author         Cedric Hammes
-         * @since          06/02/2024
+         * @author           Cedric Hammes
+         * @since            06/02/2024
          */
         template<typename F>
-        [[maybe_unused]] [[nodiscard]] auto emit_command_buffer(F&& function) const noexcept -> kstd::Result<void>;
+        [[maybe_unused]] [[nodiscard]] auto emit_command_buffer(F&& function,
+                                                                QueueType queue_type = GRAPHICS) const noexcept
+                -> kstd::Result<void> {
+            const auto ticket = emit_command_buffer_async(std::forward<F>(function), queue_type);
+            if(ticket.is_error()) {
+                return kstd::Error {ticket.get_error()};
+            }
+            return ticket->wait();
+        }
+
+        /**
+         * This function records the enqueued uploads of the staging ring and submits the pending command buffers of
+         * all queues with a single submit per queue. The renderer calls this function once per frame and waits for
+         * the returned tickets in the submit of the frame, so the frame is ordered after the uploads.
+         *
+         * @return The tickets of the last batch of every queue or an error
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto flush_command_buffers() const noexcept -> kstd::Result<std::vector<SubmitTicket>>;
+        [[nodiscard]] auto get_command_submitter(QueueType queue_type) const noexcept -> CommandSubmitter&;
         [[nodiscard]] auto get_physical_device() const noexcept -> VkPhysicalDevice;
         [[nodiscard]] auto get_virtual_device() const noexcept -> VkDevice;
-        [[nodiscard]] auto get_graphics_queue() const noexcept -> VkQueue;
+        [[nodiscard]] auto get_properties() const noexcept -> const VkPhysicalDeviceProperties&;
+
+        /**
+         * This function returns whether the device supports the descriptor indexing features, which are needed by
+         * the bindless descriptor heap. The features are enabled on creation, if they're supported.
+         *
+         * @return Whether descriptor indexing is supported and enabled
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto supports_descriptor_indexing() const noexcept -> bool;
+
+        /**
+         * This function returns the queue for the specified type of work. If the device doesn't provide a dedicated
+         * queue family for the type, the queue is shared with another type.
+         *
+         * @param queue_type The type of work
+         * @return           The queue for the type
+         *
+         * @author           Cedric Hammes
+         * @since            16/10/2026
+         */
+        [[nodiscard]] auto get_queue(QueueType queue_type) const noexcept -> const Queue&;
+        [[nodiscard]] auto get_graphics_queue() const noexcept -> const Queue&;
+        [[nodiscard]] auto get_compute_queue() const noexcept -> const Queue&;
+        [[nodiscard]] auto get_transfer_queue() const noexcept -> const Queue&;
+
+        /**
+         * This function returns the memory allocator of the device, which sub-allocates the memory of buffers and
+         * images out of large blocks.
+         *
+         * @return The memory allocator of the device
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_memory_allocator() const noexcept -> MemoryAllocator&;
+
+        /**
+         * This function returns the staging ring of the device, which streams uploads over the transfer queue. The
+         * enqueued copies are submitted with the next flush of the command buffers.
+         *
+         * @return The staging ring of the device
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_staging_ring() const noexcept -> StagingRing&;
 
         /**
          * This function returns the name of the device by the device properties.
@@ -113,6 +218,7 @@ namespace aetherium::renderer::vulkan {
     class CommandBuffer final {
         const CommandPool* _command_pool;
         VkCommandBuffer _command_buffer;
+        bool _is_borrowed;
 
         public:
         /**
@@ -124,15 +230,17 @@ namespace aetherium::renderer::vulkan {
         CommandBuffer() noexcept;
 
         /**
-         * This constructor creates a command buffer with the specified command buffer and the command pool.
+         * This constructor creates a command buffer with the specified command buffer and the command pool. Borrowed
+         * command buffers are owned by the pool and are not freed by the destructor.
          *
          * @param command_pool   The command pool with which the buffer was allocated
          * @param command_buffer The command buffer itself
+         * @param is_borrowed    Whether the command buffer is owned by the pool
          *
          * @author               Cedric Hammes
          * @since                06/02/2024
          */
-        CommandBuffer(const CommandPool* command_pool, VkCommandBuffer command_buffer);
+        CommandBuffer(const CommandPool* command_pool, VkCommandBuffer command_buffer, bool is_borrowed = false);
         ~CommandBuffer() noexcept;
         CommandBuffer(CommandBuffer&& other) noexcept;
         KSTD_NO_COPY(CommandBuffer, CommandBuffer);
@@ -154,6 +262,9 @@ namespace aetherium::renderer::vulkan {
     class CommandPool final {
         const VulkanDevice* _vulkan_device;
         VkCommandPool _command_pool;
+        uint32_t _queue_family_index;
+        std::vector<VkCommandBuffer> _recycled_command_buffers {};
+        size_t _used_command_buffers;
 
         public:
         friend class VulkanRenderer;
@@ -168,14 +279,18 @@ namespace aetherium::renderer::vulkan {
         CommandPool() noexcept;
 
         /**
-         * This constructor creates a command pool by the specified device
+         * This constructor creates a command pool by the specified device for the queue family of the specified queue
+         * type.
          *
          * @param vulkan_device The device for the pool
+         * @param queue_type    The type of the queue, to which the command buffers are submitted
+         * @param flags         The flags, with which the pool is created
          *
          * @author              Cedric Hammes
          * @since               06/02/2024
          */
-        explicit CommandPool(const VulkanDevice* vulkan_device);
+        explicit CommandPool(const VulkanDevice* vulkan_device, QueueType queue_type = GRAPHICS,
+                             VkCommandPoolCreateFlags flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
         ~CommandPool() noexcept;
         CommandPool(CommandPool&& other) noexcept;
         KSTD_NO_COPY(CommandPool, CommandPool);
@@ -192,6 +307,32 @@ namespace aetherium::renderer::vulkan {
         [[nodiscard]] auto allocate_command_buffers(uint32_t count) const noexcept
                 -> kstd::Result<std::vector<CommandBuffer>>;
 
+        /**
+         * This function returns a borrowed command buffer from the free list of the pool. A new command buffer is only
+         * allocated when all recycled command buffers are in use since the last reset. Borrowed command buffers stay
+         * owned by the pool and are returned to the free list by the next reset.
+         *
+         * @return The borrowed command buffer or an error
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto acquire_command_buffer() noexcept -> kstd::Result<CommandBuffer>;
+
+        /**
+         * This function resets all command buffers of the pool at once and returns the borrowed command buffers to the
+         * free list. The memory of the pool is kept, so the recording of the next frame doesn't hit the driver
+         * allocator. The GPU must be done with all command buffers of the pool.
+         *
+         * @return Success or error
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto reset() noexcept -> kstd::Result<void>;
+
+        [[nodiscard]] auto get_queue_family_index() const noexcept -> uint32_t;
+
         auto operator=(CommandPool&& other) noexcept -> CommandPool&;
         auto operator*() const noexcept -> VkCommandPool;
     };
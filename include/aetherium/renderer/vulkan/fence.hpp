@@ -32,12 +32,13 @@ namespace aetherium::renderer::vulkan {
          * This constructor creates the fence by the specified device. This fence is used to wait on the CPU-site for
          * operations on the GPU.
          *
-         * @param device The device on which the fence is to be created
+         * @param device   The device on which the fence is to be created
+         * @param signaled Whether the fence is created in the signaled state
          *
-         * @author       Cedric Hammes
-         * @since        09/02/2024
+         * @author         Cedric Hammes
+         * @since          09/02/2024
          */
-        explicit VulkanFence(const VulkanDevice* device);
+        explicit VulkanFence(const VulkanDevice* device, bool signaled = false);
         ~VulkanFence() noexcept;
         VulkanFence(VulkanFence&& other) noexcept;
         KSTD_NO_COPY(VulkanFence, VulkanFence);
@@ -55,6 +56,16 @@ namespace aetherium::renderer::vulkan {
         [[nodiscard]] auto wait_for(uint64_t timeout = std::numeric_limits<uint64_t>::max()) const noexcept
                 -> kstd::Result<void>;
 
+        /**
+         * This function resets the fence into the unsignaled state, so it can be reused for the next submit.
+         *
+         * @return Success or error
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto reset() const noexcept -> kstd::Result<void>;
+
         auto operator=(VulkanFence&& other) noexcept -> VulkanFence&;
         auto operator*() const noexcept -> VkFence;
     };
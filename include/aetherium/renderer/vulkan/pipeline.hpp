@@ -0,0 +1,323 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+#include "aetherium/renderer/vulkan/device.hpp"
+#include "aetherium/renderer/vulkan/pipeline_cache.hpp"
+#include <future>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <mutex>
+#include <parallel_hashmap/phmap.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace aetherium::renderer::vulkan {
+    /**
+     * This struct describes a single shader stage of a pipeline. The module id identifies the shader module
+     * independently of its handle, because the handle of a destroyed module can be reused by the module of a reloaded
+     * shader.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct ShaderStage {
+        VkShaderStageFlagBits stage;
+        VkShaderModule module;
+        uint64_t module_id;
+        std::string entry_point;
+    };
+
+    /**
+     * This struct contains the complete state of a graphics pipeline. Two pipelines with the same state are
+     * interchangeable, so the state is used as key to share pipelines. Viewport and scissor are always dynamic.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct GraphicsPipelineState {
+        std::vector<ShaderStage> shader_stages {};
+        std::vector<VkVertexInputBindingDescription> vertex_bindings {};
+        std::vector<VkVertexInputAttributeDescription> vertex_attributes {};
+        VkPrimitiveTopology topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        VkPolygonMode polygon_mode = VK_POLYGON_MODE_FILL;
+        VkCullModeFlags cull_mode = VK_CULL_MODE_NONE;
+        VkFrontFace front_face = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+        VkSampleCountFlagBits sample_count = VK_SAMPLE_COUNT_1_BIT;
+        bool depth_test = false;
+        bool depth_write = false;
+        VkCompareOp depth_compare_op = VK_COMPARE_OP_LESS_OR_EQUAL;
+        std::vector<VkFormat> color_formats {};
+        std::vector<VkPipelineColorBlendAttachmentState> color_blend_attachments {};
+        VkFormat depth_format = VK_FORMAT_UNDEFINED;
+        VkFormat stencil_format = VK_FORMAT_UNDEFINED;
+        VkPipelineLayout layout = VK_NULL_HANDLE;
+        std::vector<VkDynamicState> dynamic_states {VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR};
+
+        /**
+         * This function hashes the complete state into a single key.
+         *
+         * @return The hash of the state
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_hash() const noexcept -> uint64_t;
+
+        auto operator==(const GraphicsPipelineState& other) const noexcept -> bool;
+    };
+
+    /**
+     * This class builds the state of a graphics pipeline for dynamic rendering, so the pipeline is created with the
+     * formats of the attachments instead of a render pass.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class GraphicsPipelineBuilder final {
+        GraphicsPipelineState _state {};
+
+        public:
+        GraphicsPipelineBuilder() noexcept = default;
+        ~GraphicsPipelineBuilder() noexcept = default;
+        KSTD_DEFAULT_MOVE_COPY(GraphicsPipelineBuilder, GraphicsPipelineBuilder);
+
+        /**
+         * This function adds a shader stage with the specified shader module to the pipeline.
+         *
+         * @param stage       The stage of the shader
+         * @param module      The shader module
+         * @param entry_point The name of the entry point function
+         * @return            The builder itself
+         *
+         * @author            Cedric Hammes
+         * @since             16/10/2026
+         */
+        auto with_shader_stage(VkShaderStageFlagBits stage, VkShaderModule module,
+                               std::string entry_point = "main") noexcept -> GraphicsPipelineBuilder&;
+
+        /**
+         * This function adds a shader stage with the specified shader module to the pipeline. The module id is part
+         * of the pipeline key, so the pipelines of a reloaded shader are never shared with the old module.
+         *
+         * @param stage       The stage of the shader
+         * @param module      The shader module
+         * @param module_id   The unique id of the shader module
+         * @param entry_point The name of the entry point function
+         * @return            The builder itself
+         *
+         * @author            Cedric Hammes
+         * @since             16/10/2026
+         */
+        auto with_shader_stage(VkShaderStageFlagBits stage, VkShaderModule module, uint64_t module_id,
+                               std::string entry_point = "main") noexcept -> GraphicsPipelineBuilder&;
+
+        /**
+         * This function adds a vertex buffer binding to the pipeline.
+         *
+         * @param binding    The index of the binding
+         * @param stride     The distance between two elements in the buffer
+         * @param input_rate Whether the binding is advanced per vertex or per instance
+         * @return           The builder itself
+         *
+         * @author           Cedric Hammes
+         * @since            16/10/2026
+         */
+        auto with_vertex_binding(uint32_t binding, uint32_t stride,
+                                 VkVertexInputRate input_rate = VK_VERTEX_INPUT_RATE_VERTEX) noexcept
+                -> GraphicsPipelineBuilder&;
+
+        /**
+         * This function adds a vertex attribute, which is read from a vertex buffer binding, to the pipeline.
+         *
+         * @param location The location of the attribute in the vertex shader
+         * @param binding  The index of the binding
+         * @param format   The format of the attribute
+         * @param offset   The offset of the attribute in the element
+         * @return         The builder itself
+         *
+         * @author         Cedric Hammes
+         * @since          16/10/2026
+         */
+        auto with_vertex_attribute(uint32_t location, uint32_t binding, VkFormat format, uint32_t offset) noexcept
+                -> GraphicsPipelineBuilder&;
+
+        auto with_topology(VkPrimitiveTopology topology) noexcept -> GraphicsPipelineBuilder&;
+        auto with_polygon_mode(VkPolygonMode polygon_mode) noexcept -> GraphicsPipelineBuilder&;
+        auto with_cull_mode(VkCullModeFlags cull_mode, VkFrontFace front_face) noexcept -> GraphicsPipelineBuilder&;
+        auto with_sample_count(VkSampleCountFlagBits sample_count) noexcept -> GraphicsPipelineBuilder&;
+
+        /**
+         * This function enables the depth test with the specified compare operation.
+         *
+         * @param depth_write      Whether the depth of passed fragments is written
+         * @param depth_compare_op The operation, with which the depth is compared
+         * @return                 The builder itself
+         *
+         * @author                 Cedric Hammes
+         * @since                  16/10/2026
+         */
+        auto with_depth_test(bool depth_write, VkCompareOp depth_compare_op = VK_COMPARE_OP_LESS_OR_EQUAL) noexcept
+                -> GraphicsPipelineBuilder&;
+
+        /**
+         * This function adds a color attachment with the specified format and blending to the pipeline. Without
+         * blending, all color components are written as they are.
+         *
+         * @param format      The format of the color attachment
+         * @param blend_state The blending of the color attachment
+         * @return            The builder itself
+         *
+         * @author            Cedric Hammes
+         * @since             16/10/2026
+         */
+        auto with_color_attachment(VkFormat format, const VkPipelineColorBlendAttachmentState& blend_state) noexcept
+                -> GraphicsPipelineBuilder&;
+        auto with_color_attachment(VkFormat format) noexcept -> GraphicsPipelineBuilder&;
+        auto with_depth_attachment(VkFormat format) noexcept -> GraphicsPipelineBuilder&;
+        auto with_stencil_attachment(VkFormat format) noexcept -> GraphicsPipelineBuilder&;
+        auto with_dynamic_state(VkDynamicState dynamic_state) noexcept -> GraphicsPipelineBuilder&;
+        auto with_layout(VkPipelineLayout layout) noexcept -> GraphicsPipelineBuilder&;
+
+        /**
+         * This function creates the pipeline by the state of the builder. The pipeline isn't shared, so the caller is
+         * responsible for the destruction. Pipelines should be created by the pipeline manager instead.
+         *
+         * @param virtual_device The device, on which the pipeline is created
+         * @param pipeline_cache The pipeline cache, which is used for the creation
+         * @return               The pipeline or an error
+         *
+         * @author               Cedric Hammes
+         * @since                16/10/2026
+         */
+        [[nodiscard]] auto build(VkDevice virtual_device, VkPipelineCache pipeline_cache) const noexcept
+                -> kstd::Result<VkPipeline>;
+        [[nodiscard]] auto get_state() const noexcept -> const GraphicsPipelineState&;
+    };
+
+    /**
+     * This class owns all graphics pipelines of the renderer. The pipelines are keyed by their complete state, so
+     * identical requests share one pipeline and the lookup of an existing pipeline costs a single hash probe. The
+     * state is hashed once per request and the hash is stored in the key, so neither the probe nor the rehash of the
+     * map hashes the vectors of the state again. A pipeline is only created once, even if it's requested by multiple
+     * threads at the same time.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class PipelineManager final {
+        struct PipelineKeyView {
+            uint64_t hash;
+            const GraphicsPipelineState* state;
+        };
+
+        struct PipelineKey {
+            uint64_t hash;
+            GraphicsPipelineState state;
+
+            [[nodiscard]] inline auto view() const noexcept -> PipelineKeyView {
+                return {hash, &state};
+            }
+        };
+
+        struct PipelineKeyHash {
+            using is_transparent = void;
+
+            [[nodiscard]] auto operator()(const PipelineKeyView& key) const noexcept -> size_t {
+                return static_cast<size_t>(key.hash);
+            }
+
+            [[nodiscard]] auto operator()(const PipelineKey& key) const noexcept -> size_t {
+                return static_cast<size_t>(key.hash);
+            }
+        };
+
+        struct PipelineKeyEqual {
+            using is_transparent = void;
+
+            [[nodiscard]] static auto equals(const PipelineKeyView& left, const PipelineKeyView& right) noexcept
+                    -> bool {
+                return left.hash == right.hash && *left.state == *right.state;
+            }
+
+            template<typename LEFT, typename RIGHT>
+            [[nodiscard]] auto operator()(const LEFT& left, const RIGHT& right) const noexcept -> bool {
+                return equals(to_view(left), to_view(right));
+            }
+
+            private:
+            [[nodiscard]] static auto to_view(const PipelineKeyView& key) noexcept -> PipelineKeyView {
+                return key;
+            }
+
+            [[nodiscard]] static auto to_view(const PipelineKey& key) noexcept -> PipelineKeyView {
+                return key.view();
+            }
+        };
+
+        VkDevice _virtual_device;
+        PipelineCache* _pipeline_cache;
+        std::mutex _mutex;
+        phmap::flat_hash_map<PipelineKey, std::shared_future<VkPipeline>, PipelineKeyHash, PipelineKeyEqual>
+                _pipelines {};
+
+        auto reserve(const PipelineKeyView& key, std::promise<VkPipeline>& promise) noexcept
+                -> std::pair<std::shared_future<VkPipeline>, bool>;
+        auto complete(const PipelineKeyView& key, std::promise<VkPipeline>& promise,
+                      const kstd::Result<VkPipeline>& result) noexcept -> void;
+
+        public:
+        /**
+         * This constructor creates the pipeline manager, which creates the pipelines with the specified cache.
+         *
+         * @param vulkan_device  The device, on which the pipelines are created
+         * @param pipeline_cache The pipeline cache, which is used for all creations
+         *
+         * @author               Cedric Hammes
+         * @since                16/10/2026
+         */
+        PipelineManager(const VulkanDevice* vulkan_device, PipelineCache* pipeline_cache) noexcept;
+        ~PipelineManager() noexcept;
+        KSTD_NO_MOVE_COPY(PipelineManager, PipelineManager);
+
+        /**
+         * This function returns the pipeline with the state of the specified builder. If the pipeline doesn't exist,
+         * it is created on the calling thread. If the pipeline is created by another thread, the function waits for
+         * the creation.
+         *
+         * @param builder The builder with the state of the pipeline
+         * @return        The pipeline or an error
+         *
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] auto get_or_create(const GraphicsPipelineBuilder& builder) noexcept -> kstd::Result<VkPipeline>;
+
+        /**
+         * This function creates the pipeline with the state of the specified builder on the compile threads of the
+         * pipeline cache, if it doesn't exist yet. This should be used while loading, so the pipeline already exists
+         * when it's requested by the first frame.
+         *
+         * @param builder The builder with the state of the pipeline
+         *
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        auto precompile(const GraphicsPipelineBuilder& builder) noexcept -> void;
+
+        [[nodiscard]] auto get_pipeline_count() noexcept -> size_t;
+    };
+}// namespace aetherium::renderer::vulkan
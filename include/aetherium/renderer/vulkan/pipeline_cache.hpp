@@ -0,0 +1,94 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+#include "aetherium/renderer/vulkan/device.hpp"
+#include "aetherium/thread_pool.hpp"
+#include <filesystem>
+#include <future>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace aetherium::renderer::vulkan {
+    /**
+     * This class is a wrapper around the Vulkan pipeline cache. The cache is loaded from the cache file while the
+     * creation and written back into the file while the destruction. The data of the file is only used, if the header
+     * of the cache matches the vendor, the device and the pipeline cache UUID of the device, otherwise the driver
+     * would reject or misuse it after a driver update. The cache also owns a pool of compile threads, so pipelines can
+     * be created in the background while loading instead of stalling the first frame, in which they're used.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class PipelineCache final {
+        VkDevice _virtual_device;
+        VkPipelineCache _pipeline_cache;
+        std::filesystem::path _cache_path;
+        std::unique_ptr<ThreadPool> _compile_pool;
+
+        public:
+        /**
+         * This constructor creates the pipeline cache and fills it with the data of the cache file, if the file
+         * exists and was written by the same device and driver. If the cache path is empty, the cache isn't persisted.
+         *
+         * @param vulkan_device The device, on which the cache is created
+         * @param cache_path    The path of the cache file
+         * @param thread_count  The count of compile threads or zero for one thread per hardware thread
+         *
+         * @author              Cedric Hammes
+         * @since               16/10/2026
+         */
+        PipelineCache(const VulkanDevice* vulkan_device, std::filesystem::path cache_path, uint32_t thread_count = 2);
+        ~PipelineCache() noexcept;
+        KSTD_NO_MOVE_COPY(PipelineCache, PipelineCache);
+
+        /**
+         * This function runs the specified pipeline creation on one of the compile threads. The function gets the
+         * Vulkan pipeline cache, which is internally synchronized, so any count of pipelines can be created at once.
+         *
+         * @tparam F       The function type
+         * @param function The function, which creates the pipeline with the pipeline cache
+         * @return         The future of the result of the function
+         *
+         * @author         Cedric Hammes
+         * @since          16/10/2026
+         */
+        template<typename F>
+        [[nodiscard]] auto compile_async(F&& function) noexcept
+                -> std::future<std::invoke_result_t<std::decay_t<F>&, VkPipelineCache>> {
+            auto task = [pipeline_cache = _pipeline_cache, function = std::forward<F>(function)]() mutable {
+                return function(pipeline_cache);
+            };
+            return _compile_pool->submit(std::move(task));
+        }
+
+        /**
+         * This function writes the data of the pipeline cache into the cache file. The file is replaced atomically,
+         * so a crash while writing never leaves a broken cache behind.
+         *
+         * @return Success or error
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto save() const noexcept -> kstd::Result<void>;
+        [[nodiscard]] auto get_cache_path() const noexcept -> const std::filesystem::path&;
+
+        auto operator*() const noexcept -> VkPipelineCache;
+    };
+}// namespace aetherium::renderer::vulkan
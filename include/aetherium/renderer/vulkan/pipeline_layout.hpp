@@ -0,0 +1,99 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+#include "aetherium/renderer/vulkan/device.hpp"
+#include "aetherium/renderer/vulkan/reflection.hpp"
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <mutex>
+#include <parallel_hashmap/phmap.h>
+#include <string>
+#include <vector>
+
+namespace aetherium::renderer::vulkan {
+    /**
+     * This struct describes a pipeline layout with the layouts of its descriptor sets and its push constant ranges.
+     * All handles are owned by the pipeline layout cache.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct PipelineLayout {
+        VkPipelineLayout layout;
+        std::vector<VkDescriptorSetLayout> descriptor_set_layouts;
+        std::vector<VkPushConstantRange> push_constant_ranges;
+    };
+
+    /**
+     * This class creates the descriptor set layouts and pipeline layouts by the reflected interface of the shaders
+     * instead of hand-written layouts. Both are deduplicated by their content, so pipelines with compatible layouts
+     * share the same handles and can use the same descriptor sets without rebinding. The stages of bindings, which
+     * are used by any graphics stage, are widened to all graphics stages, so pipelines using a set from different
+     * stages still get the same descriptor set layout.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class PipelineLayoutCache final {
+        VkDevice _virtual_device;
+        std::mutex _mutex;
+        phmap::flat_hash_map<std::string, VkDescriptorSetLayout> _descriptor_set_layouts {};
+        phmap::flat_hash_map<std::string, PipelineLayout> _pipeline_layouts {};
+
+        auto get_or_create_set_layout(const std::vector<DescriptorBinding>& bindings) noexcept
+                -> kstd::Result<VkDescriptorSetLayout>;
+
+        public:
+        /**
+         * This constructor creates the empty layout cache for the specified device.
+         *
+         * @param vulkan_device The device, on which the layouts are created
+         *
+         * @author              Cedric Hammes
+         * @since               16/10/2026
+         */
+        explicit PipelineLayoutCache(const VulkanDevice* vulkan_device) noexcept;
+        ~PipelineLayoutCache() noexcept;
+        KSTD_NO_MOVE_COPY(PipelineLayoutCache, PipelineLayoutCache);
+
+        /**
+         * This function returns the descriptor set layout with the specified bindings and creates it, if it doesn't
+         * exist yet. The set numbers of the bindings are ignored.
+         *
+         * @param bindings The bindings of the descriptor set
+         * @return         The descriptor set layout or an error
+         *
+         * @author         Cedric Hammes
+         * @since          16/10/2026
+         */
+        [[nodiscard]] auto get_or_create_descriptor_set_layout(const std::vector<DescriptorBinding>& bindings) noexcept
+                -> kstd::Result<VkDescriptorSetLayout>;
+
+        /**
+         * This function merges the reflections of the stages of a pipeline and returns the pipeline layout for the
+         * merged interface. The layout and the descriptor set layouts are only created, if they don't exist yet.
+         *
+         * @param reflections The reflections of all stages of the pipeline
+         * @return            The pipeline layout or an error
+         *
+         * @author            Cedric Hammes
+         * @since             16/10/2026
+         */
+        [[nodiscard]] auto
+        get_or_create_pipeline_layout(const std::vector<const ShaderReflection*>& reflections) noexcept
+                -> kstd::Result<PipelineLayout>;
+    };
+}// namespace aetherium::renderer::vulkan
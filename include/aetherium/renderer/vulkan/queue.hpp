@@ -0,0 +1,109 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include "aetherium/utils.hpp"
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <mutex>
+
+namespace aetherium::renderer::vulkan {
+    /**
+     * This enum identifies the type of work, which should be performed on a queue. The device tries to find a
+     * dedicated queue family for every type and falls back to a shared family if no dedicated family exists.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    enum QueueType {
+        /**
+         * The queue for graphics, compute and transfer work. This queue is also used to present the swapchain.
+         */
+        GRAPHICS,
+        /**
+         * The queue for async-compute work
+         */
+        COMPUTE,
+        /**
+         * The queue for transfer work like asset uploads
+         */
+        TRANSFER
+    };
+
+    /**
+     * This class is a wrapper around a device queue. Multiple queue types can share one queue if the device doesn't
+     * provide a dedicated queue family, so all submits to the queue are externally synchronized by the wrapper.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class Queue final {
+        VkQueue _queue_handle;
+        uint32_t _family_index;
+        mutable std::mutex _mutex;
+
+        public:
+        /**
+         * This constructor creates the queue wrapper by the specified queue handle and the index of the family.
+         *
+         * @param queue_handle The handle to the queue
+         * @param family_index The index of the queue family of the queue
+         *
+         * @author             Cedric Hammes
+         * @since              16/10/2026
+         */
+        Queue(VkQueue queue_handle, uint32_t family_index) noexcept;
+        ~Queue() noexcept = default;
+        KSTD_NO_MOVE_COPY(Queue, Queue);
+
+        /**
+         * This function submits the specified submit infos into the queue and signals the fence after the execution.
+         *
+         * @param submit_infos The submit infos
+         * @param count        The count of submit infos
+         * @param fence        The fence, which gets signaled or a null handle
+         * @return             Success or error
+         *
+         * @author             Cedric Hammes
+         * @since              16/10/2026
+         */
+        [[nodiscard]] auto submit(const VkSubmitInfo* submit_infos, uint32_t count,
+                                  VkFence fence = VK_NULL_HANDLE) const noexcept -> kstd::Result<void>;
+
+        /**
+         * This function presents the swapchain images specified in the present info. An out of date or suboptimal
+         * swapchain isn't an error, the result is returned, so the swapchain can be recreated.
+         *
+         * @param present_info The present info
+         * @return             The result of the present or an error
+         *
+         * @author             Cedric Hammes
+         * @since              16/10/2026
+         */
+        [[nodiscard]] auto present(const VkPresentInfoKHR& present_info) const noexcept -> kstd::Result<VkResult>;
+
+        /**
+         * This function waits until all submitted work of the queue is done.
+         *
+         * @return Success or error
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto wait_idle() const noexcept -> kstd::Result<void>;
+
+        [[nodiscard]] auto get_family_index() const noexcept -> uint32_t;
+        auto operator*() const noexcept -> VkQueue;
+    };
+}// namespace aetherium::renderer::vulkan
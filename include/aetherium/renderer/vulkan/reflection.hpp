@@ -0,0 +1,88 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+#include "aetherium/utils.hpp"
+#include <kstd/result.hpp>
+#include <vector>
+
+namespace aetherium::renderer::vulkan {
+    /**
+     * This struct describes a descriptor binding, which is used by a shader. A descriptor count of zero marks a
+     * runtime-sized array.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct DescriptorBinding {
+        uint32_t set;
+        uint32_t binding;
+        VkDescriptorType descriptor_type;
+        uint32_t descriptor_count;
+        VkShaderStageFlags stage_flags;
+    };
+
+    /**
+     * This struct describes an input variable of a vertex shader.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct VertexInput {
+        uint32_t location;
+        VkFormat format;
+    };
+
+    /**
+     * This struct contains the interface of a shader, which is reflected from the SPIR-V of the shader. The bindings
+     * are sorted by set and binding.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct ShaderReflection {
+        VkShaderStageFlagBits stage = VK_SHADER_STAGE_ALL;
+        std::vector<DescriptorBinding> descriptor_bindings {};
+        std::vector<VkPushConstantRange> push_constant_ranges {};
+        std::vector<VertexInput> vertex_inputs {};
+    };
+
+    /**
+     * This function parses the specified SPIR-V and reflects the stage, the descriptor bindings, the push constant
+     * ranges and the vertex inputs of the shader.
+     *
+     * @param spirv The SPIR-V words of the shader
+     * @return      The reflection of the shader or an error
+     *
+     * @author      Cedric Hammes
+     * @since       16/10/2026
+     */
+    [[nodiscard]] auto reflect_spirv(const std::vector<uint32_t>& spirv) noexcept -> kstd::Result<ShaderReflection>;
+
+    /**
+     * This function merges the reflections of all stages of a pipeline into a single interface. Bindings, which are
+     * used by multiple stages, are merged into one binding with the flags of all stages. The push constant ranges are
+     * kept per stage, so the pipeline layout matches the ranges, which are declared by the stages, instead of widening
+     * a single range to all stages.
+     *
+     * @param reflections The reflections of the stages
+     * @return            The merged reflection or an error, if the stages declare a binding with different types
+     *
+     * @author            Cedric Hammes
+     * @since             16/10/2026
+     */
+    [[nodiscard]] auto merge_reflections(const std::vector<const ShaderReflection*>& reflections) noexcept
+            -> kstd::Result<ShaderReflection>;
+}// namespace aetherium::renderer::vulkan
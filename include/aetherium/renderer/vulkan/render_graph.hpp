@@ -0,0 +1,330 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+#include "aetherium/renderer/vulkan/allocator.hpp"
+#include "aetherium/renderer/vulkan/barrier.hpp"
+#include "aetherium/renderer/vulkan/device.hpp"
+#include <functional>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace aetherium::renderer::vulkan {
+    class RenderGraph;
+
+    /**
+     * This type identifies an image in a render graph. The identifier is only valid until the graph is reset.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    using RenderGraphResource = uint32_t;
+
+    /**
+     * This enum describes how a pass uses an image. The usage determines the layout of the image in the pass and the
+     * stages and accesses, which are synchronized with the other passes.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    enum RenderGraphUsage {
+        COLOR_ATTACHMENT,
+        DEPTH_STENCIL_ATTACHMENT,
+        DEPTH_STENCIL_READ,
+        SHADER_READ,
+        STORAGE_READ,
+        STORAGE_WRITE,
+        TRANSFER_SOURCE,
+        TRANSFER_DESTINATION
+    };
+
+    /**
+     * This enum describes on which kind of work a pass records. The type determines the shader stages of shader
+     * reads and storage accesses.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    enum RenderGraphPassType {
+        GRAPHICS_PASS,
+        COMPUTE_PASS,
+        TRANSFER_PASS
+    };
+
+    /**
+     * This struct describes a transient image, which is created by the render graph and only lives for the frame.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct RenderGraphImageInfo {
+        VkFormat format;
+        VkExtent2D extent;
+    };
+
+    /**
+     * This struct describes an image, which is owned outside of the render graph, like the swapchain image. The
+     * initial layout and stage describe the state before the graph and the image is transitioned into the final
+     * layout after the last pass.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct RenderGraphImportInfo {
+        VkImage image;
+        VkImageView image_view;
+        VkFormat format;
+        VkExtent2D extent;
+        VkImageLayout initial_layout;
+        VkPipelineStageFlags2 initial_stage;
+        VkImageLayout final_layout;
+    };
+
+    /**
+     * This struct contains the statistics of the last compilation of a render graph.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct RenderGraphStatistics {
+        uint32_t pass_count;
+        uint32_t culled_pass_count;
+        uint32_t barrier_count;
+        uint32_t transient_image_count;
+        VkDeviceSize transient_memory_size;
+        VkDeviceSize aliased_memory_size;
+    };
+
+    using RenderGraphExecuteFunction = std::function<void(VkCommandBuffer, const RenderGraph&)>;
+
+    /**
+     * This class describes a pass of the render graph with its reads and writes. The pass is culled, if none of its
+     * writes is read by another pass or leaves the graph through an imported image.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class RenderGraphPass final {
+        struct Access {
+            RenderGraphResource resource;
+            RenderGraphUsage usage;
+            bool is_write;
+        };
+
+        std::string _name;
+        RenderGraphPassType _type;
+        std::vector<Access> _accesses {};
+        RenderGraphExecuteFunction _execute_function {};
+        bool _has_side_effects;
+
+        public:
+        friend class RenderGraph;
+
+        /**
+         * This constructor creates the pass without any reads or writes.
+         *
+         * @param name The name of the pass
+         * @param type The type of the pass
+         *
+         * @author     Cedric Hammes
+         * @since      16/10/2026
+         */
+        RenderGraphPass(std::string name, RenderGraphPassType type) noexcept;
+        ~RenderGraphPass() noexcept = default;
+        KSTD_NO_MOVE_COPY(RenderGraphPass, RenderGraphPass);
+
+        auto read(RenderGraphResource resource, RenderGraphUsage usage) noexcept -> RenderGraphPass&;
+        auto write(RenderGraphResource resource, RenderGraphUsage usage) noexcept -> RenderGraphPass&;
+
+        /**
+         * This function sets the function, which records the commands of the pass. The barriers of the pass are
+         * recorded before the function is called.
+         *
+         * @param execute_function The function, which records the pass
+         * @return                 The pass itself
+         *
+         * @author                 Cedric Hammes
+         * @since                  16/10/2026
+         */
+        auto set_execute_function(RenderGraphExecuteFunction execute_function) noexcept -> RenderGraphPass&;
+
+        /**
+         * This function marks the pass as pass with side effects outside of the graph, like writes into a buffer,
+         * which is read by the CPU. Passes with side effects are never culled.
+         *
+         * @return The pass itself
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        auto set_side_effects() noexcept -> RenderGraphPass&;
+        [[nodiscard]] auto get_name() const noexcept -> const std::string&;
+    };
+
+    /**
+     * This class is a render graph for a single frame. The passes declare which images they read and write, and the
+     * graph culls all passes, which don't contribute to the output, generates the layout transitions and barriers
+     * between the passes with synchronization2 and places transient images with disjoint lifetimes into the same
+     * memory. The graph is reset and rebuilt every frame, but the transient images are kept as long as the
+     * transient images and their lifetimes don't change.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class RenderGraph final {
+        struct ImageResource {
+            std::string name;
+            VkImage image;
+            VkImageView image_view;
+            VkFormat format;
+            VkExtent2D extent;
+            VkImageUsageFlags usage;
+            bool is_imported;
+            VkImageLayout initial_layout;
+            VkPipelineStageFlags2 initial_stage;
+            VkImageLayout final_layout;
+            uint32_t first_pass;
+            uint32_t last_pass;
+            uint32_t memory_slot;
+        };
+
+        struct TransientImage {
+            VkImage image;
+            VkImageView image_view;
+        };
+
+        struct MemorySlot {
+            Allocation allocation;
+            VkMemoryRequirements requirements;
+            std::vector<uint32_t> resources;
+        };
+
+        const VulkanDevice* _vulkan_device;
+        std::vector<ImageResource> _resources {};
+        std::vector<std::unique_ptr<RenderGraphPass>> _passes {};
+        std::vector<uint32_t> _compiled_passes {};
+        std::vector<BarrierBatch> _pass_barriers {};
+        BarrierBatch _final_barriers {};
+        std::string _transient_key {};
+        std::vector<TransientImage> _transient_images {};
+        std::vector<uint32_t> _transient_slots {};
+        std::vector<MemorySlot> _memory_slots {};
+        RenderGraphStatistics _statistics {};
+        bool _is_compiled;
+
+        auto cull_passes() noexcept -> void;
+        [[nodiscard]] auto create_transient_images() noexcept -> kstd::Result<void>;
+        [[nodiscard]] auto bind_transient_images(const std::vector<uint32_t>& transient_resources) noexcept
+                -> kstd::Result<void>;
+        auto build_barriers() noexcept -> void;
+        auto destroy_transient_images() noexcept -> void;
+
+        public:
+        /**
+         * This constructor creates the empty render graph. A graph without a device only plans the passes, the
+         * placement of the transient images and the barriers, so the transient images have no Vulkan objects.
+         *
+         * @param vulkan_device The device, on which the transient images are created, or nullptr
+         *
+         * @author              Cedric Hammes
+         * @since               16/10/2026
+         */
+        explicit RenderGraph(const VulkanDevice* vulkan_device) noexcept;
+        ~RenderGraph() noexcept;
+        KSTD_NO_MOVE_COPY(RenderGraph, RenderGraph);
+
+        /**
+         * This function declares a transient image, which is created by the graph. The usage flags of the image are
+         * derived from the passes, which use the image.
+         *
+         * @param name       The name of the image
+         * @param image_info The format and extent of the image
+         * @return           The identifier of the image
+         *
+         * @author           Cedric Hammes
+         * @since            16/10/2026
+         */
+        [[nodiscard]] auto create_image(std::string name, const RenderGraphImageInfo& image_info) noexcept
+                -> RenderGraphResource;
+
+        /**
+         * This function imports an image, which is owned outside of the graph, into the graph. Writes into imported
+         * images are the output of the graph.
+         *
+         * @param name        The name of the image
+         * @param import_info The image and its state before and after the graph
+         * @return            The identifier of the image
+         *
+         * @author            Cedric Hammes
+         * @since             16/10/2026
+         */
+        [[nodiscard]] auto import_image(std::string name, const RenderGraphImportInfo& import_info) noexcept
+                -> RenderGraphResource;
+
+        /**
+         * This function adds a pass to the graph. The passes are executed in the order of insertion.
+         *
+         * @param name The name of the pass
+         * @param type The type of the pass
+         * @return     The pass, which declares its reads and writes
+         *
+         * @author     Cedric Hammes
+         * @since      16/10/2026
+         */
+        auto add_pass(std::string name, RenderGraphPassType type) noexcept -> RenderGraphPass&;
+
+        /**
+         * This function compiles the graph. The unused passes are culled, the transient images are placed into
+         * memory and the barriers of all passes are generated.
+         *
+         * @return Success or error
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto compile() noexcept -> kstd::Result<void>;
+
+        /**
+         * This function records all passes, which weren't culled, into the specified command buffer. The barriers of
+         * each pass are recorded with a single vkCmdPipelineBarrier2 call before the pass.
+         *
+         * @param command_buffer The command buffer
+         * @return               Success or error
+         *
+         * @author               Cedric Hammes
+         * @since                16/10/2026
+         */
+        [[nodiscard]] auto execute(VkCommandBuffer command_buffer) const noexcept -> kstd::Result<void>;
+
+        /**
+         * This function removes all passes and images from the graph. The transient images are kept for the next
+         * compilation.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        auto reset() noexcept -> void;
+
+        [[nodiscard]] auto get_image(RenderGraphResource resource) const noexcept -> VkImage;
+        [[nodiscard]] auto get_image_view(RenderGraphResource resource) const noexcept -> VkImageView;
+        [[nodiscard]] auto get_format(RenderGraphResource resource) const noexcept -> VkFormat;
+        [[nodiscard]] auto get_extent(RenderGraphResource resource) const noexcept -> VkExtent2D;
+        [[nodiscard]] auto get_pass_barriers(uint32_t compiled_index) const noexcept -> const BarrierBatch&;
+        [[nodiscard]] auto get_statistics() const noexcept -> const RenderGraphStatistics&;
+    };
+}// namespace aetherium::renderer::vulkan
@@ -0,0 +1,94 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include "aetherium/renderer/vulkan/device.hpp"
+#include <limits>
+
+namespace aetherium::renderer::vulkan {
+    /**
+     * This class is a safe-wrapper around a Vulkan 1.2 timeline semaphore. The semaphore holds a monotonic counter,
+     * which is signaled by the GPU or the CPU. This allows the developer to order submits by counter values and to
+     * poll the progress of the GPU without blocking.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class TimelineSemaphore final {
+        const VulkanDevice* _device;
+        VkSemaphore _semaphore_handle;
+
+        public:
+        /**
+         * This constructor creates an empty timeline semaphore
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        TimelineSemaphore() noexcept;
+
+        /**
+         * This constructor creates the timeline semaphore by the specified device and the initial counter value.
+         *
+         * @param device        The device on which the semaphore is to be created
+         * @param initial_value The initial value of the counter
+         *
+         * @author              Cedric Hammes
+         * @since               16/10/2026
+         */
+        explicit TimelineSemaphore(const VulkanDevice* device, uint64_t initial_value = 0);
+        ~TimelineSemaphore() noexcept;
+        TimelineSemaphore(TimelineSemaphore&& other) noexcept;
+        KSTD_NO_COPY(TimelineSemaphore, TimelineSemaphore);
+
+        /**
+         * This function sets the counter of the semaphore to the specified value from the CPU-side. The value has to
+         * be greater than the current value of the counter.
+         *
+         * @param value The new value of the counter
+         * @return      Success or error
+         *
+         * @author      Cedric Hammes
+         * @since       16/10/2026
+         */
+        [[nodiscard]] auto signal(uint64_t value) const noexcept -> kstd::Result<void>;
+
+        /**
+         * This function waits until the counter of the semaphore reaches the specified value. We are waiting based on
+         * the specified timeout.
+         *
+         * @param value   The value to wait for
+         * @param timeout The maximal wait timeout
+         * @return        Success or error
+         *
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] auto wait(uint64_t value, uint64_t timeout = std::numeric_limits<uint64_t>::max()) const noexcept
+                -> kstd::Result<void>;
+
+        /**
+         * This function returns the current value of the counter without blocking.
+         *
+         * @return The current counter value or an error
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto query() const noexcept -> kstd::Result<uint64_t>;
+
+        auto operator=(TimelineSemaphore&& other) noexcept -> TimelineSemaphore&;
+        auto operator*() const noexcept -> VkSemaphore;
+    };
+}// namespace aetherium::renderer::vulkan
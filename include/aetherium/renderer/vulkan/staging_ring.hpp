@@ -0,0 +1,199 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include "aetherium/renderer/vulkan/allocator.hpp"
+#include "aetherium/renderer/vulkan/command_submitter.hpp"
+#include "aetherium/utils.hpp"
+#include <deque>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <mutex>
+#include <vector>
+
+namespace aetherium::renderer::vulkan {
+    /**
+     * This struct describes a region of the staging ring. The producer writes the data directly into the mapped
+     * memory of the region.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct StagingRegion {
+        void* data;
+        VkDeviceSize offset;
+        VkDeviceSize size;
+    };
+
+    /**
+     * This class is a persistently mapped, host-visible ring buffer for uploads over the transfer queue. Producers
+     * write into regions of the ring and enqueue copies into buffers and images. All enqueued copies are recorded into
+     * a single command buffer per flush, which is submitted with the batch of the transfer queue. The space of a flush
+     * is reclaimed when the timeline value of its batch is reached.
+     *
+     * The copies of a region must be enqueued before the next flush and the destination resources must be accessible
+     * by the transfer queue family. Images have to be in the VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL layout. A flush only
+     * releases the space of regions up to the first region without an enqueued copy, so regions, which are still
+     * written by a producer, are never reused. A producer, which doesn't copy a region, has to release it.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class StagingRing final {
+        struct BufferCopy {
+            VkBuffer buffer;
+            VkBufferCopy copy;
+        };
+
+        struct ImageCopy {
+            VkImage image;
+            VkBufferImageCopy copy;
+        };
+
+        struct InFlightRegion {
+            SubmitTicket ticket;
+            VkDeviceSize end;
+        };
+
+        struct PendingRegion {
+            VkDeviceSize offset;
+            VkDeviceSize end;
+            bool is_done;
+        };
+
+        VkDevice _device;
+        MemoryAllocator* _memory_allocator;
+        CommandSubmitter* _command_submitter;
+        VkBuffer _buffer;
+        Allocation _allocation;
+        VkDeviceSize _capacity;
+        VkDeviceSize _head;
+        VkDeviceSize _tail;
+        std::mutex _mutex;
+        std::vector<BufferCopy> _buffer_copies {};
+        std::vector<ImageCopy> _image_copies {};
+        std::deque<InFlightRegion> _in_flight_regions {};
+        std::deque<PendingRegion> _pending_regions {};
+        SubmitTicket _last_ticket {};
+
+        [[nodiscard]] auto try_allocate(VkDeviceSize size, VkDeviceSize alignment) noexcept
+                -> kstd::Result<VkDeviceSize>;
+        [[nodiscard]] auto allocate_locked(VkDeviceSize size, VkDeviceSize alignment) noexcept
+                -> kstd::Result<StagingRegion>;
+        [[nodiscard]] auto flush_locked() noexcept -> kstd::Result<SubmitTicket>;
+        auto release_done_regions() noexcept -> void;
+        auto reclaim() noexcept -> void;
+        auto mark_done(VkDeviceSize offset) noexcept -> void;
+
+        public:
+        static constexpr VkDeviceSize DEFAULT_CAPACITY = 32ull * 1024 * 1024;
+
+        /**
+         * This constructor creates the staging buffer with the specified capacity and maps it persistently.
+         *
+         * @param device            The device, on which the buffer is created
+         * @param memory_allocator  The allocator of the buffer memory
+         * @param command_submitter The submitter of the transfer queue
+         * @param capacity          The size of the ring in bytes
+         *
+         * @author                  Cedric Hammes
+         * @since                   16/10/2026
+         */
+        StagingRing(VkDevice device, MemoryAllocator* memory_allocator, CommandSubmitter* command_submitter,
+                    VkDeviceSize capacity = DEFAULT_CAPACITY);
+        ~StagingRing() noexcept;
+        KSTD_NO_MOVE_COPY(StagingRing, StagingRing);
+
+        /**
+         * This function allocates a region of the ring. If the ring is full, the function waits until the oldest
+         * flush is done.
+         *
+         * @param size      The size of the region
+         * @param alignment The alignment of the region in the staging buffer
+         * @return          The region or an error
+         *
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        [[nodiscard]] auto allocate(VkDeviceSize size, VkDeviceSize alignment = 16) noexcept
+                -> kstd::Result<StagingRegion>;
+
+        /**
+         * This function enqueues a copy of the specified region into the buffer. Copies into the same buffer are
+         * merged into a single copy command.
+         *
+         * @param region The region with the data
+         * @param buffer The destination buffer
+         * @param offset The offset in the destination buffer
+         *
+         * @author       Cedric Hammes
+         * @since        16/10/2026
+         */
+        auto copy_to_buffer(const StagingRegion& region, VkBuffer buffer, VkDeviceSize offset) noexcept -> void;
+
+        /**
+         * This function enqueues a copy of the specified region into the image. The buffer offset of the copy is
+         * relative to the region.
+         *
+         * @param region The region with the data
+         * @param image  The destination image
+         * @param copy   The description of the copy
+         *
+         * @author       Cedric Hammes
+         * @since        16/10/2026
+         */
+        auto copy_to_image(const StagingRegion& region, VkImage image, const VkBufferImageCopy& copy) noexcept
+                -> void;
+
+        /**
+         * This function gives a region, which isn't copied, back to the ring. The producer must not write into the
+         * region anymore, the space is released with the next flush.
+         *
+         * @param region The region, which was allocated from this ring
+         *
+         * @author       Cedric Hammes
+         * @since        16/10/2026
+         */
+        auto release(const StagingRegion& region) noexcept -> void;
+
+        /**
+         * This function copies the specified data into the ring and enqueues the copy into the buffer.
+         *
+         * @param buffer The destination buffer
+         * @param offset The offset in the destination buffer
+         * @param data   The data
+         * @param size   The size of the data
+         * @return       Success or error
+         *
+         * @author       Cedric Hammes
+         * @since        16/10/2026
+         */
+        [[nodiscard]] auto upload(VkBuffer buffer, VkDeviceSize offset, const void* data, VkDeviceSize size) noexcept
+                -> kstd::Result<void>;
+
+        /**
+         * This function records all enqueued copies into a single command buffer of the transfer queue. The command
+         * buffer is submitted with the next flush of the transfer queue. The returned ticket is done when the copies
+         * are done.
+         *
+         * @return The ticket of the copies or an error
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto flush() noexcept -> kstd::Result<SubmitTicket>;
+
+        [[nodiscard]] auto get_capacity() const noexcept -> VkDeviceSize;
+    };
+}// namespace aetherium::renderer::vulkan
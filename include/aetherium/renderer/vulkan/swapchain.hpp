@@ -15,29 +15,137 @@
 #pragma once
 #include "aetherium/renderer/vulkan/context.hpp"
 #include "aetherium/renderer/vulkan/device.hpp"
+#include "aetherium/renderer/vulkan/queue.hpp"
+#include <kstd/result.hpp>
+#include <vector>
 
 namespace aetherium::renderer::vulkan {
+    /**
+     * This struct describes how the swapchain is created. Both values are preferences, which are adjusted to the
+     * capabilities of the surface.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct SwapchainOptions {
+        /**
+         * The preferred present mode. MAILBOX and IMMEDIATE reduce the latency, FIFO_RELAXED avoids stutter, when a
+         * frame misses the vertical blank. If the surface doesn't support the mode, FIFO is used, which is always
+         * supported.
+         */
+        VkPresentModeKHR present_mode = VK_PRESENT_MODE_FIFO_KHR;
+
+        /**
+         * The preferred count of swapchain images, which is clamped into the range supported by the surface
+         */
+        uint32_t image_count = 2;
+    };
+
     class Swapchain final {
+        const VulkanContext* _vulkan_context;
         const VulkanDevice* _vulkan_device;
+        SwapchainOptions _options;
         VkSwapchainKHR _swapchain;
+        VkFormat _format;
+        VkExtent2D _extent;
+        VkExtent2D _drawable_extent;
+        VkPresentModeKHR _present_mode;
         std::vector<VkImageView> _image_views {};
         std::vector<VkImage> _images {};
         uint32_t _current_image_index;
+        bool _is_out_of_date;
+
+        [[nodiscard]] auto create() noexcept -> kstd::Result<void>;
+        [[nodiscard]] auto get_drawable_extent() const noexcept -> VkExtent2D;
 
         public:
         friend class VulkanRenderer;
 
         Swapchain() noexcept;
-        explicit Swapchain(const VulkanContext& context, const VulkanDevice* vulkan_device);
+
+        /**
+         * This constructor creates the swapchain for the surface of the specified context. The present mode and image
+         * count are chosen by the options and the capabilities of the surface.
+         *
+         * @param context       The context with the surface
+         * @param vulkan_device The device, on which the swapchain is created
+         * @param options       The options of the swapchain
+         *
+         * @author              Cedric Hammes
+         * @since               16/10/2026
+         */
+        Swapchain(const VulkanContext& context, const VulkanDevice* vulkan_device,
+                  const SwapchainOptions& options = SwapchainOptions {});
         Swapchain(Swapchain&& other) noexcept;
         ~Swapchain() noexcept;
         KSTD_NO_COPY(Swapchain, Swapchain);
 
-        [[nodiscard]] auto next_image(VkSemaphore image_available_semaphore) noexcept -> kstd::Result<void>;
+        /**
+         * This function acquires the next image of the swapchain. If the swapchain is out of date, no image is
+         * acquired and the swapchain has to be recreated. A suboptimal swapchain still returns an image, but is
+         * marked as out of date.
+         *
+         * @param image_available_semaphore The semaphore, which is signaled when the image is available
+         * @return                          Whether an image was acquired or an error
+         *
+         * @author                          Cedric Hammes
+         * @since                           16/10/2026
+         */
+        [[nodiscard]] auto next_image(VkSemaphore image_available_semaphore) noexcept -> kstd::Result<bool>;
+
+        /**
+         * This function presents the current image on the specified queue. An out of date or suboptimal swapchain
+         * isn't an error, instead the swapchain is marked as out of date.
+         *
+         * @param queue          The queue, which presents the image
+         * @param wait_semaphore The semaphore, which is signaled when the image is rendered
+         * @return               Success or error
+         *
+         * @author               Cedric Hammes
+         * @since                16/10/2026
+         */
+        [[nodiscard]] auto present(const Queue& queue, VkSemaphore wait_semaphore) noexcept -> kstd::Result<void>;
+
+        /**
+         * This function recreates the swapchain in place with the current size of the window. The old swapchain is
+         * passed to the new one, so the presentation engine can reuse its resources. While the window is minimized,
+         * the swapchain isn't recreated and stays out of date.
+         *
+         * @return Success or error
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto recreate() noexcept -> kstd::Result<void>;
+
+        /**
+         * This function returns whether the swapchain has to be recreated, because the presentation engine reported
+         * it or the size of the window has changed.
+         *
+         * @return Whether the swapchain is out of date
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto is_out_of_date() const noexcept -> bool;
         [[nodiscard]] auto current_image() const noexcept -> VkImage;
         [[nodiscard]] auto current_image_view() const noexcept -> VkImageView;
         [[nodiscard]] auto current_image_index() const noexcept -> uint32_t;
 
+        /**
+         * This function returns the format of the swapchain images. The format is needed by everything, which
+         * renders into the swapchain images with dynamic rendering.
+         *
+         * @return The format of the swapchain images
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_format() const noexcept -> VkFormat;
+        [[nodiscard]] auto get_extent() const noexcept -> VkExtent2D;
+        [[nodiscard]] auto get_present_mode() const noexcept -> VkPresentModeKHR;
+        [[nodiscard]] auto get_image_count() const noexcept -> uint32_t;
+
         auto operator=(Swapchain&& other) noexcept -> Swapchain&;
         auto operator*() const noexcept -> VkSwapchainKHR;
     };
@@ -0,0 +1,121 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include "aetherium/renderer/vulkan/allocator.hpp"
+#include "aetherium/renderer/vulkan/device.hpp"
+#include <cstring>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <type_traits>
+
+namespace aetherium::renderer::vulkan {
+    /**
+     * This struct describes a range of the uniform buffer of a frame. The offset is used as dynamic offset of a
+     * dynamic uniform or storage buffer descriptor.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct UniformAllocation {
+        void* data;
+        VkBuffer buffer;
+        uint32_t offset;
+        VkDeviceSize size;
+    };
+
+    /**
+     * This class is a bump-pointer allocator inside a persistently mapped, host-visible buffer. Every frame owns one
+     * allocator for the constants of its draws, which is reset when the frame is reused. All offsets are aligned to
+     * the minimal uniform and storage buffer offset alignment of the device, so they can be used as dynamic offsets.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class UniformAllocator final {
+        const VulkanDevice* _vulkan_device;
+        VkBuffer _buffer;
+        Allocation _allocation;
+        LinearAllocator _linear_allocator;
+        VkDeviceSize _alignment;
+
+        public:
+        /**
+         * This constructor creates an empty allocator without buffer.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        UniformAllocator() noexcept;
+
+        /**
+         * This constructor creates the buffer of the allocator with the specified size on the device.
+         *
+         * @param vulkan_device The device, on which the buffer is created
+         * @param size          The size of the buffer
+         *
+         * @author              Cedric Hammes
+         * @since               16/10/2026
+         */
+        UniformAllocator(const VulkanDevice* vulkan_device, VkDeviceSize size);
+        UniformAllocator(UniformAllocator&& other) noexcept;
+        ~UniformAllocator() noexcept;
+        KSTD_NO_COPY(UniformAllocator, UniformAllocator);
+
+        /**
+         * This function allocates a range with the specified size behind the last allocation.
+         *
+         * @param size The size of the range
+         * @return     The range or an error
+         *
+         * @author     Cedric Hammes
+         * @since      16/10/2026
+         */
+        [[nodiscard]] auto allocate(VkDeviceSize size) noexcept -> kstd::Result<UniformAllocation>;
+
+        /**
+         * This function allocates a range for the specified value and copies the value into it.
+         *
+         * @tparam T    The type of the value
+         * @param value The value itself
+         * @return      The range or an error
+         *
+         * @author      Cedric Hammes
+         * @since       16/10/2026
+         */
+        template<typename T>
+        [[nodiscard]] auto push(const T& value) noexcept -> kstd::Result<UniformAllocation> {
+            static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be pushed");
+            auto allocation = allocate(sizeof(T));
+            if(!allocation.is_error()) {
+                std::memcpy(allocation->data, &value, sizeof(T));
+            }
+            return allocation;
+        }
+
+        /**
+         * This function frees all allocations at once. The GPU must be done with the buffer.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        auto reset() noexcept -> void;
+
+        [[nodiscard]] auto get_alignment() const noexcept -> VkDeviceSize;
+        [[nodiscard]] auto get_used_size() const noexcept -> VkDeviceSize;
+
+        auto operator=(UniformAllocator&& other) noexcept -> UniformAllocator&;
+        auto operator*() const noexcept -> VkBuffer;
+    };
+}// namespace aetherium::renderer::vulkan
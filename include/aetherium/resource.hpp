@@ -14,25 +14,142 @@
 
 #pragma once
 
+#include "aetherium/file_watcher.hpp"
+#include "aetherium/resource_loader.hpp"
+#include "aetherium/thread_pool.hpp"
 #include "aetherium/utils.hpp"
 #include <filesystem>
 #include <kstd/option.hpp>
 #include <kstd/reflect/reflection.hpp>
 #include <kstd/result.hpp>
+#include <chrono>
 #include <kstd/safe_alloc.hpp>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <parallel_hashmap/phmap.h>
 #include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace fs = std::filesystem;
 
 namespace aetherium {
     class ResourceManager;
 
+    /**
+     * This class is a compact reference to a resource in the resource manager, which is made of the index of the
+     * slot in the dense slot array of the resource type and the generation of the slot. The generation gets bumped
+     * when the resource is unloaded or replaced, so stale handles are detected on dereference.
+     *
+     * @tparam RESOURCE The implementation type of the resource
+     *
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    template<typename RESOURCE>
+    class Handle final {
+        uint32_t _index;
+        uint32_t _generation;
+
+        public:
+        constexpr Handle() noexcept :
+                _index {0},
+                _generation {0} {
+        }
+
+        constexpr Handle(uint32_t index, uint32_t generation) noexcept :
+                _index {index},
+                _generation {generation} {
+        }
+
+        [[nodiscard]] constexpr auto operator==(const Handle& other) const noexcept -> bool {
+            return _index == other._index && _generation == other._generation;
+        }
+
+        [[nodiscard]] constexpr auto operator!=(const Handle& other) const noexcept -> bool {
+            return !(*this == other);
+        }
+
+        [[nodiscard]] constexpr auto is_null() const noexcept -> bool {
+            return _generation == 0;
+        }
+
+        [[nodiscard]] constexpr auto get_index() const noexcept -> uint32_t {
+            return _index;
+        }
+
+        [[nodiscard]] constexpr auto get_generation() const noexcept -> uint32_t {
+            return _generation;
+        }
+    };
+
+    /**
+     * This class is the caller side of an asynchronous load. It can be polled for the state of the load and be used
+     * to cancel the load.
+     *
+     * @tparam RESOURCE The implementation type of the resource
+     *
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    template<typename RESOURCE>
+    class AsyncLoad final {
+        std::shared_ptr<ResourceLoadRequest> _request;
+
+        public:
+        AsyncLoad() noexcept = default;
+
+        explicit AsyncLoad(std::shared_ptr<ResourceLoadRequest> request) noexcept :
+                _request {std::move(request)} {
+        }
+
+        /**
+         * This function cancels the load. If the resource is already loaded, this function has no effect.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        auto cancel() noexcept -> void {
+            if(_request != nullptr) {
+                _request->is_cancelled.store(true);
+            }
+        }
+
+        [[nodiscard]] auto get_state() const noexcept -> LoadState {
+            return _request == nullptr ? CANCELLED : _request->state.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]] auto is_done() const noexcept -> bool {
+            return get_state() >= LOADED;
+        }
+
+        /**
+         * This function returns the handle to the loaded resource. If the load failed, was cancelled or isn't done
+         * yet, an error is returned.
+         *
+         * @return The handle to the resource or an error
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_result() const noexcept -> kstd::Result<Handle<RESOURCE>> {
+            using namespace std::string_literals;
+            switch(get_state()) {
+                case LOADED: return Handle<RESOURCE> {_request->slot_index, _request->generation};
+                case FAILED: return kstd::Error {_request->error};
+                case CANCELLED: return kstd::Error {"Unable to get resource: The load was cancelled"s};
+                default: return kstd::Error {"Unable to get resource: The load isn't done yet"s};
+            }
+        }
+    };
+
     class Resource {
         protected:
         fs::path _resource_path;
         const kstd::reflect::RTTI* _runtime_type;
+        std::vector<fs::path> _dependencies {};
 
         public:
         explicit Resource(const fs::path resource_path, const kstd::reflect::RTTI* runtime_type) noexcept ://NOLINT
@@ -46,6 +163,65 @@ namespace aetherium {
             return {};
         }
 
+        /**
+         * This function returns whether the resource can be reloaded by a worker of the resource manager. Resources,
+         * which don't share state with other resources or the calling thread, should return true.
+         *
+         * @return Whether the resource can be reloaded on another thread
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] virtual auto supports_parallel_reload() const noexcept -> bool {
+            return false;
+        }
+
+        /**
+         * This function returns whether the resource is loaded by the stages of the asynchronous load pipeline. The
+         * file of staged resources is read by the I/O thread, passed into decode on a worker and the resource gets
+         * finalized on the thread, which owns the resource manager. Other resources are loaded by reload.
+         *
+         * @return Whether the resource supports the staged load
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] virtual auto supports_staged_load() const noexcept -> bool {
+            return false;
+        }
+
+        /**
+         * This function decodes the content of the resource file. This function is called by a worker thread.
+         *
+         * @param data             The content of the resource file
+         * @param resource_manager The resource manager, which loads the resource
+         * @return                 Success or an error
+         *
+         * @author                 Cedric Hammes
+         * @since                  16/10/2026
+         */
+        virtual auto decode(std::vector<uint8_t> data, const ResourceManager& resource_manager) noexcept
+                -> kstd::Result<void> {
+            UNUSED_PARAMETER(data);
+            UNUSED_PARAMETER(resource_manager);
+            return {};
+        }
+
+        /**
+         * This function finalizes the decoded resource, like the creation of GPU objects. This function is called by
+         * the thread, which owns the resource manager.
+         *
+         * @param resource_manager The resource manager, which loads the resource
+         * @return                 Success or an error
+         *
+         * @author                 Cedric Hammes
+         * @since                  16/10/2026
+         */
+        virtual auto finalize(const ResourceManager& resource_manager) noexcept -> kstd::Result<void> {
+            UNUSED_PARAMETER(resource_manager);
+            return {};
+        }
+
         [[nodiscard]] inline auto get_resource_path() const noexcept -> const fs::path& {
             return _resource_path;
         }
@@ -53,6 +229,47 @@ namespace aetherium {
         [[nodiscard]] inline auto get_runtime_type() const noexcept -> const kstd::reflect::RTTI& {
             return *_runtime_type;
         }
+
+        /**
+         * This function returns the files, which were read by the last reload of the resource besides the resource
+         * file itself, like the includes of a shader. A change of these files reloads the resource.
+         *
+         * @return The paths of the dependencies
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_dependencies() const noexcept -> const std::vector<fs::path>& {
+            return _dependencies;
+        }
+    };
+
+    /**
+     * This struct contains the time spent reloading the resources of one type. The time is the sum over all
+     * resources, so it can exceed the wall time of a parallel reload.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct ResourceTypeReloadTiming {
+        const kstd::reflect::RTTI* runtime_type = nullptr;
+        uint32_t resource_count = 0;
+        double milliseconds = 0.0;
+    };
+
+    /**
+     * This struct contains the statistics of the last reload of the resource manager. The resources are reloaded in
+     * waves, every wave only contains resources whose dependencies were reloaded by a previous wave.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct ResourceReloadStatistics {
+        uint32_t resource_count = 0;
+        uint32_t error_count = 0;
+        uint32_t wave_count = 0;
+        double milliseconds = 0.0;
+        std::vector<ResourceTypeReloadTiming> type_timings {};
     };
 
     /**
@@ -63,17 +280,229 @@ namespace aetherium {
      * @since  02/02/2024
      */
     class ResourceManager final {
-        phmap::flat_hash_map<std::string, std::shared_ptr<Resource>> _loaded_resources;
+        struct ResourceKeyView {
+            const kstd::reflect::RTTI* runtime_type;
+            std::string_view space;
+            std::string_view path;
+        };
+
+        // The key is stored as type, namespace and path, so lookups can be done by a view without formatting a string
+        struct ResourceKey {
+            const kstd::reflect::RTTI* runtime_type;
+            std::string space;
+            std::string path;
+
+            [[nodiscard]] inline auto view() const noexcept -> ResourceKeyView {
+                return {runtime_type, space, path};
+            }
+        };
+
+        struct ResourceKeyHash {
+            using is_transparent = void;
+
+            [[nodiscard]] auto operator()(const ResourceKeyView& key) const noexcept -> size_t {
+                return phmap::HashState().combine(0, key.runtime_type, key.space, key.path);
+            }
+
+            [[nodiscard]] auto operator()(const ResourceKey& key) const noexcept -> size_t {
+                return (*this)(key.view());
+            }
+        };
+
+        struct ResourceKeyEqual {
+            using is_transparent = void;
+
+            [[nodiscard]] static auto equals(const ResourceKeyView& left, const ResourceKeyView& right) noexcept
+                    -> bool {
+                return left.runtime_type == right.runtime_type && left.space == right.space && left.path == right.path;
+            }
+
+            template<typename LEFT, typename RIGHT>
+            [[nodiscard]] auto operator()(const LEFT& left, const RIGHT& right) const noexcept -> bool {
+                return equals(to_view(left), to_view(right));
+            }
+
+            private:
+            [[nodiscard]] static auto to_view(const ResourceKeyView& key) noexcept -> ResourceKeyView {
+                return key;
+            }
+
+            [[nodiscard]] static auto to_view(const ResourceKey& key) noexcept -> ResourceKeyView {
+                return key.view();
+            }
+        };
+
+        struct LoadedResource {
+            std::shared_ptr<Resource> resource;
+            uint32_t type_index;
+            uint32_t slot_index;
+        };
+
+        struct ResourceSlot {
+            Resource* resource;
+            uint32_t generation;
+        };
+
+        struct ResourceSlots {
+            std::vector<ResourceSlot> slots;
+            std::vector<uint32_t> free_indices;
+        };
+
+        phmap::flat_hash_map<ResourceKey, LoadedResource, ResourceKeyHash, ResourceKeyEqual> _loaded_resources;
+        std::vector<ResourceSlots> _resource_slots;
+        phmap::flat_hash_map<std::string, std::vector<Resource*>> _dependents;
+        phmap::flat_hash_map<Resource*, std::vector<std::string>> _dependencies;
+        std::unique_ptr<FileWatcher> _file_watcher;
+        ResourceReloadStatistics _reload_statistics {};
         std::string_view _base_directory;
+        uint32_t _thread_count;
+        std::once_flag _thread_pool_flag;
+        std::unique_ptr<ThreadPool> _thread_pool;
+        std::once_flag _resource_loader_flag;
+        std::unique_ptr<ResourceLoader> _resource_loader;
+
+        /**
+         * This function returns the worker pool and creates it on the first call, so managers without parallel
+         * reloads or asynchronous loads don't start any threads.
+         *
+         * @return The worker pool of the manager
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_thread_pool() -> ThreadPool&;
+
+        /**
+         * This function returns the asynchronous loader and creates it with its I/O thread on the first call.
+         *
+         * @return The asynchronous loader of the manager
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_resource_loader() -> ResourceLoader&;
+
+        /**
+         * This function reloads the specified resources in dependency waves. The resources of a wave with parallel
+         * reload support are partitioned over the workers, the other resources are reloaded by the calling thread.
+         * All resources are reloaded even if a reload fails, the errors of all failed reloads are returned at once.
+         *
+         * @param resources The resources to reload
+         * @return          Success or an error with all failed reloads
+         *
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        auto reload_resources(const std::vector<Resource*>& resources) noexcept -> kstd::Result<void>;
+
+        /**
+         * This function adds the resource into the manager and assigns a slot in the slot array of the resource type
+         * to it. If a resource with the same key is already loaded, the slot of this resource gets released first, so
+         * handles to the replaced resource become stale.
+         *
+         * @param type_index The index of the resource type
+         * @param key        The key of the resource
+         * @param resource   The resource itself
+         * @return           The index of the assigned slot
+         *
+         * @author           Cedric Hammes
+         * @since            16/10/2026
+         */
+        auto insert_resource(uint32_t type_index, ResourceKey key, std::shared_ptr<Resource> resource) noexcept
+                -> uint32_t;
+
+        /**
+         * This function clears the specified slot, bumps the generation of it and marks the slot as free.
+         *
+         * @param type_index The index of the resource type
+         * @param slot_index The index of the slot
+         *
+         * @author           Cedric Hammes
+         * @since            16/10/2026
+         */
+        auto release_slot(uint32_t type_index, uint32_t slot_index) noexcept -> void;
+
+        /**
+         * This function removes the resource with the specified key from the manager and releases the slot of it.
+         *
+         * @param key The key of the resource
+         * @return    Whether a resource was unloaded
+         *
+         * @author    Cedric Hammes
+         * @since     16/10/2026
+         */
+        auto unload_resource(const ResourceKeyView& key) noexcept -> bool;
+
+        /**
+         * This function registers the resource file and the dependencies of the specified resource in the dependency
+         * index, which maps changed files to the resources to reload. The old entries of the resource are replaced.
+         *
+         * @param resource The resource
+         *
+         * @author         Cedric Hammes
+         * @since          16/10/2026
+         */
+        auto update_dependencies(Resource* resource) noexcept -> void;
+
+        /**
+         * This function removes all entries of the specified resource from the dependency index.
+         *
+         * @param resource The resource
+         *
+         * @author         Cedric Hammes
+         * @since          16/10/2026
+         */
+        auto remove_dependencies(Resource* resource) noexcept -> void;
+
+        [[nodiscard]] static auto next_type_index() noexcept -> uint32_t;
+
+        /**
+         * This function returns the index of the slot array of the specified resource type. The indices are assigned
+         * on the first use of a resource type.
+         *
+         * @tparam RESOURCE The implementation type of the resource
+         * @return          The index of the resource type
+         *
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        template<typename RESOURCE>
+        [[nodiscard]] static auto get_type_index() noexcept -> uint32_t {
+            static const auto type_index = next_type_index();
+            return type_index;
+        }
+
+        /**
+         * This function returns the runtime type of the specified resource type. The reflection lookup is only done
+         * once per type, so the hot lookup paths only work with the cached pointer.
+         *
+         * @tparam RESOURCE The implementation type of the resource
+         * @return          The runtime type of the resource type
+         *
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        template<typename RESOURCE>
+        [[nodiscard]] static auto get_resource_type() noexcept -> const kstd::reflect::RTTI* {
+            static const auto* runtime_type =
+                    &static_cast<const kstd::reflect::RTTI&>(*kstd::reflect::lookup<RESOURCE>());
+            return runtime_type;
+        }
 
         public:
         /**
-         * This constructor creates the resource manager with the default (empty) values
+         * This constructor creates the resource manager with the default (empty) values. The worker pool, which
+         * reloads all resources with parallel reload support, is created on first use.
+         *
+         * @param base_directory The directory with the assets and the cache
+         * @param thread_count   The count of reload workers or zero for one worker per hardware thread
+         *
+         * @author               Cedric Hammes
+         * @since                02/02/2024
          */
-        explicit ResourceManager(std::string_view base_directory) noexcept;
+        explicit ResourceManager(std::string_view base_directory, uint32_t thread_count = 0);
         ~ResourceManager() noexcept = default;
-        KSTD_NO_COPY(ResourceManager, ResourceManager);
-        KSTD_DEFAULT_MOVE(ResourceManager, ResourceManager);
+        KSTD_NO_MOVE_COPY(ResourceManager, ResourceManager);
 
         /**
          * This function uses the specified space and path to load the resource. After the resource load, the resource
@@ -98,19 +527,114 @@ namespace aetherium {
             }
 
             // TODO: Transform construct into result
-            const auto rtti = &static_cast<const kstd::reflect::RTTI&>(*kstd::reflect::lookup<RESOURCE>());
+            const auto rtti = get_resource_type<RESOURCE>();
             auto resource = std::make_shared<RESOURCE>(resource_path, rtti, std::forward<ARGS>(args)...);
             if(const auto result = resource->reload(*this); result.is_error()) {
                 return kstd::Error {result.get_error()};
             }
 
-            _loaded_resources[fmt::format("{}/{}", rtti->to_string(), resource_path.string())] =
-                    static_cast<std::shared_ptr<Resource>>(resource);
+            insert_resource(get_type_index<RESOURCE>(), ResourceKey {rtti, space, path},
+                            static_cast<std::shared_ptr<Resource>>(resource));
             return kstd::Result<RESOURCE&> {*resource};
         }
 
         /**
-         * This function enumerates all loaded resources and returns the first resource found or none.
+         * This function creates all specified resources and reloads them at once, so resources with parallel reload
+         * support are spread over the workers. The resources are only added into the manager if all reloads succeed.
+         *
+         * @tparam RESOURCE The implementation type of the resources
+         * @tparam ARGS     The initializer parameters types
+         * @param space     The namespace of the resources
+         * @param paths     The paths of the resources
+         * @param args      The initializer parameters, which are passed to every resource
+         * @return          The count of loaded resources or an error
+         *
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        template<typename RESOURCE, typename... ARGS>
+        [[nodiscard]] auto load_all(const std::string& space, const std::vector<std::string>& paths,
+                                    const ARGS&... args) noexcept -> kstd::Result<uint32_t> {
+            static_assert(std::is_base_of_v<Resource, RESOURCE>, "Base class of resource isn't Resource");
+            const auto rtti = get_resource_type<RESOURCE>();
+
+            std::vector<std::pair<ResourceKey, std::shared_ptr<Resource>>> resources {};
+            std::vector<Resource*> reloaded_resources {};
+            resources.reserve(paths.size());
+            reloaded_resources.reserve(paths.size());
+            for(const auto& path : paths) {
+                const auto resource_path = fs::path {_base_directory}.append("assets").append(space).append(path);
+                if(!fs::exists(resource_path) || !fs::is_regular_file(resource_path)) {
+                    return kstd::Error {fmt::format(
+                            "Unable to load resource '{}': The resource path doesn't exists or isn't a file", path)};
+                }
+
+                auto resource = std::make_shared<RESOURCE>(resource_path, rtti, args...);
+                reloaded_resources.push_back(resource.get());
+                resources.emplace_back(ResourceKey {rtti, space, path}, std::move(resource));
+            }
+
+            if(const auto result = reload_resources(reloaded_resources); result.is_error()) {
+                return kstd::Error {result.get_error()};
+            }
+
+            const auto type_index = get_type_index<RESOURCE>();
+            for(auto& [identifier, resource] : resources) {
+                insert_resource(type_index, std::move(identifier), std::move(resource));
+            }
+            return static_cast<uint32_t>(resources.size());
+        }
+
+        /**
+         * This function creates the resource and queues it into the asynchronous load pipeline. The calling thread
+         * doesn't touch the filesystem, the resource is added into the manager by finalize_loads after the file was
+         * read and decoded in the background.
+         *
+         * @tparam RESOURCE The implementation type of the resource
+         * @tparam ARGS     The initializer parameters types
+         * @param space     The namespace of the resource
+         * @param path      The path of the resource
+         * @param priority  The priority of the load
+         * @param args      The initializer parameters
+         * @return          The asynchronous load
+         *
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        template<typename RESOURCE, typename... ARGS>
+        [[nodiscard]] auto load_async(const std::string& space, const std::string& path, LoadPriority priority,
+                                      ARGS&&... args) -> AsyncLoad<RESOURCE> {
+            static_assert(std::is_base_of_v<Resource, RESOURCE>, "Base class of resource isn't Resource");
+            const auto rtti = get_resource_type<RESOURCE>();
+            const auto resource_path = fs::path {_base_directory}.append("assets").append(space).append(path);
+
+            auto request = std::make_shared<ResourceLoadRequest>();
+            request->resource = std::make_shared<RESOURCE>(resource_path, rtti, std::forward<ARGS>(args)...);
+            request->runtime_type = rtti;
+            request->type_index = get_type_index<RESOURCE>();
+            request->space = space;
+            request->path = path;
+            request->priority = priority;
+            get_resource_loader().enqueue(request);
+            return AsyncLoad<RESOURCE> {std::move(request)};
+        }
+
+        /**
+         * This function finalizes the decoded asynchronous loads and adds the resources into the manager. This
+         * function should be called once per frame by the thread, which owns the resource manager.
+         *
+         * @param max_count The maximum count of finalized loads, to limit the time spent per frame
+         * @return          The count of finalized loads
+         *
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        auto finalize_loads(uint32_t max_count = std::numeric_limits<uint32_t>::max()) noexcept -> uint32_t;
+
+        /**
+         * This function looks up the loaded resource by the type, namespace and path. The lookup is done with a view
+         * of the key, so it doesn't allocate or touch the filesystem. Resources are identified by the namespace and
+         * path as passed to the load function.
          *
          * @tparam RESOURCE The implementation type of the resource
          * @param space     The resource namespace
@@ -121,20 +645,114 @@ namespace aetherium {
          * @since           02/02/2024
          */
         template<typename RESOURCE>
-        [[nodiscard]] auto get_resource(const std::string& space, const std::string& path) noexcept
+        [[nodiscard]] auto get_resource(std::string_view space, std::string_view path) noexcept
                 -> kstd::Option<RESOURCE&> {
             static_assert(std::is_base_of_v<Resource, RESOURCE>, "Base class of resource isn't Resource");
-            const auto resource_type = static_cast<const kstd::reflect::RTTI*>(&*kstd::reflect::lookup<RESOURCE>());
-            const auto resource_path = fs::path {_base_directory}.append("assets").append(space).append(path);
-            if(!fs::exists(resource_path) || !fs::is_regular_file(resource_path)) {
+            const auto iterator = _loaded_resources.find(ResourceKeyView {get_resource_type<RESOURCE>(), space, path});
+            if(iterator == _loaded_resources.end()) {
                 return kstd::Option<RESOURCE&> {};
             }
+            return kstd::Option<RESOURCE&> {static_cast<RESOURCE&>(*iterator->second.resource)};
+        }
 
-            const auto identifier = fmt::format("{}/{}", resource_type->to_string(), resource_path.string());
-            if(!_loaded_resources.contains(identifier))
+        /**
+         * This function returns the handle to the loaded resource with the specified namespace and path. The handle
+         * stays valid until the resource gets unloaded or replaced by another load of the same resource.
+         *
+         * @tparam RESOURCE The implementation type of the resource
+         * @param space     The resource namespace
+         * @param path      The resource path
+         * @return          The handle to the resource or a null handle
+         *
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        template<typename RESOURCE>
+        [[nodiscard]] auto get_handle(std::string_view space, std::string_view path) const noexcept
+                -> Handle<RESOURCE> {
+            static_assert(std::is_base_of_v<Resource, RESOURCE>, "Base class of resource isn't Resource");
+            const auto iterator = _loaded_resources.find(ResourceKeyView {get_resource_type<RESOURCE>(), space, path});
+            if(iterator == _loaded_resources.end()) {
+                return Handle<RESOURCE> {};
+            }
+
+            const auto& [resource, type_index, slot_index] = iterator->second;
+            return Handle<RESOURCE> {slot_index, _resource_slots[type_index].slots[slot_index].generation};
+        }
+
+        /**
+         * This function dereferences the specified handle by indexing the slot array of the resource type. If the
+         * generation of the slot doesn't match the handle, the handle is stale and none is returned.
+         *
+         * @tparam RESOURCE The implementation type of the resource
+         * @param handle    The handle to the resource
+         * @return          The resource itself or none
+         *
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        template<typename RESOURCE>
+        [[nodiscard]] auto get(Handle<RESOURCE> handle) noexcept -> kstd::Option<RESOURCE&> {
+            const auto type_index = get_type_index<RESOURCE>();
+            if(handle.is_null() || type_index >= _resource_slots.size()) {
+                return kstd::Option<RESOURCE&> {};
+            }
+
+            const auto& slots = _resource_slots[type_index].slots;
+            if(handle.get_index() >= slots.size()) {
                 return kstd::Option<RESOURCE&> {};
+            }
+
+            const auto& slot = slots[handle.get_index()];
+            if(slot.generation != handle.get_generation() || slot.resource == nullptr) {
+                return kstd::Option<RESOURCE&> {};
+            }
+            return kstd::Option<RESOURCE&> {static_cast<RESOURCE&>(*slot.resource)};
+        }
+
+        /**
+         * This function calls the specified function with every loaded resource of the specified type. The resources
+         * are enumerated in the order of the slot array of the type.
+         *
+         * @tparam RESOURCE The implementation type of the resources
+         * @tparam FUNCTION The type of the function
+         * @param function  The function, which is called with the handle and the resource
+         *
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        template<typename RESOURCE, typename FUNCTION>
+        auto for_each(FUNCTION&& function) noexcept -> void {
+            const auto type_index = get_type_index<RESOURCE>();
+            if(type_index >= _resource_slots.size()) {
+                return;
+            }
 
-            return kstd::Option<RESOURCE&> {static_cast<RESOURCE&>(*_loaded_resources[identifier])};
+            auto& slots = _resource_slots[type_index].slots;
+            for(uint32_t index = 0; index < slots.size(); ++index) {
+                if(slots[index].resource != nullptr) {
+                    function(Handle<RESOURCE> {index, slots[index].generation},
+                             static_cast<RESOURCE&>(*slots[index].resource));
+                }
+            }
+        }
+
+        /**
+         * This function removes the resource with the specified namespace and path from the manager. All handles to
+         * the resource become stale.
+         *
+         * @tparam RESOURCE The implementation type of the resource
+         * @param space     The resource namespace
+         * @param path      The resource path
+         * @return          Whether a resource was unloaded
+         *
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        template<typename RESOURCE>
+        auto unload(std::string_view space, std::string_view path) noexcept -> bool {
+            static_assert(std::is_base_of_v<Resource, RESOURCE>, "Base class of resource isn't Resource");
+            return unload_resource(ResourceKeyView {get_resource_type<RESOURCE>(), space, path});
         }
 
         /**
@@ -163,7 +781,8 @@ namespace aetherium {
         }
 
         /**
-         * This function enumerates through all resources with the same type as specified and reloads them.
+         * This function enumerates through all resources with the same type as specified and reloads them. Resources
+         * with parallel reload support are reloaded by the workers of the resource manager.
          *
          * @return The count of reloaded resources or an error
          *
@@ -173,18 +792,19 @@ namespace aetherium {
         template<typename RESOURCE>
         [[nodiscard]] auto reload_by_type() noexcept -> kstd::Result<uint32_t> {
             static_assert(std::is_base_of_v<Resource, RESOURCE>, "Base class of resource isn't Resource");
-            const auto resource_type = static_cast<const kstd::reflect::RTTI*>(&*kstd::reflect::lookup<RESOURCE>());
-
-            uint32_t resource_count = 0;
-            for(auto& [identifier, resource] : _loaded_resources) {
-                if(resource->get_runtime_type().is_same(*resource_type)) {
-                    if(const auto result = resource->reload(*this); !result.is_empty()) {
-                        return kstd::Error {result.get_error()};
+            std::vector<Resource*> resources {};
+            if(const auto type_index = get_type_index<RESOURCE>(); type_index < _resource_slots.size()) {
+                for(const auto& slot : _resource_slots[type_index].slots) {
+                    if(slot.resource != nullptr) {
+                        resources.push_back(slot.resource);
                     }
-                    resource_count++;
                 }
             }
-            return resource_count;
+
+            if(const auto result = reload_resources(resources); result.is_error()) {
+                return kstd::Error {result.get_error()};
+            }
+            return static_cast<uint32_t>(resources.size());
         }
 
         /**
@@ -196,5 +816,37 @@ namespace aetherium {
          * @since  02/02/2024
          */
         [[nodiscard]] auto reload() noexcept -> kstd::Result<uint32_t>;
+
+        /**
+         * This function starts watching the assets directory for changed files. The changes are reloaded by
+         * reload_changed.
+         *
+         * @param debounce_time The time without events, after which a changed file is reloaded
+         * @return              Success or an error
+         *
+         * @author              Cedric Hammes
+         * @since               16/10/2026
+         */
+        [[nodiscard]] auto watch(std::chrono::milliseconds debounce_time = std::chrono::milliseconds {100}) noexcept
+                -> kstd::Result<void>;
+
+        /**
+         * This function takes the changed files from the watcher and reloads the resources, which are loaded from
+         * these files or depend on them, as one batch. This function should be called once per frame.
+         *
+         * @return The count of reloaded resources or an error
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto reload_changed() noexcept -> kstd::Result<uint32_t>;
+
+        [[nodiscard]] inline auto get_reload_statistics() const noexcept -> const ResourceReloadStatistics& {
+            return _reload_statistics;
+        }
+
+        [[nodiscard]] inline auto get_base_directory() const noexcept -> std::string_view {
+            return _base_directory;
+        }
     };
 }// namespace aetherium
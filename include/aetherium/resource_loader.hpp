@@ -0,0 +1,182 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include "aetherium/thread_pool.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <kstd/defaults.hpp>
+#include <kstd/reflect/reflection.hpp>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace aetherium {
+    class Resource;
+    class ResourceManager;
+
+    /**
+     * This enum represents the priority of an asynchronous load. Loads with a higher priority are read and finalized
+     * before loads with a lower priority.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    enum LoadPriority {
+        LOW_PRIORITY,
+        NORMAL_PRIORITY,
+        HIGH_PRIORITY
+    };
+
+    /**
+     * This enum represents the stage of an asynchronous load in the load pipeline.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    enum LoadState {
+        /**
+         * The load waits for the I/O thread
+         */
+        QUEUED,
+        /**
+         * The I/O thread reads the file of the resource
+         */
+        READING,
+        /**
+         * A worker decodes the read data of the resource
+         */
+        DECODING,
+        /**
+         * The load waits for the finalization on the thread, which owns the resource manager
+         */
+        FINALIZING,
+        /**
+         * The resource was added into the resource manager
+         */
+        LOADED,
+        FAILED,
+        CANCELLED
+    };
+
+    /**
+     * This struct is the shared state of an asynchronous load. The state is written by the stage, which currently
+     * processes the load, and is published by storing the load state.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct ResourceLoadRequest {
+        std::shared_ptr<Resource> resource;
+        const kstd::reflect::RTTI* runtime_type;
+        uint32_t type_index;
+        std::string space;
+        std::string path;
+        LoadPriority priority;
+        uint64_t sequence;
+        std::vector<uint8_t> data;
+        std::string error;
+        uint32_t slot_index;
+        uint32_t generation;
+        std::atomic<LoadState> state {QUEUED};
+        std::atomic_bool is_cancelled {false};
+    };
+
+    /**
+     * This class is the background part of the asynchronous load pipeline of the resource manager. A dedicated I/O
+     * thread reads the files by priority, the workers of the thread pool decode the data and the decoded loads are
+     * queued for the finalization by the resource manager.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class ResourceLoader final {
+        struct RequestOrder {
+            [[nodiscard]] auto operator()(const std::shared_ptr<ResourceLoadRequest>& left,
+                                          const std::shared_ptr<ResourceLoadRequest>& right) const noexcept -> bool {
+                if(left->priority != right->priority) {
+                    return left->priority < right->priority;
+                }
+                return left->sequence > right->sequence;
+            }
+        };
+
+        const ResourceManager* _resource_manager;
+        ThreadPool* _thread_pool;
+        std::priority_queue<std::shared_ptr<ResourceLoadRequest>, std::vector<std::shared_ptr<ResourceLoadRequest>>,
+                            RequestOrder>
+                _read_queue {};
+        std::vector<std::shared_ptr<ResourceLoadRequest>> _finalize_queue {};
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        uint64_t _next_sequence;
+        uint32_t _decoding_count;
+        bool _is_stopping;
+        std::thread _io_thread;
+
+        auto run_io_thread() noexcept -> void;
+        auto decode(const std::shared_ptr<ResourceLoadRequest>& request) noexcept -> void;
+        auto queue_finalize(std::shared_ptr<ResourceLoadRequest> request) noexcept -> void;
+
+        public:
+        /**
+         * This constructor creates the loader and starts the I/O thread of it.
+         *
+         * @param resource_manager The resource manager, which is passed to the resources while decoding
+         * @param thread_pool      The thread pool, which decodes the resources
+         *
+         * @author                 Cedric Hammes
+         * @since                  16/10/2026
+         */
+        ResourceLoader(const ResourceManager& resource_manager, ThreadPool& thread_pool);
+        ~ResourceLoader() noexcept;
+        KSTD_NO_MOVE_COPY(ResourceLoader, ResourceLoader);
+
+        /**
+         * This function queues the specified load for the I/O thread.
+         *
+         * @param request The load request
+         *
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        auto enqueue(std::shared_ptr<ResourceLoadRequest> request) noexcept -> void;
+
+        /**
+         * This function removes up to the specified count of decoded loads from the finalize queue. The loads with
+         * the highest priority are returned first.
+         *
+         * @param max_count The maximum count of loads
+         * @return          The decoded loads
+         *
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        [[nodiscard]] auto take_decoded(uint32_t max_count) noexcept
+                -> std::vector<std::shared_ptr<ResourceLoadRequest>>;
+
+        /**
+         * This function cancels all queued and decoded loads, stops the I/O thread and waits for the loads, which
+         * are decoded by the workers. The loader can't be used after it was stopped.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        auto stop() noexcept -> void;
+    };
+}// namespace aetherium
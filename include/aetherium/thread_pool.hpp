@@ -0,0 +1,80 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <kstd/defaults.hpp>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace aetherium {
+    /**
+     * This class is a fixed-size pool of worker threads. Tasks are submitted into a shared queue and the result of a
+     * task is returned by a future.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class ThreadPool final {
+        std::vector<std::thread> _workers {};
+        std::deque<std::function<void()>> _tasks {};
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        bool _is_stopping;
+
+        auto run_worker() noexcept -> void;
+        auto enqueue(std::function<void()> task) noexcept -> void;
+
+        public:
+        /**
+         * This constructor creates the thread pool with the specified count of worker threads. If the count is zero,
+         * one worker per hardware thread is created.
+         *
+         * @param thread_count The count of worker threads
+         *
+         * @author             Cedric Hammes
+         * @since              16/10/2026
+         */
+        explicit ThreadPool(uint32_t thread_count = 0);
+        ~ThreadPool() noexcept;
+        KSTD_NO_MOVE_COPY(ThreadPool, ThreadPool);
+
+        /**
+         * This function enqueues the specified function into the pool and returns the future of the result.
+         *
+         * @tparam F       The function type
+         * @param function The function, which is executed by a worker
+         * @return         The future of the result of the function
+         *
+         * @author         Cedric Hammes
+         * @since          16/10/2026
+         */
+        template<typename F>
+        [[nodiscard]] auto submit(F&& function) noexcept -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+            using ReturnType = std::invoke_result_t<std::decay_t<F>>;
+            auto task = std::make_shared<std::packaged_task<ReturnType()>>(std::forward<F>(function));
+            auto future = task->get_future();
+            enqueue([task]() { (*task)(); });
+            return future;
+        }
+
+        [[nodiscard]] auto get_thread_count() const noexcept -> uint32_t;
+    };
+}// namespace aetherium
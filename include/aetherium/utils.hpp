@@ -16,6 +16,7 @@
 #include <fmt/format.h>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <volk.h>
 
 #define UNUSED_PARAMETER(x) (void) (x)
@@ -30,15 +31,43 @@
         return kstd::Error {fmt::format((m), get_vulkan_error_message(result))};                                       \
     }
 
+namespace aetherium {
+    constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325ull;
+    constexpr uint64_t FNV_PRIME = 0x100000001B3ull;
+
+    /**
+     * This function hashes the specified data with the 64-bit FNV-1a hash. The hash is stable across runs and
+     * platforms, so it can be used as key for on-disk caches. The previous hash can be passed to hash multiple parts.
+     *
+     * @param data The data, which gets hashed
+     * @param hash The previous hash or the offset basis
+     * @return     The hash of the data
+     *
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    [[nodiscard]] constexpr auto fnv1a_hash(std::string_view data, uint64_t hash = FNV_OFFSET_BASIS) noexcept
+            -> uint64_t {
+        for(const auto character : data) {
+            hash ^= static_cast<uint8_t>(character);
+            hash *= FNV_PRIME;
+        }
+        return hash;
+    }
+}// namespace aetherium
+
 namespace aetherium::renderer {
     [[nodiscard]] constexpr auto get_vulkan_error_message(const VkResult result) noexcept -> std::string_view {
         switch(result) {
             case VK_SUCCESS: return "Success";
+            case VK_TIMEOUT: return "Timeout";
+            case VK_NOT_READY: return "Not ready";
             case VK_ERROR_LAYER_NOT_PRESENT: return "Layer not present";
             case VK_ERROR_EXTENSION_NOT_PRESENT: return "Extension not present";
             case VK_ERROR_INITIALIZATION_FAILED: return "Initialization failed";
             case VK_ERROR_OUT_OF_HOST_MEMORY: return "Out of host memory";
             case VK_ERROR_OUT_OF_DEVICE_MEMORY: return "Out of device memory";
+            case VK_ERROR_DEVICE_LOST: return "Device lost";
             default: return "Unknown";
         }
     }
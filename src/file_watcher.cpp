@@ -0,0 +1,192 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "aetherium/file_watcher.hpp"
+#include <fmt/format.h>
+#include <spdlog/spdlog.h>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace aetherium {
+    /**
+     * This constructor creates the watcher without any watched directories.
+     *
+     * @param debounce_time The time without events, after which a changed file is reported
+     *
+     * @author              Cedric Hammes
+     * @since               16/10/2026
+     */
+    FileWatcher::FileWatcher(std::chrono::milliseconds debounce_time) noexcept :
+#ifdef __linux__
+            _inotify_handle {inotify_init1(IN_NONBLOCK | IN_CLOEXEC)},
+#else
+            _inotify_handle {-1},
+#endif
+            _debounce_time {debounce_time} {
+    }
+
+    FileWatcher::~FileWatcher() noexcept {
+#ifdef __linux__
+        if(_inotify_handle >= 0) {
+            close(_inotify_handle);
+        }
+#endif
+    }
+
+    auto FileWatcher::watch_directory(const std::filesystem::path& directory) noexcept -> kstd::Result<void> {
+#ifdef __linux__
+        constexpr auto event_mask = IN_CLOSE_WRITE | IN_MODIFY | IN_MOVED_TO | IN_CREATE | IN_DELETE;
+        const auto watch_handle = inotify_add_watch(_inotify_handle, directory.c_str(), event_mask);
+        if(watch_handle < 0) {
+            return kstd::Error {fmt::format("Unable to watch directory '{}': {}", directory.string(),
+                                            std::strerror(errno))};
+        }
+        _watched_directories[watch_handle] = directory.lexically_normal();
+
+        std::error_code error_code {};
+        for(const auto& entry : std::filesystem::directory_iterator {directory, error_code}) {
+            if(!entry.is_directory(error_code)) {
+                continue;
+            }
+            if(const auto watch_result = watch_directory(entry.path()); watch_result.is_error()) {
+                return watch_result;
+            }
+        }
+        return {};
+#else
+        return kstd::Error {fmt::format("Unable to watch directory '{}': File watching isn't supported on this "
+                                        "platform",
+                                        directory.string())};
+#endif
+    }
+
+    auto FileWatcher::read_events() noexcept -> void {
+#ifdef __linux__
+        alignas(inotify_event) char buffer[4096];
+        while(true) {
+            const auto length = read(_inotify_handle, buffer, sizeof(buffer));
+            if(length <= 0) {
+                return;
+            }
+
+            const auto now = std::chrono::steady_clock::now();
+            for(auto* data = buffer; data < buffer + length;) {
+                const auto* event = reinterpret_cast<const inotify_event*>(data);
+                data += sizeof(inotify_event) + event->len;
+
+                // The kernel dropped events, so the changed files are unknown and every watched file is reported
+                if((event->mask & IN_Q_OVERFLOW) != 0) {
+                    SPDLOG_WARN("The file watcher missed events, all watched files are reported as changed");
+                    rescan(now);
+                    continue;
+                }
+
+                if((event->mask & IN_IGNORED) != 0) {
+                    _watched_directories.erase(event->wd);
+                    continue;
+                }
+
+                const auto directory = _watched_directories.find(event->wd);
+                if(directory == _watched_directories.end() || event->len == 0) {
+                    continue;
+                }
+
+                // New directories are watched, so files created in them are reported too
+                const auto path = directory->second / event->name;
+                if((event->mask & IN_ISDIR) != 0) {
+                    if((event->mask & (IN_CREATE | IN_MOVED_TO)) != 0) {
+                        static_cast<void>(watch_directory(path));
+                    }
+                    continue;
+                }
+                _pending_changes[path.string()] = now;
+            }
+        }
+#endif
+    }
+
+    auto FileWatcher::rescan(std::chrono::steady_clock::time_point now) noexcept -> void {
+        std::vector<std::filesystem::path> directories {};
+        phmap::flat_hash_set<std::string> known_directories {};
+        directories.reserve(_watched_directories.size());
+        for(const auto& [watch_handle, directory] : _watched_directories) {
+            directories.push_back(directory);
+            known_directories.insert(directory.string());
+        }
+
+        // Directories, which were created while the events were dropped, are watched and scanned too
+        std::error_code error_code {};
+        for(size_t i = 0; i < directories.size(); i++) {
+            for(const auto& entry : std::filesystem::directory_iterator {directories[i], error_code}) {
+                if(entry.is_regular_file(error_code)) {
+                    _pending_changes[entry.path().string()] = now;
+                    continue;
+                }
+                if(!entry.is_directory(error_code) || !known_directories.insert(entry.path().string()).second) {
+                    continue;
+                }
+                static_cast<void>(watch_directory(entry.path()));
+                directories.push_back(entry.path());
+            }
+        }
+    }
+
+    /**
+     * This function starts watching the specified directory and all subdirectories of it. Subdirectories, which are
+     * created later, are watched automatically.
+     *
+     * @param directory The directory to watch
+     * @return          Success or an error
+     *
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto FileWatcher::watch(const std::filesystem::path& directory) noexcept -> kstd::Result<void> {
+        using namespace std::string_literals;
+        if(_inotify_handle < 0) {
+            return kstd::Error {"Unable to watch directory: The file watcher isn't initialized"s};
+        }
+        return watch_directory(directory);
+    }
+
+    /**
+     * This function reads the pending events and returns the normalized paths of all changed files, which received
+     * no events within the debounce time. The returned files are removed from the pending changes.
+     *
+     * @return The paths of the changed files
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto FileWatcher::take_changes() noexcept -> std::vector<std::filesystem::path> {
+        read_events();
+
+        std::vector<std::filesystem::path> changes {};
+        const auto now = std::chrono::steady_clock::now();
+        for(auto iterator = _pending_changes.begin(); iterator != _pending_changes.end();) {
+            if(now - iterator->second < _debounce_time) {
+                ++iterator;
+                continue;
+            }
+            changes.emplace_back(iterator->first);
+            _pending_changes.erase(iterator++);
+        }
+        return changes;
+    }
+}// namespace aetherium
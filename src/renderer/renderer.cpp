@@ -17,160 +17,342 @@
 #include <array>
 
 namespace aetherium::renderer {
-    VulkanRenderer::VulkanRenderer(vulkan::VulkanContext& context) :
-            _vulkan_context {context},
-            _vulkan_device {} {
-        _vulkan_device =
-                std::move(context.find_device(vulkan::DeviceSearchStrategy::HIGHEST_PERFORMANCE).get_or_throw());
-        _command_pool = vulkan::CommandPool {&_vulkan_device};
-        _command_buffer = std::move(_command_pool.allocate_command_buffers(1).get_or_throw().at(0));
-        _swapchain = vulkan::Swapchain {context, &_vulkan_device};
+    /**
+     * This constructor creates the command pool, command buffer and the binary semaphores for the swapchain acquire and
+     * present of the frame.
+     *
+     * @param vulkan_device       The device on which the objects are created
+     * @param uniform_buffer_size The size of the uniform buffer of the frame
+     *
+     * @author                    Cedric Hammes
+     * @since                     16/10/2026
+     */
+    RenderFrame::RenderFrame(const vulkan::VulkanDevice* vulkan_device, VkDeviceSize uniform_buffer_size) :
+            _vulkan_device {vulkan_device},
+            _command_pool {vulkan_device, vulkan::GRAPHICS, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT},
+            _image_available_semaphore {nullptr},
+            _rendering_done_semaphore {nullptr},
+            _timeline_value {0},
+            _command_pool_registry {vulkan_device->get_virtual_device()},
+            _uniform_allocator {vulkan_device, uniform_buffer_size},
+            _descriptor_allocator {vulkan_device},
+            _render_graph {vulkan_device},
+            _backbuffer {0} {
+        _command_buffer = std::move(_command_pool.acquire_command_buffer().get_or_throw());
 
         // Create semaphores
         VkSemaphoreCreateInfo semaphore_create_info {};
         semaphore_create_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
-        VK_CHECK_EX(vkCreateSemaphore(_vulkan_device.get_virtual_device(), &semaphore_create_info, nullptr,
+        VK_CHECK_EX(vkCreateSemaphore(_vulkan_device->get_virtual_device(), &semaphore_create_info, nullptr,
                                       &_image_available_semaphore),
-                    "Unable to create device: {}")
-        VK_CHECK_EX(vkCreateSemaphore(_vulkan_device.get_virtual_device(), &semaphore_create_info, nullptr,
+                    "Unable to create frame: {}")
+        VK_CHECK_EX(vkCreateSemaphore(_vulkan_device->get_virtual_device(), &semaphore_create_info, nullptr,
                                       &_rendering_done_semaphore),
-                    "Unable to create device: {}")
+                    "Unable to create frame: {}")
+    }
+
+    RenderFrame::~RenderFrame() noexcept {
+        if(_image_available_semaphore != nullptr) {
+            vkDestroySemaphore(_vulkan_device->get_virtual_device(), _image_available_semaphore, nullptr);
+            _image_available_semaphore = nullptr;
+        }
+
+        if(_rendering_done_semaphore != nullptr) {
+            vkDestroySemaphore(_vulkan_device->get_virtual_device(), _rendering_done_semaphore, nullptr);
+            _rendering_done_semaphore = nullptr;
+        }
+    }
+
+    VulkanRenderer::VulkanRenderer(vulkan::VulkanContext& context, const RendererOptions& options) :
+            _vulkan_context {context},
+            _vulkan_device {},
+            _frame_counter {0},
+            _current_frame {0},
+            _is_frame_begun {false},
+            _recording_pool {std::make_unique<ThreadPool>(options.recording_threads)} {
+        using namespace std::string_literals;
+
+        if(options.frames_in_flight == 0) {
+            throw std::runtime_error {"Unable to create renderer: At least one frame in flight is required"s};
+        }
+
+        _vulkan_device =
+                std::move(context.find_device(vulkan::DeviceSearchStrategy::HIGHEST_PERFORMANCE).get_or_throw());
+        _swapchain = vulkan::Swapchain {context, &_vulkan_device, options.swapchain};
+        _frame_timeline = vulkan::TimelineSemaphore {&_vulkan_device, _frame_counter};
+
+        // Create frames
+        _frames.reserve(options.frames_in_flight);
+        for(uint32_t i = 0; i < options.frames_in_flight; i++) {
+            _frames.push_back(std::make_unique<RenderFrame>(&_vulkan_device, options.uniform_buffer_size));
+        }
+        _pipeline_cache = std::make_unique<vulkan::PipelineCache>(&_vulkan_device, options.pipeline_cache_path,
+                                                                  options.pipeline_compile_threads);
+        _pipeline_layout_cache = std::make_unique<vulkan::PipelineLayoutCache>(&_vulkan_device);
+        _pipeline_manager = std::make_unique<vulkan::PipelineManager>(&_vulkan_device, _pipeline_cache.get());
+        if(options.bindless) {
+            _bindless_heap = std::make_unique<vulkan::BindlessHeap>(&_vulkan_device, options.bindless_limits,
+                                                                    options.frames_in_flight);
+        }
+        _descriptor_set_cache = std::make_unique<vulkan::DescriptorSetCache>(&_vulkan_device);
     }
 
     VulkanRenderer::VulkanRenderer(aetherium::renderer::VulkanRenderer&& other) noexcept :
             _vulkan_context {other._vulkan_context},
             _vulkan_device {std::move(other._vulkan_device)},
-            _command_pool {std::move(other._command_pool)},
-            _command_buffer {std::move(other._command_buffer)},
             _swapchain {std::move(other._swapchain)},
-            _image_available_semaphore {other._image_available_semaphore},
-            _rendering_done_semaphore {other._rendering_done_semaphore} {
-        other._image_available_semaphore = nullptr;
-        other._rendering_done_semaphore = nullptr;
+            _frame_timeline {std::move(other._frame_timeline)},
+            _frame_counter {other._frame_counter},
+            _frames {std::move(other._frames)},
+            _current_frame {other._current_frame},
+            _is_frame_begun {other._is_frame_begun},
+            _recording_pool {std::move(other._recording_pool)},
+            _draw_recorders {std::move(other._draw_recorders)},
+            _pipeline_cache {std::move(other._pipeline_cache)},
+            _pipeline_layout_cache {std::move(other._pipeline_layout_cache)},
+            _pipeline_manager {std::move(other._pipeline_manager)},
+            _bindless_heap {std::move(other._bindless_heap)},
+            _descriptor_set_cache {std::move(other._descriptor_set_cache)} {
+        other._frame_counter = 0;
+        other._current_frame = 0;
     }
 
     VulkanRenderer::~VulkanRenderer() noexcept {
-        if(_image_available_semaphore != nullptr) {
-            vkDestroySemaphore(_vulkan_device.get_virtual_device(), _image_available_semaphore, nullptr);
-            _image_available_semaphore = nullptr;
+        // Wait for all frames in flight before the frame objects get destroyed
+        if(_vulkan_device.get_virtual_device() != nullptr) {
+            vkDeviceWaitIdle(_vulkan_device.get_virtual_device());
+        }
+    }
+
+    /**
+     * This function waits until the GPU is done with the frame slot, which is recorded next, resets its per-frame
+     * resources and acquires the next swapchain image as backbuffer of the render graph. The function must be called
+     * before allocating from the uniform allocator or adding passes to the render graph of the frame, otherwise it is
+     * called by the render function. If the swapchain is out of date, it's recreated. While the window is minimized,
+     * no frame is begun and the render function skips the frame.
+     *
+     * @return Success or error
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto VulkanRenderer::begin_frame() noexcept -> kstd::Result<void> {
+        using namespace std::string_literals;
+        if(_is_frame_begun) {
+            return {};
         }
 
-        if(_rendering_done_semaphore != nullptr) {
-            vkDestroySemaphore(_vulkan_device.get_virtual_device(), _rendering_done_semaphore, nullptr);
-            _rendering_done_semaphore = nullptr;
+        auto& frame = *_frames.at(_current_frame);
+
+        // Wait until the GPU has finished the last submit of this frame
+        if(const auto wait_result = _frame_timeline.wait(frame._timeline_value); wait_result.is_error()) {
+            return wait_result;
+        }
+
+        // The GPU is done with the secondary command buffers and the constants of this frame, so both can be reused
+        if(const auto reset_result = frame._command_pool_registry.reset(); reset_result.is_error()) {
+            return reset_result;
+        }
+        frame._uniform_allocator.reset();
+        if(const auto reset_result = frame._descriptor_allocator.reset(); reset_result.is_error()) {
+            return reset_result;
+        }
+        if(_bindless_heap != nullptr) {
+            _bindless_heap->next_frame();
+        }
+
+        frame._render_graph.reset();
+        frame._main_pass_inputs.clear();
+
+        // Acquire the swapchain image and recreate the swapchain, if the window was resized or the swapchain is out
+        // of date. While the window is minimized, no image is acquired and the frame is skipped.
+        auto is_image_acquired = false;
+        for(uint32_t attempt = 0; attempt < 2 && !is_image_acquired; attempt++) {
+            if(_swapchain.is_out_of_date()) {
+                if(const auto recreate_result = _swapchain.recreate(); recreate_result.is_error()) {
+                    return recreate_result;
+                }
+                if(_swapchain.is_out_of_date()) {
+                    return {};
+                }
+            }
+
+            const auto next_image_result = _swapchain.next_image(frame._image_available_semaphore);
+            if(next_image_result.is_error()) {
+                return kstd::Error {next_image_result.get_error()};
+            }
+            is_image_acquired = *next_image_result;
+        }
+        if(!is_image_acquired) {
+            return {};
         }
+
+        // Import the swapchain image into the render graph of the frame as backbuffer
+        vulkan::RenderGraphImportInfo backbuffer_import_info {};
+        backbuffer_import_info.image = _swapchain.current_image();
+        backbuffer_import_info.image_view = _swapchain.current_image_view();
+        backbuffer_import_info.format = _swapchain.get_format();
+        backbuffer_import_info.extent = _swapchain.get_extent();
+        backbuffer_import_info.initial_layout = VK_IMAGE_LAYOUT_UNDEFINED;
+        backbuffer_import_info.initial_stage = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT;
+        backbuffer_import_info.final_layout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        frame._backbuffer = frame._render_graph.import_image("backbuffer"s, backbuffer_import_info);
+        _is_frame_begun = true;
+        return {};
     }
 
     auto VulkanRenderer::render() noexcept -> kstd::Result<void> {
-        VK_CHECK(vkResetCommandPool(_vulkan_device.get_virtual_device(), *_command_pool,
-                                    VK_COMMAND_POOL_RESET_RELEASE_RESOURCES_BIT),
-                 "Unable to render: {}")
-        VK_CHECK(vkResetCommandBuffer(*_command_buffer, VK_COMMAND_BUFFER_RESET_RELEASE_RESOURCES_BIT),
-                 "Unable to render: {}")
-        auto command_buffer = *_command_buffer;
+        if(const auto begin_result = begin_frame(); begin_result.is_error()) {
+            return begin_result;
+        }
+        if(!_is_frame_begun) {
+            return {};
+        }
 
-        if(const auto next_image_result = _swapchain.next_image(_image_available_semaphore);
-           next_image_result.is_error()) {
-            return next_image_result;
+        using namespace std::string_literals;
+        auto& frame = *_frames.at(_current_frame);
+
+        // Reset the whole frame pool at once but keep its memory, the command buffer is recycled from the free list
+        if(const auto reset_result = frame._command_pool.reset(); reset_result.is_error()) {
+            return reset_result;
+        }
+        auto acquire_result = frame._command_pool.acquire_command_buffer();
+        if(acquire_result.is_error()) {
+            return kstd::Error {acquire_result.get_error()};
         }
+        frame._command_buffer = std::move(*acquire_result);
+        auto command_buffer = *frame._command_buffer;
 
         // Begin command buffer
-        if(const auto begin_result = _command_buffer.begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+        if(const auto begin_result = frame._command_buffer.begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
            begin_result.is_error()) {
             return begin_result;
         }
 
-        VkImageMemoryBarrier image_memory_barrier {};
-        image_memory_barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-        image_memory_barrier.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
-        image_memory_barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        image_memory_barrier.newLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-        image_memory_barrier.image = _swapchain.current_image();
-        image_memory_barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-        image_memory_barrier.subresourceRange.baseMipLevel = 0;
-        image_memory_barrier.subresourceRange.levelCount = 1;
-        image_memory_barrier.subresourceRange.baseArrayLayer = 0;
-        image_memory_barrier.subresourceRange.layerCount = 1;
-        vkCmdPipelineBarrier(*_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
-                             VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, 0, 0, nullptr, 0, nullptr, 1,
-                             &image_memory_barrier);
-
-        // Get window bounds
-        int32_t width = 0;
-        int32_t height = 1;
-        SDL_GetWindowSize(_vulkan_context.get_window()->get_window_handle(), &width, &height);
-        VkExtent2D window_size {static_cast<uint32_t>(width), static_cast<uint32_t>(height)};
-
-        // Get rendering info
-        VkRenderingAttachmentInfo attachment_info {};
-        attachment_info.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO;
-        attachment_info.imageView = _swapchain.current_image_view();
-        attachment_info.imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-        attachment_info.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-        attachment_info.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
-        attachment_info.clearValue.color.float32[0] = 0.0f;
-        attachment_info.clearValue.color.float32[1] = 0.0f;
-        attachment_info.clearValue.color.float32[2] = 0.0f;
-        attachment_info.clearValue.color.float32[3] = 1.0f;
-
-        VkRenderingInfo rendering_info {};
-        rendering_info.sType = VK_STRUCTURE_TYPE_RENDERING_INFO;
-        rendering_info.renderArea.extent = window_size;
-        rendering_info.colorAttachmentCount = 1;
-        rendering_info.pColorAttachments = &attachment_info;
-        rendering_info.layerCount = 1;
-
-        vkCmdBeginRendering(*_command_buffer, &rendering_info);
-        // TODO: Render
-        vkCmdEndRendering(*_command_buffer);
-
-        image_memory_barrier = {};
-        image_memory_barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-        image_memory_barrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
-        image_memory_barrier.oldLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-        image_memory_barrier.newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
-        image_memory_barrier.image = _swapchain.current_image();
-        image_memory_barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-        image_memory_barrier.subresourceRange.baseMipLevel = 0;
-        image_memory_barrier.subresourceRange.levelCount = 1;
-        image_memory_barrier.subresourceRange.baseArrayLayer = 0;
-        image_memory_barrier.subresourceRange.layerCount = 1;
-        vkCmdPipelineBarrier(*_command_buffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
-                             VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &image_memory_barrier);
+        // Record the draw recorders in parallel, they are executed by the main pass in the order of insertion
+        std::vector<VkCommandBuffer> secondary_command_buffers {};
+        if(!_draw_recorders.empty()) {
+            const auto color_attachment_format = _swapchain.get_format();
+            VkCommandBufferInheritanceRenderingInfo inheritance_rendering_info {};
+            inheritance_rendering_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO;
+            inheritance_rendering_info.colorAttachmentCount = 1;
+            inheritance_rendering_info.pColorAttachmentFormats = &color_attachment_format;
+            inheritance_rendering_info.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+            auto record_result = vulkan::record_secondary_command_buffers(
+                    *_recording_pool, frame._command_pool_registry, frame._command_pool.get_queue_family_index(),
+                    inheritance_rendering_info, _draw_recorders);
+            if(record_result.is_error()) {
+                return kstd::Error {record_result.get_error()};
+            }
+            secondary_command_buffers = std::move(*record_result);
+        }
+
+        // The main pass renders into the backbuffer, the graph generates the layout transitions around it
+        auto& main_pass = frame._render_graph.add_pass("main"s, vulkan::GRAPHICS_PASS);
+        main_pass.write(frame._backbuffer, vulkan::COLOR_ATTACHMENT);
+        for(const auto& [resource, usage] : frame._main_pass_inputs) {
+            main_pass.read(resource, usage);
+        }
+        main_pass.set_execute_function([&](VkCommandBuffer pass_command_buffer, const vulkan::RenderGraph& graph) {
+            VkRenderingAttachmentInfo attachment_info {};
+            attachment_info.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO;
+            attachment_info.imageView = graph.get_image_view(frame._backbuffer);
+            attachment_info.imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+            attachment_info.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+            attachment_info.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+            attachment_info.clearValue.color.float32[0] = 0.0f;
+            attachment_info.clearValue.color.float32[1] = 0.0f;
+            attachment_info.clearValue.color.float32[2] = 0.0f;
+            attachment_info.clearValue.color.float32[3] = 1.0f;
+
+            VkRenderingInfo rendering_info {};
+            rendering_info.sType = VK_STRUCTURE_TYPE_RENDERING_INFO;
+            rendering_info.renderArea.extent = graph.get_extent(frame._backbuffer);
+            rendering_info.colorAttachmentCount = 1;
+            rendering_info.pColorAttachments = &attachment_info;
+            rendering_info.layerCount = 1;
+            if(!secondary_command_buffers.empty()) {
+                rendering_info.flags = VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT;
+            }
+
+            vkCmdBeginRendering(pass_command_buffer, &rendering_info);
+            if(!secondary_command_buffers.empty()) {
+                vkCmdExecuteCommands(pass_command_buffer, static_cast<uint32_t>(secondary_command_buffers.size()),
+                                     secondary_command_buffers.data());
+            }
+            vkCmdEndRendering(pass_command_buffer);
+        });
+
+        if(const auto compile_result = frame._render_graph.compile(); compile_result.is_error()) {
+            return compile_result;
+        }
+        if(const auto execute_result = frame._render_graph.execute(command_buffer); execute_result.is_error()) {
+            return execute_result;
+        }
 
         // End command buffer
-        if(const auto end_result = _command_buffer.end(); end_result.is_error()) {
+        if(const auto end_result = frame._command_buffer.end(); end_result.is_error()) {
             return end_result;
         }
 
-        VkPipelineStageFlags wait_dst_stage_mask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-        const auto fence = vulkan::VulkanFence {&_vulkan_device};
+        // Submit the command buffers, which were emitted since the last frame, in one batch per queue
+        const auto flush_result = _vulkan_device.flush_command_buffers();
+        if(flush_result.is_error()) {
+            return kstd::Error {flush_result.get_error()};
+        }
+
+        // The frame waits for the last batch of every queue, so the uploads are done before the frame samples them
+        std::vector<VkSemaphore> wait_semaphores {frame._image_available_semaphore};
+        std::vector<VkPipelineStageFlags> wait_dst_stage_masks {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
+        std::vector<uint64_t> wait_values {0};
+        for(const auto& ticket : *flush_result) {
+            if(ticket.get_timeline_semaphore() == VK_NULL_HANDLE) {
+                continue;
+            }
+            wait_semaphores.push_back(ticket.get_timeline_semaphore());
+            wait_dst_stage_masks.push_back(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+            wait_values.push_back(ticket.get_value());
+        }
+
+        // Submit, the binary semaphores are still needed because the swapchain doesn't accept timeline semaphores
+        const auto frame_value = _frame_counter + 1;
+        const std::array<VkSemaphore, 2> signal_semaphores = {frame._rendering_done_semaphore, *_frame_timeline};
+        const std::array<uint64_t, 2> signal_values = {0, frame_value};
+
+        VkTimelineSemaphoreSubmitInfo timeline_submit_info {};
+        timeline_submit_info.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timeline_submit_info.waitSemaphoreValueCount = static_cast<uint32_t>(wait_values.size());
+        timeline_submit_info.pWaitSemaphoreValues = wait_values.data();
+        timeline_submit_info.signalSemaphoreValueCount = static_cast<uint32_t>(signal_values.size());
+        timeline_submit_info.pSignalSemaphoreValues = signal_values.data();
 
         VkSubmitInfo submit_info {};
         submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submit_info.waitSemaphoreCount = 1;
-        submit_info.pWaitSemaphores = &_image_available_semaphore;
-        submit_info.pWaitDstStageMask = &wait_dst_stage_mask;
+        submit_info.pNext = &timeline_submit_info;
+        submit_info.waitSemaphoreCount = static_cast<uint32_t>(wait_semaphores.size());
+        submit_info.pWaitSemaphores = wait_semaphores.data();
+        submit_info.pWaitDstStageMask = wait_dst_stage_masks.data();
         submit_info.commandBufferCount = 1;
         submit_info.pCommandBuffers = &command_buffer;
-        submit_info.signalSemaphoreCount = 1;
-        submit_info.pSignalSemaphores = &_rendering_done_semaphore;
-        VK_CHECK(vkQueueSubmit(_vulkan_device.get_graphics_queue(), 1, &submit_info, *fence), "Unable to submit: {}")
-        if(const auto wait_result = fence.wait_for(); wait_result.is_error()) {
-            return wait_result;
+        submit_info.signalSemaphoreCount = static_cast<uint32_t>(signal_semaphores.size());
+        submit_info.pSignalSemaphores = signal_semaphores.data();
+        if(const auto submit_result = _vulkan_device.get_graphics_queue().submit(&submit_info, 1);
+           submit_result.is_error()) {
+            return submit_result;
         }
+        _frame_counter = frame_value;
+        frame._timeline_value = frame_value;
 
-        auto current_image_index = _swapchain.current_image_index();
-        auto raw_swapchain_handle = *_swapchain;
-        VkPresentInfoKHR present_info {};
-        present_info.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
-        present_info.waitSemaphoreCount = 1;
-        present_info.pWaitSemaphores = &_rendering_done_semaphore;
-        present_info.swapchainCount = 1;
-        present_info.pSwapchains = &raw_swapchain_handle;
-        present_info.pImageIndices = &current_image_index;
-        VK_CHECK(vkQueuePresentKHR(_vulkan_device.get_graphics_queue(), &present_info), "Unable to present queue: {}")
+        // An out of date swapchain is recreated, when the next frame is begun
+        if(const auto present_result =
+                   _swapchain.present(_vulkan_device.get_graphics_queue(), frame._rendering_done_semaphore);
+           present_result.is_error()) {
+            return present_result;
+        }
 
+        _current_frame = (_current_frame + 1) % static_cast<uint32_t>(_frames.size());
+        _is_frame_begun = false;
         return {};
     }
 
@@ -178,33 +360,189 @@ namespace aetherium::renderer {
         return _vulkan_device;
     }
 
+    auto VulkanRenderer::get_frames_in_flight() const noexcept -> uint32_t {
+        return static_cast<uint32_t>(_frames.size());
+    }
+
+    auto VulkanRenderer::get_frame_timeline() const noexcept -> const vulkan::TimelineSemaphore& {
+        return _frame_timeline;
+    }
+
+    /**
+     * This function returns the uniform allocator of the frame, which is recorded next. The allocations are valid until
+     * the frame slot is reused, so they can be referenced by the draws of the current frame. The frame has to be begun
+     * before the first allocation.
+     *
+     * @return The uniform allocator of the current frame
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto VulkanRenderer::get_uniform_allocator() noexcept -> vulkan::UniformAllocator& {
+        return _frames.at(_current_frame)->_uniform_allocator;
+    }
+
+    /**
+     * This function returns the descriptor allocator of the frame, which is recorded next. All descriptor sets of the
+     * allocator are freed at once, when the frame slot is reused, so the sets must only be used by the draws of the
+     * current frame. The frame has to be begun before the first allocation.
+     *
+     * @return The descriptor allocator of the current frame
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto VulkanRenderer::get_descriptor_allocator() noexcept -> vulkan::DescriptorAllocator& {
+        return _frames.at(_current_frame)->_descriptor_allocator;
+    }
+
+    /**
+     * This function returns the render graph of the frame, which is recorded next. Passes, which are added after the
+     * frame was begun, are executed before the main pass, which executes the draw recorders. The frame has to be begun
+     * before the first pass is added.
+     *
+     * @return The render graph of the current frame
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto VulkanRenderer::get_render_graph() noexcept -> vulkan::RenderGraph& {
+        return _frames.at(_current_frame)->_render_graph;
+    }
+
+    auto VulkanRenderer::get_backbuffer() const noexcept -> vulkan::RenderGraphResource {
+        return _frames.at(_current_frame)->_backbuffer;
+    }
+
+    /**
+     * This function declares that the main pass of the current frame reads the specified image of the render graph,
+     * so the pass, which writes the image, isn't culled and the image is transitioned before the draw recorders run.
+     *
+     * @param resource The image, which is read by the main pass
+     * @param usage    How the main pass uses the image
+     *
+     * @author         Cedric Hammes
+     * @since          16/10/2026
+     */
+    auto VulkanRenderer::add_main_pass_input(vulkan::RenderGraphResource resource,
+                                             vulkan::RenderGraphUsage usage) noexcept -> void {
+        _frames.at(_current_frame)->_main_pass_inputs.emplace_back(resource, usage);
+    }
+
+    /**
+     * This function returns the descriptor set cache of the renderer, which shares the immutable descriptor sets
+     * between all requests with the same layout and descriptors.
+     *
+     * @return The descriptor set cache of the renderer
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto VulkanRenderer::get_descriptor_set_cache() const noexcept -> vulkan::DescriptorSetCache& {
+        return *_descriptor_set_cache;
+    }
+
+    /**
+     * This function returns the pipeline cache of the renderer. Pipelines should be created through the compile
+     * threads of the cache while loading, so the first frame, which uses them, doesn't stall.
+     *
+     * @return The pipeline cache of the renderer
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto VulkanRenderer::get_pipeline_cache() const noexcept -> vulkan::PipelineCache& {
+        return *_pipeline_cache;
+    }
+
+    /**
+     * This function returns the pipeline manager of the renderer, which shares one pipeline between all requests with
+     * the same pipeline state.
+     *
+     * @return The pipeline manager of the renderer
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto VulkanRenderer::get_pipeline_manager() const noexcept -> vulkan::PipelineManager& {
+        return *_pipeline_manager;
+    }
+
+    /**
+     * This function returns the layout cache of the renderer, which creates the pipeline layouts by the reflection of
+     * the shaders and shares them between all pipelines with the same interface.
+     *
+     * @return The pipeline layout cache of the renderer
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto VulkanRenderer::get_pipeline_layout_cache() const noexcept -> vulkan::PipelineLayoutCache& {
+        return *_pipeline_layout_cache;
+    }
+
+    /**
+     * This function returns the bindless descriptor heap of the renderer. In bindless mode, all pipelines use the
+     * pipeline layout of the heap and the draws select their resources by the indices in the push constants. This
+     * function must only be called, if the renderer was created with the bindless option.
+     *
+     * @return The bindless descriptor heap of the renderer
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto VulkanRenderer::get_bindless_heap() const noexcept -> vulkan::BindlessHeap& {
+        return *_bindless_heap;
+    }
+
+    auto VulkanRenderer::is_bindless() const noexcept -> bool {
+        return _bindless_heap != nullptr;
+    }
+
+    /**
+     * This function adds a draw recorder to the renderer. Every frame, each draw recorder records into its own
+     * secondary command buffer on one of the recording threads and the buffers are executed in the order of insertion
+     * inside the rendering of the swapchain image.
+     *
+     * @param recorder The function, which records the draw commands
+     *
+     * @author         Cedric Hammes
+     * @since          16/10/2026
+     */
+    auto VulkanRenderer::add_draw_recorder(vulkan::RecordFunction recorder) noexcept -> void {
+        _draw_recorders.push_back(std::move(recorder));
+    }
+
+    /**
+     * This function removes all draw recorders from the renderer.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto VulkanRenderer::clear_draw_recorders() noexcept -> void {
+        _draw_recorders.clear();
+    }
+
     auto VulkanRenderer::operator=(aetherium::renderer::VulkanRenderer&& other) noexcept -> VulkanRenderer& {
-        _vulkan_context = std::move(other._vulkan_context);
-        _vulkan_device = std::move(other._vulkan_device);
-        _command_pool = std::move(other._command_pool);
-        _command_buffer = std::move(other._command_buffer);
+        // The members are replaced in the reverse order of their dependencies, so the old frames, swapchain and
+        // pipelines are destroyed while the device, on which they were created, is still alive
+        _draw_recorders = std::move(other._draw_recorders);
+        _recording_pool = std::move(other._recording_pool);
+        _frames = std::move(other._frames);
+        _frame_counter = other._frame_counter;
+        _current_frame = other._current_frame;
+        _is_frame_begun = other._is_frame_begun;
+        _frame_timeline = std::move(other._frame_timeline);
         _swapchain = std::move(other._swapchain);
-        _image_available_semaphore = other._image_available_semaphore;
-        _rendering_done_semaphore = other._rendering_done_semaphore;
+        _descriptor_set_cache = std::move(other._descriptor_set_cache);
+        _bindless_heap = std::move(other._bindless_heap);
+        _pipeline_manager = std::move(other._pipeline_manager);
+        _pipeline_layout_cache = std::move(other._pipeline_layout_cache);
+        _pipeline_cache = std::move(other._pipeline_cache);
+        _vulkan_device = std::move(other._vulkan_device);
+        _vulkan_context = std::move(other._vulkan_context);
+        other._frame_counter = 0;
+        other._current_frame = 0;
         return *this;
     }
-
-    auto access_mask_flags(VkImageLayout old_layout, VkImageLayout new_layout) noexcept
-            -> kstd::Option<kstd::Tuple<VkAccessFlags, VkAccessFlags>> {
-        if(old_layout == VK_IMAGE_LAYOUT_UNDEFINED && new_layout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) {
-            return {{VK_ACCESS_NONE, VK_ACCESS_TRANSFER_WRITE_BIT}};
-        }
-        else if(old_layout == VK_IMAGE_LAYOUT_UNDEFINED && new_layout == VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL) {
-            return {{VK_ACCESS_NONE, VK_ACCESS_NONE}};
-        }
-        else if(old_layout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL &&
-                new_layout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) {
-            return {{VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT}};
-        }
-        else if(old_layout == VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL &&
-                new_layout == VK_IMAGE_LAYOUT_PRESENT_SRC_KHR) {
-            return {{VK_ACCESS_NONE, VK_ACCESS_NONE}};
-        }
-        return kstd::Option<kstd::Tuple<VkAccessFlags, VkAccessFlags>> {};
-    }
 }// namespace aetherium::renderer
\ No newline at end of file
@@ -13,28 +13,485 @@
 // limitations under the License.
 
 #include "aetherium/renderer/shader.hpp"
-
-// TODO: Getter for IR array and * operator overload for Vulkan shader module
+#include "aetherium/renderer/vulkan/device.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <spdlog/spdlog.h>
+#include <thread>
 
 namespace aetherium::renderer {
+    namespace {
+        constexpr std::string_view CACHE_VERSION = "aetherium-spirv-1";
+
+        std::atomic<uint32_t> cache_hits {0};
+        std::atomic<uint32_t> cache_misses {0};
+        std::atomic<uint64_t> warm_nanoseconds {0};
+        std::atomic<uint64_t> cold_nanoseconds {0};
+        std::atomic<uint64_t> next_module_id {1};
+
+        struct IncludedFile {
+            std::string path;
+            uint64_t hash;
+        };
+
+        struct IncludeContext {
+            fs::path include_directory;
+            std::vector<IncludedFile> included_files;
+        };
+
+        struct IncludeData {
+            std::string source_name;
+            std::string content;
+            shaderc_include_result result;
+        };
+
+        auto read_file(const fs::path& path) noexcept -> kstd::Result<std::string> {
+            std::ifstream stream {path, std::ios::binary};
+            if(!stream) {
+                return kstd::Error {fmt::format("Unable to read file '{}'", path.string())};
+            }
+            return std::string {std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+        }
+
+        auto write_file(const fs::path& path, std::string_view data) noexcept -> bool {
+            // Write into a temporary file first, so concurrent readers never see a partially written file
+            const auto thread_hash = std::hash<std::thread::id> {}(std::this_thread::get_id());
+            const auto temporary_path = fs::path {path}.concat(fmt::format(".{:x}.tmp", thread_hash));
+            {
+                std::ofstream stream {temporary_path, std::ios::binary | std::ios::trunc};
+                stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+                if(!stream) {
+                    return false;
+                }
+            }
+
+            std::error_code error_code {};
+            fs::rename(temporary_path, path, error_code);
+            if(error_code) {
+                fs::remove(temporary_path, error_code);
+                return false;
+            }
+            return true;
+        }
+
+        auto get_shader_kind(const fs::path& path) noexcept -> shaderc_shader_kind {
+            const auto extension = path.extension().string();
+            if(extension == ".vert") {
+                return shaderc_glsl_vertex_shader;
+            }
+            else if(extension == ".frag") {
+                return shaderc_glsl_fragment_shader;
+            }
+            else if(extension == ".comp") {
+                return shaderc_glsl_compute_shader;
+            }
+            else if(extension == ".geom") {
+                return shaderc_glsl_geometry_shader;
+            }
+            else if(extension == ".tesc") {
+                return shaderc_glsl_tess_control_shader;
+            }
+            else if(extension == ".tese") {
+                return shaderc_glsl_tess_evaluation_shader;
+            }
+            return shaderc_glsl_infer_from_source;
+        }
+
+        // The cache is located in the base directory, so all paths in the cache are relative to the base directory
+        // and the cache stays valid when the project is moved
+        auto get_cache_path(const fs::path& path, const fs::path& base_directory) noexcept -> std::string {
+            return path.lexically_normal().lexically_relative(base_directory.lexically_normal()).generic_string();
+        }
+
+        auto get_cache_key(const fs::path& path, const fs::path& base_directory, std::string_view source,
+                           shaderc_shader_kind shader_kind, const ShaderCompileOptions& compile_options) noexcept
+                -> uint64_t {
+            auto hash = fnv1a_hash(CACHE_VERSION);
+            hash = fnv1a_hash(source, hash);
+
+            // Relative includes are resolved by the directory of the shader, so the same source in another directory
+            // can include other files
+            hash = fnv1a_hash(fmt::format("directory={};", get_cache_path(path.parent_path(), base_directory)), hash);
+            hash = fnv1a_hash(fmt::format("kind={};optimize={};debug_info={};", static_cast<int32_t>(shader_kind),
+                                          compile_options.optimize, compile_options.generate_debug_info),
+                              hash);
+
+            // The macros are a set, so their order doesn't change the key
+            auto macros = compile_options.macros;
+            std::sort(macros.begin(), macros.end());
+            for(const auto& [name, value] : macros) {
+                hash = fnv1a_hash(fmt::format("{}={};", name, value), hash);
+            }
+            return hash;
+        }
+
+        auto get_include_key(uint64_t hash, std::string_view path, uint64_t content_hash) noexcept -> uint64_t {
+            return fnv1a_hash(fmt::format("{}:{:016x};", path, content_hash), hash);
+        }
+
+        auto load_cached_spirv(const fs::path& base_directory, const fs::path& cache_directory, uint64_t cache_key,
+                               std::vector<fs::path>& include_paths) noexcept -> kstd::Result<std::vector<uint32_t>> {
+            using namespace std::string_literals;
+
+            // The dependency file lists the include closure of the last compile, the key contains their content
+            const auto dependencies = read_file(cache_directory / fmt::format("{:016x}.deps", cache_key));
+            if(dependencies.is_error()) {
+                return kstd::Error {dependencies.get_error()};
+            }
+
+            auto spirv_key = cache_key;
+            std::string_view remaining_dependencies {*dependencies};
+            while(!remaining_dependencies.empty()) {
+                const auto line_end = std::min(remaining_dependencies.find('\n'), remaining_dependencies.size());
+                const auto include_path = remaining_dependencies.substr(0, line_end);
+                remaining_dependencies.remove_prefix(std::min(line_end + 1, remaining_dependencies.size()));
+                if(include_path.empty()) {
+                    continue;
+                }
+
+                const auto absolute_include_path = (base_directory / include_path).lexically_normal();
+                const auto include_content = read_file(absolute_include_path);
+                if(include_content.is_error()) {
+                    return kstd::Error {include_content.get_error()};
+                }
+                spirv_key = get_include_key(spirv_key, include_path, fnv1a_hash(*include_content));
+                include_paths.push_back(absolute_include_path);
+            }
+
+            const auto spirv_data = read_file(cache_directory / fmt::format("{:016x}.spv", spirv_key));
+            if(spirv_data.is_error()) {
+                return kstd::Error {spirv_data.get_error()};
+            }
+            if(spirv_data->empty() || spirv_data->size() % sizeof(uint32_t) != 0) {
+                return kstd::Error {"Unable to load cached SPIR-V: Invalid size"s};
+            }
+
+            std::vector<uint32_t> spirv(spirv_data->size() / sizeof(uint32_t));
+            std::memcpy(spirv.data(), spirv_data->data(), spirv_data->size());
+            return spirv;
+        }
+
+        auto store_cached_spirv(const fs::path& base_directory, const fs::path& cache_directory, uint64_t cache_key,
+                                const std::vector<IncludedFile>& included_files,
+                                const std::vector<uint32_t>& spirv) noexcept -> bool {
+            std::error_code error_code {};
+            fs::create_directories(cache_directory, error_code);
+            if(error_code) {
+                return false;
+            }
+
+            auto spirv_key = cache_key;
+            std::string dependencies {};
+            for(const auto& included_file : included_files) {
+                const auto include_path = get_cache_path(included_file.path, base_directory);
+                spirv_key = get_include_key(spirv_key, include_path, included_file.hash);
+                dependencies.append(include_path).push_back('\n');
+            }
+
+            const std::string_view spirv_data {reinterpret_cast<const char*>(spirv.data()),
+                                               spirv.size() * sizeof(uint32_t)};
+            return write_file(cache_directory / fmt::format("{:016x}.spv", spirv_key), spirv_data) &&
+                   write_file(cache_directory / fmt::format("{:016x}.deps", cache_key), dependencies);
+        }
+
+        auto resolve_include(void* user_data, const char* requested_source, int type, const char* requesting_source,
+                             size_t include_depth) -> shaderc_include_result* {
+            UNUSED_PARAMETER(include_depth);
+            auto* context = static_cast<IncludeContext*>(user_data);
+            auto* data = new IncludeData {};
+
+            // Relative includes are resolved by the including file, standard includes by the include directory
+            const auto include_path = (type == shaderc_include_type_relative
+                                               ? fs::path {requesting_source}.parent_path()
+                                               : context->include_directory) /
+                                      requested_source;
+            if(auto content = read_file(include_path); !content.is_error()) {
+                data->source_name = include_path.lexically_normal().string();
+                data->content = std::move(*content);
+
+                const auto is_known = std::any_of(context->included_files.cbegin(), context->included_files.cend(),
+                                                  [&](const auto& file) { return file.path == data->source_name; });
+                if(!is_known) {
+                    context->included_files.push_back({data->source_name, fnv1a_hash(data->content)});
+                }
+            }
+            else {
+                // An empty source name tells shaderc that the include failed, the content is the error message
+                data->content = fmt::format("Unable to include '{}'", requested_source);
+            }
+
+            data->result = {data->source_name.data(), data->source_name.size(), data->content.data(),
+                            data->content.size(), data};
+            return &data->result;
+        }
+
+        auto release_include(void* user_data, shaderc_include_result* include_result) -> void {
+            UNUSED_PARAMETER(user_data);
+            delete static_cast<IncludeData*>(include_result->user_data);
+        }
+
+        // Compilers aren't shared between threads, so every reloading thread owns its own compiler
+        auto get_thread_compiler() noexcept -> shaderc_compiler* {
+            thread_local std::unique_ptr<shaderc_compiler, decltype(&shaderc_compiler_release)> compiler {
+                    shaderc_compiler_initialize(), &shaderc_compiler_release};
+            return compiler.get();
+        }
+
+        auto get_nanoseconds_since(std::chrono::steady_clock::time_point start_time) noexcept -> uint64_t {
+            return static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time)
+                            .count());
+        }
+    }// namespace
+
+    /**
+     * This constructor creates the shader without SPIR-V, the shader is compiled by the reload.
+     *
+     * @param resource_path   The path of the GLSL file
+     * @param runtime_type    The runtime type of the shader resource
+     * @param vulkan_device   The device, on which the shader module is created, or nullptr
+     * @param compile_options The options, with which the shader is compiled
+     *
+     * @author                Cedric Hammes
+     * @since                 16/10/2026
+     */
+    Shader::Shader(const fs::path& resource_path, const kstd::reflect::RTTI* runtime_type,
+                   const vulkan::VulkanDevice* vulkan_device, ShaderCompileOptions compile_options) :
+            Resource {resource_path, runtime_type},
+            _vulkan_device {vulkan_device},
+            _compile_options {std::move(compile_options)},
+            _shader_module {VK_NULL_HANDLE},
+            _module_id {0} {
+    }
+
     Shader::~Shader() noexcept {
-        if(_compiler != nullptr) {
-            shaderc_compiler_release(_compiler);
-            _compiler = nullptr;
+        if(_shader_module != VK_NULL_HANDLE) {
+            vkDestroyShaderModule(_vulkan_device->get_virtual_device(), _shader_module, nullptr);
+            _shader_module = VK_NULL_HANDLE;
         }
     }
 
+    /**
+     * This function reads the shader file and loads the SPIR-V from the cache. If the cache contains no SPIR-V for the
+     * current source, includes, macros and options, the shader is compiled and written into the cache.
+     *
+     * @param resource_manager The resource manager, which owns the shader
+     * @return                 Success or error
+     *
+     * @author                 Cedric Hammes
+     * @since                  16/10/2026
+     */
     auto Shader::reload(const aetherium::ResourceManager& resource_manager) noexcept -> kstd::Result<void> {
+        const auto source = read_file(_resource_path);
+        if(source.is_error()) {
+            return kstd::Error {source.get_error()};
+        }
+        if(const auto compile_result = compile(*source, resource_manager); compile_result.is_error()) {
+            return compile_result;
+        }
+        return create_shader_module();
+    }
+
+    /**
+     * This function compiles the GLSL source, which was read by the I/O thread of the asynchronous loader, or loads
+     * the SPIR-V from the cache. The shader module is created by finalize.
+     *
+     * @param data             The GLSL source of the shader
+     * @param resource_manager The resource manager, which loads the shader
+     * @return                 Success or error
+     *
+     * @author                 Cedric Hammes
+     * @since                  16/10/2026
+     */
+    auto Shader::decode(std::vector<uint8_t> data, const aetherium::ResourceManager& resource_manager) noexcept
+            -> kstd::Result<void> {
+        return compile({reinterpret_cast<const char*>(data.data()), data.size()}, resource_manager);
+    }
+
+    /**
+     * This function creates the shader module with the SPIR-V of the decode on the thread, which owns the resource
+     * manager.
+     *
+     * @param resource_manager The resource manager, which loads the shader
+     * @return                 Success or error
+     *
+     * @author                 Cedric Hammes
+     * @since                  16/10/2026
+     */
+    auto Shader::finalize(const aetherium::ResourceManager& resource_manager) noexcept -> kstd::Result<void> {
         UNUSED_PARAMETER(resource_manager);
-        // TODO: Read file data
+        return create_shader_module();
+    }
+
+    auto Shader::compile(std::string_view source, const aetherium::ResourceManager& resource_manager) noexcept
+            -> kstd::Result<void> {
+        using namespace std::string_literals;
+        const auto start_time = std::chrono::steady_clock::now();
+
+        // Warm start, the SPIR-V for the source, includes, macros and options is already in the cache
+        const auto shader_kind = get_shader_kind(_resource_path);
+        const auto base_directory = fs::path {resource_manager.get_base_directory()};
+        const auto cache_directory = fs::path {base_directory}.append("cache").append("shaders");
+        const auto cache_key = get_cache_key(_resource_path, base_directory, source, shader_kind, _compile_options);
+        std::vector<fs::path> include_paths {};
+        if(auto cached_spirv = load_cached_spirv(base_directory, cache_directory, cache_key, include_paths);
+           !cached_spirv.is_error()) {
+            _spirv = std::move(*cached_spirv);
+            _dependencies = std::move(include_paths);
+            if(const auto reflect_result = update_reflection(); reflect_result.is_error()) {
+                return reflect_result;
+            }
+            const auto nanoseconds = get_nanoseconds_since(start_time);
+            cache_hits++;
+            warm_nanoseconds += nanoseconds;
+            SPDLOG_DEBUG("Loaded shader '{}' from cache in {:.3f} ms (warm)", _resource_path.string(),
+                         static_cast<double>(nanoseconds) / 1e6);
+            return {};
+        }
+
+        // Cold start, compile the shader with the compiler of the current thread
+        auto* compiler = get_thread_compiler();
+        if(compiler == nullptr) {
+            return kstd::Error {"Unable to compile shader: The shader compiler isn't initialized"s};
+        }
 
-        auto* compiler = shaderc_compiler_initialize();
         auto* compile_options = shaderc_compile_options_initialize();
         shaderc_compile_options_set_source_language(compile_options, shaderc_source_language_glsl);
-        // TODO: Compile file data into shader
+        shaderc_compile_options_set_target_env(compile_options, shaderc_target_env_vulkan,
+                                               shaderc_env_version_vulkan_1_3);
+        if(_compile_options.optimize) {
+            shaderc_compile_options_set_optimization_level(compile_options, shaderc_optimization_level_performance);
+        }
+        if(_compile_options.generate_debug_info) {
+            shaderc_compile_options_set_generate_debug_info(compile_options);
+        }
+        for(const auto& [name, value] : _compile_options.macros) {
+            shaderc_compile_options_add_macro_definition(compile_options, name.data(), name.size(), value.data(),
+                                                         value.size());
+        }
+
+        IncludeContext include_context {fs::path {base_directory}.append("assets"), {}};
+        shaderc_compile_options_set_include_callbacks(compile_options, resolve_include, release_include,
+                                                      &include_context);
+
+        const auto resource_path = _resource_path.string();
+        auto* compile_result = shaderc_compile_into_spv(compiler, source.data(), source.size(), shader_kind,
+                                                        resource_path.c_str(), "main", compile_options);
         shaderc_compile_options_release(compile_options);
+        if(compile_result == nullptr) {
+            return kstd::Error {fmt::format("Unable to compile shader '{}'", resource_path)};
+        }
+        if(shaderc_result_get_compilation_status(compile_result) != shaderc_compilation_status_success) {
+            auto error = kstd::Error {fmt::format("Unable to compile shader '{}': {}", resource_path,
+                                                  shaderc_result_get_error_message(compile_result))};
+            shaderc_result_release(compile_result);
+            return error;
+        }
 
-        // TODO: Create vulkan shader module by IR and store IR in module
+        _spirv.resize(shaderc_result_get_length(compile_result) / sizeof(uint32_t));
+        std::memcpy(_spirv.data(), shaderc_result_get_bytes(compile_result), _spirv.size() * sizeof(uint32_t));
+        shaderc_result_release(compile_result);
+        if(const auto reflect_result = update_reflection(); reflect_result.is_error()) {
+            return reflect_result;
+        }
+
+        // The includes are tracked as dependencies, so changing an include reloads the shader
+        _dependencies.clear();
+        for(const auto& included_file : include_context.included_files) {
+            _dependencies.emplace_back(included_file.path);
+        }
+
+        // A failed cache write only slows down the next start, so it's no error
+        if(!store_cached_spirv(base_directory, cache_directory, cache_key, include_context.included_files, _spirv)) {
+            SPDLOG_WARN("Unable to write shader '{}' into the cache", resource_path);
+        }
+
+        const auto nanoseconds = get_nanoseconds_since(start_time);
+        cache_misses++;
+        cold_nanoseconds += nanoseconds;
+        SPDLOG_INFO("Compiled shader '{}' in {:.3f} ms (cold)", resource_path, static_cast<double>(nanoseconds) / 1e6);
+        return {};
+    }
+
+    auto Shader::create_shader_module() noexcept -> kstd::Result<void> {
+        if(_vulkan_device == nullptr) {
+            return {};
+        }
+
+        // The pipelines don't reference the shader module after their creation, so the old module is destroyed
+        VkShaderModuleCreateInfo shader_module_create_info {};
+        shader_module_create_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        shader_module_create_info.codeSize = _spirv.size() * sizeof(uint32_t);
+        shader_module_create_info.pCode = _spirv.data();
+        VkShaderModule shader_module {};
+        if(const auto create_result = vkCreateShaderModule(_vulkan_device->get_virtual_device(),
+                                                           &shader_module_create_info, nullptr, &shader_module);
+           create_result != VK_SUCCESS) {
+            return kstd::Error {fmt::format("Unable to create shader module of '{}': {}", _resource_path.string(),
+                                            get_vulkan_error_message(create_result))};
+        }
+        if(_shader_module != VK_NULL_HANDLE) {
+            vkDestroyShaderModule(_vulkan_device->get_virtual_device(), _shader_module, nullptr);
+        }
+        _shader_module = shader_module;
+        _module_id = next_module_id++;
+        return {};
+    }
+
+    auto Shader::update_reflection() noexcept -> kstd::Result<void> {
+        auto reflection = vulkan::reflect_spirv(_spirv);
+        if(reflection.is_error()) {
+            return kstd::Error {fmt::format("Unable to reflect shader '{}': {}", _resource_path.string(),
+                                            reflection.get_error())};
+        }
+        _reflection = std::move(*reflection);
         return {};
     }
+
+    auto Shader::get_spirv() const noexcept -> const std::vector<uint32_t>& {
+        return _spirv;
+    }
+
+    auto Shader::operator*() const noexcept -> VkShaderModule {
+        return _shader_module;
+    }
+
+    /**
+     * This function returns the id of the current shader module. Every created shader module gets a new id, so the id
+     * is used instead of the handle to identify the pipelines of the shader after a reload.
+     *
+     * @return The id of the shader module or zero, if no shader module was created
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto Shader::get_module_id() const noexcept -> uint64_t {
+        return _module_id;
+    }
+
+    auto Shader::get_reflection() const noexcept -> const vulkan::ShaderReflection& {
+        return _reflection;
+    }
+
+    /**
+     * This function returns the statistics of the SPIR-V cache over all shaders, which are loaded since the start of
+     * the program.
+     *
+     * @return The statistics of the SPIR-V cache
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto Shader::get_cache_statistics() noexcept -> ShaderCacheStatistics {
+        ShaderCacheStatistics statistics {};
+        statistics.hits = cache_hits.load();
+        statistics.misses = cache_misses.load();
+        statistics.warm_milliseconds = static_cast<double>(warm_nanoseconds.load()) / 1e6;
+        statistics.cold_milliseconds = static_cast<double>(cold_nanoseconds.load()) / 1e6;
+        return statistics;
+    }
 }// namespace aetherium::renderer
@@ -0,0 +1,952 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "aetherium/renderer/vulkan/allocator.hpp"
+#include <algorithm>
+#include <numeric>
+
+namespace aetherium::renderer::vulkan {
+    namespace {
+        constexpr auto find_last_set(uint64_t value) noexcept -> uint32_t {
+            uint32_t index = 0;
+            while((value >>= 1) != 0) {
+                index++;
+            }
+            return index;
+        }
+
+        constexpr auto find_first_set(uint64_t value) noexcept -> uint32_t {
+            uint32_t index = 0;
+            while((value & 1) == 0) {
+                value >>= 1;
+                index++;
+            }
+            return index;
+        }
+
+        constexpr auto align_up(uint64_t value, uint64_t alignment) noexcept -> uint64_t {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+    }// namespace
+
+    /**
+     * This constructor creates the allocator for a range with the specified size. The size is rounded down to the
+     * minimal block size.
+     *
+     * @param size The size of the managed range
+     *
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    TlsfAllocator::TlsfAllocator(uint64_t size) noexcept :
+            _size {size & ~(MIN_BLOCK_SIZE - 1)},
+            _used_size {0},
+            _allocation_count {0},
+            _first_level_bitmap {0} {
+        _free_lists.fill(NO_BLOCK);
+        _blocks.push_back({0, _size, NO_BLOCK, NO_BLOCK, NO_BLOCK, NO_BLOCK, false});
+        if(_size > 0) {
+            insert_free_block(0);
+        }
+    }
+
+    auto TlsfAllocator::get_list_index(uint64_t size) noexcept -> std::pair<uint32_t, uint32_t> {
+        const auto first_level = find_last_set(size);
+        const auto second_level =
+                static_cast<uint32_t>(size >> (first_level - SECOND_LEVEL_BITS)) ^ SECOND_LEVEL_COUNT;
+        return {first_level, second_level};
+    }
+
+    auto TlsfAllocator::find_free_block(uint64_t size) const noexcept -> uint32_t {
+        // Round the size up to the next list, so every block of the found list is large enough
+        const auto rounded_size = size + (uint64_t(1) << (find_last_set(size) - SECOND_LEVEL_BITS)) - 1;
+        auto [first_level, second_level] = get_list_index(rounded_size);
+
+        auto second_level_bitmap = _second_level_bitmaps[first_level] & (~0u << second_level);
+        if(second_level_bitmap == 0) {
+            if(first_level + 1 >= FIRST_LEVEL_COUNT) {
+                return NO_BLOCK;
+            }
+
+            const auto first_level_bitmap = _first_level_bitmap & (~uint64_t(0) << (first_level + 1));
+            if(first_level_bitmap == 0) {
+                return NO_BLOCK;
+            }
+            first_level = find_first_set(first_level_bitmap);
+            second_level_bitmap = _second_level_bitmaps[first_level];
+        }
+        second_level = find_first_set(second_level_bitmap);
+        return _free_lists[first_level * SECOND_LEVEL_COUNT + second_level];
+    }
+
+    auto TlsfAllocator::create_block() noexcept -> uint32_t {
+        if(!_unused_blocks.empty()) {
+            const auto block_index = _unused_blocks.back();
+            _unused_blocks.pop_back();
+            return block_index;
+        }
+        _blocks.push_back({});
+        return static_cast<uint32_t>(_blocks.size() - 1);
+    }
+
+    auto TlsfAllocator::split_block(uint32_t block_index, uint64_t size) noexcept -> uint32_t {
+        const auto remainder_index = create_block();
+        auto& block = _blocks[block_index];
+        auto& remainder = _blocks[remainder_index];
+        remainder.offset = block.offset + size;
+        remainder.size = block.size - size;
+        remainder.previous_physical = block_index;
+        remainder.next_physical = block.next_physical;
+        remainder.previous_free = NO_BLOCK;
+        remainder.next_free = NO_BLOCK;
+        remainder.is_free = false;
+        if(block.next_physical != NO_BLOCK) {
+            _blocks[block.next_physical].previous_physical = remainder_index;
+        }
+        block.next_physical = remainder_index;
+        block.size = size;
+        return remainder_index;
+    }
+
+    auto TlsfAllocator::merge_blocks(uint32_t block_index, uint32_t next_block_index) noexcept -> void {
+        auto& block = _blocks[block_index];
+        auto& next_block = _blocks[next_block_index];
+        block.size += next_block.size;
+        block.next_physical = next_block.next_physical;
+        if(next_block.next_physical != NO_BLOCK) {
+            _blocks[next_block.next_physical].previous_physical = block_index;
+        }
+        next_block.is_free = false;
+        _unused_blocks.push_back(next_block_index);
+    }
+
+    auto TlsfAllocator::insert_free_block(uint32_t block_index) noexcept -> void {
+        auto& block = _blocks[block_index];
+        const auto [first_level, second_level] = get_list_index(block.size);
+        auto& list_head = _free_lists[first_level * SECOND_LEVEL_COUNT + second_level];
+        block.is_free = true;
+        block.previous_free = NO_BLOCK;
+        block.next_free = list_head;
+        if(list_head != NO_BLOCK) {
+            _blocks[list_head].previous_free = block_index;
+        }
+        list_head = block_index;
+        _first_level_bitmap |= uint64_t(1) << first_level;
+        _second_level_bitmaps[first_level] |= 1u << second_level;
+    }
+
+    auto TlsfAllocator::remove_free_block(uint32_t block_index) noexcept -> void {
+        auto& block = _blocks[block_index];
+        const auto [first_level, second_level] = get_list_index(block.size);
+        auto& list_head = _free_lists[first_level * SECOND_LEVEL_COUNT + second_level];
+        if(block.previous_free != NO_BLOCK) {
+            _blocks[block.previous_free].next_free = block.next_free;
+        }
+        else {
+            list_head = block.next_free;
+        }
+        if(block.next_free != NO_BLOCK) {
+            _blocks[block.next_free].previous_free = block.previous_free;
+        }
+
+        if(list_head == NO_BLOCK) {
+            _second_level_bitmaps[first_level] &= ~(1u << second_level);
+            if(_second_level_bitmaps[first_level] == 0) {
+                _first_level_bitmap &= ~(uint64_t(1) << first_level);
+            }
+        }
+        block.is_free = false;
+        block.previous_free = NO_BLOCK;
+        block.next_free = NO_BLOCK;
+    }
+
+    /**
+     * This function allocates a range with the specified size and alignment. The size is rounded up to the minimal
+     * block size and the alignment must be a power of two.
+     *
+     * @param size      The size of the range
+     * @param alignment The alignment of the offset of the range
+     * @return          The allocated range or an error
+     *
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto TlsfAllocator::allocate(uint64_t size, uint64_t alignment) noexcept -> kstd::Result<TlsfAllocation> {
+        using namespace std::string_literals;
+        if(size == 0 || size > _size) {
+            return kstd::Error {fmt::format("Unable to allocate range: Invalid size {}", size)};
+        }
+
+        // Search a block, which is large enough for the worst-case padding of the alignment
+        alignment = std::max(alignment, MIN_BLOCK_SIZE);
+        size = align_up(size, MIN_BLOCK_SIZE);
+        auto block_index = find_free_block(size + alignment - MIN_BLOCK_SIZE);
+        if(block_index == NO_BLOCK) {
+            return kstd::Error {"Unable to allocate range: Out of memory"s};
+        }
+        remove_free_block(block_index);
+
+        // Split the padding in front of the aligned offset and the unused space behind the range into free blocks
+        const auto padding = align_up(_blocks[block_index].offset, alignment) - _blocks[block_index].offset;
+        if(padding > 0) {
+            const auto aligned_block_index = split_block(block_index, padding);
+            insert_free_block(block_index);
+            block_index = aligned_block_index;
+        }
+        if(_blocks[block_index].size - size >= MIN_BLOCK_SIZE) {
+            insert_free_block(split_block(block_index, size));
+        }
+
+        _used_size += _blocks[block_index].size;
+        _allocation_count++;
+        return TlsfAllocation {_blocks[block_index].offset, block_index};
+    }
+
+    /**
+     * This function gives the specified range back to the allocator and merges it with its free neighbours.
+     *
+     * @param block_index The block index of the allocated range
+     *
+     * @author            Cedric Hammes
+     * @since             16/10/2026
+     */
+    auto TlsfAllocator::free(uint32_t block_index) noexcept -> void {
+        _used_size -= _blocks[block_index].size;
+        _allocation_count--;
+
+        const auto previous_block_index = _blocks[block_index].previous_physical;
+        if(previous_block_index != NO_BLOCK && _blocks[previous_block_index].is_free) {
+            remove_free_block(previous_block_index);
+            merge_blocks(previous_block_index, block_index);
+            block_index = previous_block_index;
+        }
+
+        const auto next_block_index = _blocks[block_index].next_physical;
+        if(next_block_index != NO_BLOCK && _blocks[next_block_index].is_free) {
+            remove_free_block(next_block_index);
+            merge_blocks(block_index, next_block_index);
+        }
+        insert_free_block(block_index);
+    }
+
+    /**
+     * This function returns the size of the largest free range. Every allocation up to this size without extra
+     * alignment succeeds.
+     *
+     * @return The size of the largest free range
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto TlsfAllocator::get_largest_free_size() const noexcept -> uint64_t {
+        if(_first_level_bitmap == 0) {
+            return 0;
+        }
+
+        const auto first_level = find_last_set(_first_level_bitmap);
+        const auto second_level = find_last_set(_second_level_bitmaps[first_level]);
+        uint64_t largest_size = 0;
+        for(auto block_index = _free_lists[first_level * SECOND_LEVEL_COUNT + second_level]; block_index != NO_BLOCK;
+            block_index = _blocks[block_index].next_free) {
+            largest_size = std::max(largest_size, _blocks[block_index].size);
+        }
+        return largest_size;
+    }
+
+    /**
+     * This function returns the fragmentation of the free space between 0 and 1. Zero means all free space is a single
+     * range.
+     *
+     * @return The fragmentation of the free space
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto TlsfAllocator::get_fragmentation() const noexcept -> float {
+        const auto free_size = _size - _used_size;
+        if(free_size == 0) {
+            return 0.0f;
+        }
+        return 1.0f - static_cast<float>(get_largest_free_size()) / static_cast<float>(free_size);
+    }
+
+    auto TlsfAllocator::get_allocation_size(uint32_t block_index) const noexcept -> uint64_t {
+        return _blocks[block_index].size;
+    }
+
+    auto TlsfAllocator::get_size() const noexcept -> uint64_t {
+        return _size;
+    }
+
+    auto TlsfAllocator::get_used_size() const noexcept -> uint64_t {
+        return _used_size;
+    }
+
+    auto TlsfAllocator::get_allocation_count() const noexcept -> uint32_t {
+        return _allocation_count;
+    }
+
+    auto TlsfAllocator::is_empty() const noexcept -> bool {
+        return _allocation_count == 0;
+    }
+
+    /**
+     * This constructor creates the allocator for a range with the specified size.
+     *
+     * @param size The size of the managed range
+     *
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    LinearAllocator::LinearAllocator(uint64_t size) noexcept :
+            _size {size},
+            _offset {0} {
+    }
+
+    /**
+     * This function allocates a range with the specified size and alignment behind the last allocation. The alignment
+     * must be a power of two.
+     *
+     * @param size      The size of the range
+     * @param alignment The alignment of the offset of the range
+     * @return          The offset of the range or an error
+     *
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto LinearAllocator::allocate(uint64_t size, uint64_t alignment) noexcept -> kstd::Result<uint64_t> {
+        using namespace std::string_literals;
+        const auto offset = align_up(_offset, alignment);
+        if(offset + size > _size) {
+            return kstd::Error {"Unable to allocate range: Out of memory"s};
+        }
+        _offset = offset + size;
+        return offset;
+    }
+
+    /**
+     * This function frees all allocations at once.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto LinearAllocator::reset() noexcept -> void {
+        _offset = 0;
+    }
+
+    auto LinearAllocator::get_size() const noexcept -> uint64_t {
+        return _size;
+    }
+
+    auto LinearAllocator::get_used_size() const noexcept -> uint64_t {
+        return _offset;
+    }
+
+    /**
+     * This constructor creates the allocator for the specified device. No memory is allocated until the first
+     * allocation.
+     *
+     * @param physical_device The physical device, from which the memory types are read
+     * @param device          The device, on which the memory is allocated
+     * @param block_size      The preferred size of the memory blocks
+     *
+     * @author                Cedric Hammes
+     * @since                 16/10/2026
+     */
+    MemoryAllocator::MemoryAllocator(VkPhysicalDevice physical_device, VkDevice device,
+                                     VkDeviceSize block_size) noexcept :
+            _device {device},
+            _max_allocation_count {0},
+            _block_size {block_size},
+            _device_allocation_count {0},
+            _dedicated_allocation_count {0},
+            _dedicated_size {0} {
+        vkGetPhysicalDeviceMemoryProperties(physical_device, &_memory_properties);
+
+        VkPhysicalDeviceProperties properties {};
+        vkGetPhysicalDeviceProperties(physical_device, &properties);
+        _max_allocation_count = properties.limits.maxMemoryAllocationCount;
+    }
+
+    MemoryAllocator::~MemoryAllocator() noexcept {
+        for(auto& block : _blocks) {
+            if(block != nullptr) {
+                vkFreeMemory(_device, block->memory, nullptr);
+            }
+        }
+        _blocks.clear();
+    }
+
+    auto MemoryAllocator::find_memory_type(uint32_t memory_type_bits, MemoryUsage usage) const noexcept
+            -> kstd::Result<uint32_t> {
+        using namespace std::string_literals;
+
+        VkMemoryPropertyFlags required_flags = 0;
+        VkMemoryPropertyFlags preferred_flags = 0;
+        switch(usage) {
+            case GPU_ONLY: required_flags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT; break;
+            case CPU_TO_GPU:
+                required_flags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+                preferred_flags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+                break;
+            case GPU_TO_CPU:
+                required_flags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+                preferred_flags = VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+                break;
+        }
+
+        // Prefer the memory types with all preferred flags and fall back to the types with the required flags
+        for(const auto flags : {required_flags | preferred_flags, required_flags}) {
+            for(uint32_t i = 0; i < _memory_properties.memoryTypeCount; i++) {
+                if((memory_type_bits & (1u << i)) != 0 &&
+                   (_memory_properties.memoryTypes[i].propertyFlags & flags) == flags) {
+                    return i;
+                }
+            }
+        }
+        return kstd::Error {"Unable to find memory type: No memory type matches the usage"s};
+    }
+
+    auto MemoryAllocator::allocate_device_memory(VkDeviceSize size, uint32_t memory_type_index,
+                                                 const void* next) noexcept -> kstd::Result<VkDeviceMemory> {
+        if(_device_allocation_count >= _max_allocation_count) {
+            return kstd::Error {fmt::format("Unable to allocate memory: Limit of {} allocations reached",
+                                            _max_allocation_count)};
+        }
+
+        VkMemoryAllocateInfo memory_allocate_info {};
+        memory_allocate_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        memory_allocate_info.pNext = next;
+        memory_allocate_info.allocationSize = size;
+        memory_allocate_info.memoryTypeIndex = memory_type_index;
+
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        VK_CHECK(vkAllocateMemory(_device, &memory_allocate_info, nullptr, &memory), "Unable to allocate memory: {}")
+        _device_allocation_count++;
+        return memory;
+    }
+
+    auto MemoryAllocator::allocate_dedicated(const VkMemoryRequirements& requirements, uint32_t memory_type_index,
+                                             const AllocationCreateInfo& create_info) noexcept
+            -> kstd::Result<Allocation> {
+        VkMemoryDedicatedAllocateInfo dedicated_allocate_info {};
+        dedicated_allocate_info.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+        dedicated_allocate_info.buffer = create_info.dedicated_buffer;
+        dedicated_allocate_info.image = create_info.dedicated_image;
+        const auto has_resource =
+                create_info.dedicated_buffer != VK_NULL_HANDLE || create_info.dedicated_image != VK_NULL_HANDLE;
+
+        const auto memory_result = allocate_device_memory(requirements.size, memory_type_index,
+                                                          has_resource ? &dedicated_allocate_info : nullptr);
+        if(memory_result.is_error()) {
+            return kstd::Error {memory_result.get_error()};
+        }
+
+        Allocation allocation {};
+        allocation.memory = *memory_result;
+        allocation.size = requirements.size;
+        allocation.memory_type_index = memory_type_index;
+        if((_memory_properties.memoryTypes[memory_type_index].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) !=
+           0) {
+            if(const auto result =
+                       vkMapMemory(_device, allocation.memory, 0, VK_WHOLE_SIZE, 0, &allocation.mapped_data);
+               result != VK_SUCCESS) {
+                vkFreeMemory(_device, allocation.memory, nullptr);
+                _device_allocation_count--;
+                return kstd::Error {fmt::format("Unable to map memory: {}", get_vulkan_error_message(result))};
+            }
+        }
+        _dedicated_allocation_count++;
+        _dedicated_size += allocation.size;
+        return allocation;
+    }
+
+    auto MemoryAllocator::get_block_size(uint32_t memory_type_index) const noexcept -> VkDeviceSize {
+        // Small heaps (like the BAR heap) get smaller blocks, so a single block doesn't exhaust them
+        const auto heap_index = _memory_properties.memoryTypes[memory_type_index].heapIndex;
+        const auto heap_size = _memory_properties.memoryHeaps[heap_index].size;
+        return std::min(_block_size, align_up(heap_size / 8, TlsfAllocator::MIN_BLOCK_SIZE));
+    }
+
+    auto MemoryAllocator::create_block(uint32_t memory_type_index, bool is_linear) noexcept -> kstd::Result<uint32_t> {
+        const auto block_size = get_block_size(memory_type_index);
+        const auto memory_result = allocate_device_memory(block_size, memory_type_index, nullptr);
+        if(memory_result.is_error()) {
+            return kstd::Error {memory_result.get_error()};
+        }
+
+        auto block = std::make_unique<MemoryBlock>(
+                MemoryBlock {*memory_result, nullptr, memory_type_index, is_linear, TlsfAllocator {block_size}, {}});
+        if((_memory_properties.memoryTypes[memory_type_index].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) !=
+           0) {
+            if(const auto result = vkMapMemory(_device, block->memory, 0, VK_WHOLE_SIZE, 0, &block->mapped_data);
+               result != VK_SUCCESS) {
+                vkFreeMemory(_device, block->memory, nullptr);
+                _device_allocation_count--;
+                return kstd::Error {fmt::format("Unable to map memory: {}", get_vulkan_error_message(result))};
+            }
+        }
+
+        // Reuse the slot of a released block, so the block indices of the allocations stay stable
+        const auto free_slot = std::find(_blocks.begin(), _blocks.end(), nullptr);
+        if(free_slot != _blocks.end()) {
+            *free_slot = std::move(block);
+            return static_cast<uint32_t>(std::distance(_blocks.begin(), free_slot));
+        }
+        _blocks.push_back(std::move(block));
+        return static_cast<uint32_t>(_blocks.size() - 1);
+    }
+
+    auto MemoryAllocator::allocate_from_block(uint32_t block_index, VkDeviceSize size, VkDeviceSize alignment) noexcept
+            -> kstd::Result<Allocation> {
+        auto& block = *_blocks[block_index];
+        const auto range_result = block.allocator.allocate(size, alignment);
+        if(range_result.is_error()) {
+            return kstd::Error {range_result.get_error()};
+        }
+
+        if(block.alignments.size() <= range_result->block_index) {
+            block.alignments.resize(range_result->block_index + 1);
+        }
+        block.alignments[range_result->block_index] = alignment;
+
+        Allocation allocation {};
+        allocation.memory = block.memory;
+        allocation.offset = range_result->offset;
+        allocation.size = size;
+        allocation.memory_type_index = block.memory_type_index;
+        allocation.block_index = block_index;
+        allocation.range_index = range_result->block_index;
+        if(block.mapped_data != nullptr) {
+            allocation.mapped_data = static_cast<uint8_t*>(block.mapped_data) + allocation.offset;
+        }
+        return allocation;
+    }
+
+    auto MemoryAllocator::release_block(uint32_t block_index) noexcept -> void {
+        vkFreeMemory(_device, _blocks[block_index]->memory, nullptr);
+        _blocks[block_index].reset();
+        _device_allocation_count--;
+    }
+
+    auto MemoryAllocator::free_from_block(uint32_t block_index, uint32_t range_index) noexcept -> void {
+        auto& block = *_blocks[block_index];
+        block.allocator.free(range_index);
+        if(!block.allocator.is_empty()) {
+            return;
+        }
+
+        // Keep the last empty block of a kind, so alternating allocations don't allocate device memory every time
+        const auto has_other_block = std::any_of(_blocks.cbegin(), _blocks.cend(), [&](const auto& other_block) {
+            return other_block != nullptr && other_block.get() != &block &&
+                   other_block->memory_type_index == block.memory_type_index &&
+                   other_block->is_linear == block.is_linear;
+        });
+        if(has_other_block) {
+            release_block(block_index);
+        }
+    }
+
+    /**
+     * This function allocates memory with the specified requirements. The allocation is served by a block of the
+     * matching memory type and only when no block has enough space, a new block is allocated.
+     *
+     * @param requirements The requirements of the resource
+     * @param create_info  The information how to allocate
+     * @return             The allocation or an error
+     *
+     * @author             Cedric Hammes
+     * @since              16/10/2026
+     */
+    auto MemoryAllocator::allocate(const VkMemoryRequirements& requirements,
+                                   const AllocationCreateInfo& create_info) noexcept -> kstd::Result<Allocation> {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        const auto memory_type_result = find_memory_type(requirements.memoryTypeBits, create_info.usage);
+        if(memory_type_result.is_error()) {
+            return kstd::Error {memory_type_result.get_error()};
+        }
+        const auto memory_type_index = *memory_type_result;
+
+        // Resources, which would take more than half of a block, get their own memory
+        if(create_info.is_dedicated || requirements.size > get_block_size(memory_type_index) / 2) {
+            return allocate_dedicated(requirements, memory_type_index, create_info);
+        }
+
+        for(uint32_t block_index = 0; block_index < _blocks.size(); block_index++) {
+            const auto& block = _blocks[block_index];
+            if(block == nullptr || block->memory_type_index != memory_type_index ||
+               block->is_linear != create_info.is_linear) {
+                continue;
+            }
+
+            if(auto allocation = allocate_from_block(block_index, requirements.size, requirements.alignment);
+               !allocation.is_error()) {
+                return allocation;
+            }
+        }
+
+        const auto block_result = create_block(memory_type_index, create_info.is_linear);
+        if(block_result.is_error()) {
+            return kstd::Error {block_result.get_error()};
+        }
+        return allocate_from_block(*block_result, requirements.size, requirements.alignment);
+    }
+
+    /**
+     * This function allocates memory for the specified buffer and binds it. If the driver prefers a dedicated
+     * allocation for the buffer, the buffer gets its own memory object.
+     *
+     * @param buffer The buffer
+     * @param usage  The usage of the memory
+     * @return       The allocation or an error
+     *
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto MemoryAllocator::allocate_for_buffer(VkBuffer buffer, MemoryUsage usage) noexcept
+            -> kstd::Result<Allocation> {
+        VkMemoryDedicatedRequirements dedicated_requirements {};
+        dedicated_requirements.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS;
+
+        VkMemoryRequirements2 requirements {};
+        requirements.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
+        requirements.pNext = &dedicated_requirements;
+
+        VkBufferMemoryRequirementsInfo2 requirements_info {};
+        requirements_info.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2;
+        requirements_info.buffer = buffer;
+        vkGetBufferMemoryRequirements2(_device, &requirements_info, &requirements);
+
+        AllocationCreateInfo create_info {};
+        create_info.usage = usage;
+        create_info.is_linear = true;
+        create_info.is_dedicated = dedicated_requirements.prefersDedicatedAllocation == VK_TRUE ||
+                                   dedicated_requirements.requiresDedicatedAllocation == VK_TRUE;
+        create_info.dedicated_buffer = buffer;
+
+        auto allocation = allocate(requirements.memoryRequirements, create_info);
+        if(allocation.is_error()) {
+            return allocation;
+        }
+        if(const auto result = vkBindBufferMemory(_device, buffer, allocation->memory, allocation->offset);
+           result != VK_SUCCESS) {
+            free(*allocation);
+            return kstd::Error {fmt::format("Unable to bind buffer memory: {}", get_vulkan_error_message(result))};
+        }
+        return allocation;
+    }
+
+    /**
+     * This function allocates memory for the specified image and binds it. If the driver prefers a dedicated
+     * allocation for the image, the image gets its own memory object.
+     *
+     * @param image     The image
+     * @param usage     The usage of the memory
+     * @param is_linear Whether the image uses linear tiling
+     * @return          The allocation or an error
+     *
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto MemoryAllocator::allocate_for_image(VkImage image, MemoryUsage usage, bool is_linear) noexcept
+            -> kstd::Result<Allocation> {
+        VkMemoryDedicatedRequirements dedicated_requirements {};
+        dedicated_requirements.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS;
+
+        VkMemoryRequirements2 requirements {};
+        requirements.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
+        requirements.pNext = &dedicated_requirements;
+
+        VkImageMemoryRequirementsInfo2 requirements_info {};
+        requirements_info.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2;
+        requirements_info.image = image;
+        vkGetImageMemoryRequirements2(_device, &requirements_info, &requirements);
+
+        AllocationCreateInfo create_info {};
+        create_info.usage = usage;
+        create_info.is_linear = is_linear;
+        create_info.is_dedicated = dedicated_requirements.prefersDedicatedAllocation == VK_TRUE ||
+                                   dedicated_requirements.requiresDedicatedAllocation == VK_TRUE;
+        create_info.dedicated_image = image;
+
+        auto allocation = allocate(requirements.memoryRequirements, create_info);
+        if(allocation.is_error()) {
+            return allocation;
+        }
+        if(const auto result = vkBindImageMemory(_device, image, allocation->memory, allocation->offset);
+           result != VK_SUCCESS) {
+            free(*allocation);
+            return kstd::Error {fmt::format("Unable to bind image memory: {}", get_vulkan_error_message(result))};
+        }
+        return allocation;
+    }
+
+    /**
+     * This function frees the specified allocation. Empty blocks are given back to the driver as long as another block
+     * of the same kind exists.
+     *
+     * @param allocation The allocation
+     *
+     * @author           Cedric Hammes
+     * @since            16/10/2026
+     */
+    auto MemoryAllocator::free(const Allocation& allocation) noexcept -> void {
+        if(allocation.memory == VK_NULL_HANDLE) {
+            return;
+        }
+
+        const std::lock_guard<std::mutex> lock {_mutex};
+        if(allocation.block_index == TlsfAllocator::NO_BLOCK) {
+            vkFreeMemory(_device, allocation.memory, nullptr);
+            _device_allocation_count--;
+            _dedicated_allocation_count--;
+            _dedicated_size -= allocation.size;
+            return;
+        }
+        free_from_block(allocation.block_index, allocation.range_index);
+    }
+
+    /**
+     * This function moves the allocations out of the least used blocks (at most half used) into other blocks of the
+     * same kind and frees the blocks, which became empty. The specified function has to copy the content and rebind
+     * the resource for every move and must not call into the allocator. The GPU must not use the moved allocations.
+     *
+     * @param move_function The function, which moves a single allocation
+     * @return              The statistics of the defragmentation or an error
+     *
+     * @author              Cedric Hammes
+     * @since               16/10/2026
+     */
+    auto MemoryAllocator::defragment(const MoveFunction& move_function) noexcept
+            -> kstd::Result<DefragmentationStatistics> {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        DefragmentationStatistics statistics {};
+
+        // Evacuate the least used blocks first into the blocks, which are used more
+        std::vector<uint32_t> block_indices {};
+        for(uint32_t block_index = 0; block_index < _blocks.size(); block_index++) {
+            if(_blocks[block_index] != nullptr && !_blocks[block_index]->allocator.is_empty()) {
+                block_indices.push_back(block_index);
+            }
+        }
+        std::sort(block_indices.begin(), block_indices.end(), [&](const auto left, const auto right) {
+            return _blocks[left]->allocator.get_used_size() < _blocks[right]->allocator.get_used_size();
+        });
+
+        for(size_t i = 0; i < block_indices.size(); i++) {
+            const auto source_index = block_indices[i];
+            auto& source = *_blocks[source_index];
+            if(source.allocator.get_used_size() * 2 > source.allocator.get_size()) {
+                break;
+            }
+
+            std::vector<TlsfAllocation> ranges {};
+            source.allocator.for_each_allocation([&](const TlsfAllocation& range, uint64_t) {
+                ranges.push_back(range);
+            });
+
+            for(const auto& range : ranges) {
+                const auto size = source.allocator.get_allocation_size(range.block_index);
+                const auto alignment = source.alignments[range.block_index];
+
+                // Search a target in the blocks, which are not evacuated
+                Allocation new_allocation {};
+                for(size_t j = i + 1; j < block_indices.size() && new_allocation.memory == VK_NULL_HANDLE; j++) {
+                    const auto& target = *_blocks[block_indices[j]];
+                    if(target.memory_type_index != source.memory_type_index || target.is_linear != source.is_linear) {
+                        continue;
+                    }
+                    if(const auto target_result = allocate_from_block(block_indices[j], size, alignment);
+                       !target_result.is_error()) {
+                        new_allocation = *target_result;
+                    }
+                }
+                if(new_allocation.memory == VK_NULL_HANDLE) {
+                    return statistics;
+                }
+
+                Allocation old_allocation {};
+                old_allocation.memory = source.memory;
+                old_allocation.offset = range.offset;
+                old_allocation.size = size;
+                old_allocation.memory_type_index = source.memory_type_index;
+                old_allocation.block_index = source_index;
+                old_allocation.range_index = range.block_index;
+                if(source.mapped_data != nullptr) {
+                    old_allocation.mapped_data = static_cast<uint8_t*>(source.mapped_data) + range.offset;
+                }
+
+                if(!move_function(old_allocation, new_allocation)) {
+                    _blocks[new_allocation.block_index]->allocator.free(new_allocation.range_index);
+                    return statistics;
+                }
+                statistics.moved_allocations++;
+                statistics.moved_bytes += size;
+                source.allocator.free(range.block_index);
+            }
+
+            release_block(source_index);
+            statistics.freed_blocks++;
+        }
+        return statistics;
+    }
+
+    /**
+     * This function returns the statistics of the allocator like the used and reserved bytes and the fragmentation of
+     * the blocks.
+     *
+     * @return The statistics of the allocator
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto MemoryAllocator::get_statistics() const noexcept -> MemoryStatistics {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        MemoryStatistics statistics {};
+        statistics.used_bytes = _dedicated_size;
+        statistics.reserved_bytes = _dedicated_size;
+        statistics.allocation_count = _dedicated_allocation_count;
+        statistics.dedicated_allocation_count = _dedicated_allocation_count;
+        statistics.device_allocation_count = _device_allocation_count;
+
+        VkDeviceSize free_size = 0;
+        VkDeviceSize largest_free_size = 0;
+        for(const auto& block : _blocks) {
+            if(block == nullptr) {
+                continue;
+            }
+
+            statistics.used_bytes += block->allocator.get_used_size();
+            statistics.reserved_bytes += block->allocator.get_size();
+            statistics.allocation_count += block->allocator.get_allocation_count();
+            statistics.block_count++;
+            free_size += block->allocator.get_size() - block->allocator.get_used_size();
+            largest_free_size += block->allocator.get_largest_free_size();
+        }
+
+        // The fragmentation is the part of the free space, which isn't the largest free range of its block
+        if(free_size > 0) {
+            statistics.fragmentation =
+                    1.0f - static_cast<float>(largest_free_size) / static_cast<float>(free_size);
+        }
+        return statistics;
+    }
+
+    /**
+     * This constructor creates an empty pool without memory.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    LinearMemoryPool::LinearMemoryPool() noexcept :
+            _memory_allocator {nullptr},
+            _allocation {},
+            _linear_allocator {} {
+    }
+
+    /**
+     * This constructor allocates the memory of the pool by the specified allocator. The memory is aligned to the base
+     * alignment, so all alignments up to the base alignment are respected by the allocations of the pool.
+     *
+     * @param memory_allocator The allocator of the pool memory
+     * @param size             The size of the pool
+     * @param usage            The usage of the pool memory
+     * @param memory_type_bits The allowed memory types of the pool memory
+     *
+     * @author                 Cedric Hammes
+     * @since                  16/10/2026
+     */
+    LinearMemoryPool::LinearMemoryPool(MemoryAllocator* memory_allocator, VkDeviceSize size, MemoryUsage usage,
+                                       uint32_t memory_type_bits) :
+            _memory_allocator {memory_allocator},
+            _allocation {},
+            _linear_allocator {size} {
+        AllocationCreateInfo create_info {};
+        create_info.usage = usage;
+        _allocation = memory_allocator->allocate({size, BASE_ALIGNMENT, memory_type_bits}, create_info)
+                              .get_or_throw();
+    }
+
+    LinearMemoryPool::LinearMemoryPool(LinearMemoryPool&& other) noexcept :
+            _memory_allocator {other._memory_allocator},
+            _allocation {other._allocation},
+            _linear_allocator {other._linear_allocator} {
+        other._memory_allocator = nullptr;
+        other._allocation = {};
+        other._linear_allocator = LinearAllocator {};
+    }
+
+    LinearMemoryPool::~LinearMemoryPool() noexcept {
+        if(_memory_allocator != nullptr) {
+            _memory_allocator->free(_allocation);
+            _memory_allocator = nullptr;
+        }
+    }
+
+    /**
+     * This function allocates a range of the pool memory. The returned allocation must not be freed.
+     *
+     * @param size      The size of the range
+     * @param alignment The alignment of the range
+     * @return          The allocation or an error
+     *
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto LinearMemoryPool::allocate(VkDeviceSize size, VkDeviceSize alignment) noexcept -> kstd::Result<Allocation> {
+        const auto offset_result = _linear_allocator.allocate(size, alignment);
+        if(offset_result.is_error()) {
+            return kstd::Error {offset_result.get_error()};
+        }
+
+        Allocation allocation = _allocation;
+        allocation.offset += *offset_result;
+        allocation.size = size;
+        if(allocation.mapped_data != nullptr) {
+            allocation.mapped_data = static_cast<uint8_t*>(allocation.mapped_data) + *offset_result;
+        }
+        return allocation;
+    }
+
+    /**
+     * This function frees all allocations of the pool at once. The GPU must be done with the pool memory.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto LinearMemoryPool::reset() noexcept -> void {
+        _linear_allocator.reset();
+    }
+
+    auto LinearMemoryPool::get_allocation() const noexcept -> const Allocation& {
+        return _allocation;
+    }
+
+    auto LinearMemoryPool::get_used_size() const noexcept -> VkDeviceSize {
+        return _linear_allocator.get_used_size();
+    }
+
+    auto LinearMemoryPool::operator=(LinearMemoryPool&& other) noexcept -> LinearMemoryPool& {
+        if(_memory_allocator != nullptr) {
+            _memory_allocator->free(_allocation);
+        }
+        _memory_allocator = other._memory_allocator;
+        _allocation = other._allocation;
+        _linear_allocator = other._linear_allocator;
+        other._memory_allocator = nullptr;
+        other._allocation = {};
+        other._linear_allocator = LinearAllocator {};
+        return *this;
+    }
+}// namespace aetherium::renderer::vulkan
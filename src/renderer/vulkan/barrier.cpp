@@ -0,0 +1,332 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "aetherium/renderer/vulkan/barrier.hpp"
+#include <algorithm>
+
+namespace aetherium::renderer::vulkan {
+    namespace {
+        constexpr VkPipelineStageFlags2 SHADER_STAGE_MASK = VK_PIPELINE_STAGE_2_PRE_RASTERIZATION_SHADERS_BIT |
+                                                            VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT |
+                                                            VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+        constexpr VkPipelineStageFlags2 FRAGMENT_TESTS_STAGE_MASK =
+                VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT;
+
+        auto is_same_range(const VkImageSubresourceRange& left, const VkImageSubresourceRange& right) noexcept
+                -> bool {
+            return left.aspectMask == right.aspectMask && left.baseMipLevel == right.baseMipLevel &&
+                   left.levelCount == right.levelCount && left.baseArrayLayer == right.baseArrayLayer &&
+                   left.layerCount == right.layerCount;
+        }
+    }// namespace
+
+    /**
+     * This function returns the stages and accesses, in which an image in the specified layout can be used. The masks
+     * are used for layout transitions, when the exact usage of the image is unknown.
+     *
+     * @param layout The layout of the image
+     * @return       The stages and accesses of the layout
+     *
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto get_layout_usage(const VkImageLayout layout) noexcept -> LayoutUsage {
+        switch(layout) {
+            case VK_IMAGE_LAYOUT_UNDEFINED: return {VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE};
+            case VK_IMAGE_LAYOUT_PREINITIALIZED: return {VK_PIPELINE_STAGE_2_HOST_BIT, VK_ACCESS_2_HOST_WRITE_BIT};
+            case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
+                return {VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
+                        VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT};
+            case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
+            case VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_OPTIMAL:
+            case VK_IMAGE_LAYOUT_STENCIL_ATTACHMENT_OPTIMAL:
+            case VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_STENCIL_READ_ONLY_OPTIMAL:
+            case VK_IMAGE_LAYOUT_DEPTH_READ_ONLY_STENCIL_ATTACHMENT_OPTIMAL:
+                return {FRAGMENT_TESTS_STAGE_MASK,
+                        VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT};
+            case VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL:
+            case VK_IMAGE_LAYOUT_DEPTH_READ_ONLY_OPTIMAL:
+            case VK_IMAGE_LAYOUT_STENCIL_READ_ONLY_OPTIMAL:
+                return {FRAGMENT_TESTS_STAGE_MASK | SHADER_STAGE_MASK,
+                        VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_2_SHADER_SAMPLED_READ_BIT};
+            case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
+                return {SHADER_STAGE_MASK, VK_ACCESS_2_SHADER_SAMPLED_READ_BIT | VK_ACCESS_2_INPUT_ATTACHMENT_READ_BIT};
+            case VK_IMAGE_LAYOUT_READ_ONLY_OPTIMAL:
+                return {FRAGMENT_TESTS_STAGE_MASK | SHADER_STAGE_MASK | VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
+                        VK_ACCESS_2_SHADER_SAMPLED_READ_BIT | VK_ACCESS_2_INPUT_ATTACHMENT_READ_BIT |
+                                VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT};
+            case VK_IMAGE_LAYOUT_ATTACHMENT_OPTIMAL:
+                return {FRAGMENT_TESTS_STAGE_MASK | VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
+                        VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT |
+                                VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT |
+                                VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT};
+            case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
+                return {VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT, VK_ACCESS_2_TRANSFER_READ_BIT};
+            case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
+                return {VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT};
+            // The presentation engine is synchronized by the semaphores of the present
+            case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR: return {VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE};
+            case VK_IMAGE_LAYOUT_FRAGMENT_SHADING_RATE_ATTACHMENT_OPTIMAL_KHR:
+                return {VK_PIPELINE_STAGE_2_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_KHR,
+                        VK_ACCESS_2_FRAGMENT_SHADING_RATE_ATTACHMENT_READ_BIT_KHR};
+            case VK_IMAGE_LAYOUT_FRAGMENT_DENSITY_MAP_OPTIMAL_EXT:
+                return {VK_PIPELINE_STAGE_2_FRAGMENT_DENSITY_PROCESS_BIT_EXT,
+                        VK_ACCESS_2_FRAGMENT_DENSITY_MAP_READ_BIT_EXT};
+            // The general layout, the shared present layout and the video layouts can be used anywhere
+            default:
+                return {VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+                        VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT};
+        }
+    }
+
+    /**
+     * This function returns the aspects of an image with the specified format.
+     *
+     * @param format The format of the image
+     * @return       The aspects of the format
+     *
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto get_aspect_mask(const VkFormat format) noexcept -> VkImageAspectFlags {
+        switch(format) {
+            case VK_FORMAT_D16_UNORM:
+            case VK_FORMAT_X8_D24_UNORM_PACK32:
+            case VK_FORMAT_D32_SFLOAT: return VK_IMAGE_ASPECT_DEPTH_BIT;
+            case VK_FORMAT_S8_UINT: return VK_IMAGE_ASPECT_STENCIL_BIT;
+            case VK_FORMAT_D16_UNORM_S8_UINT:
+            case VK_FORMAT_D24_UNORM_S8_UINT:
+            case VK_FORMAT_D32_SFLOAT_S8_UINT: return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+            default: return VK_IMAGE_ASPECT_COLOR_BIT;
+        }
+    }
+
+    /**
+     * This function adds a layout transition of the whole image. The stages and accesses on both sides of the barrier
+     * are derived from the old and new layout.
+     *
+     * @param image       The image
+     * @param aspect_mask The aspects of the image
+     * @param old_layout  The layout before the barrier
+     * @param new_layout  The layout after the barrier
+     * @return            The batch itself
+     *
+     * @author            Cedric Hammes
+     * @since             16/10/2026
+     */
+    auto BarrierBatch::transition_image(VkImage image, VkImageAspectFlags aspect_mask, VkImageLayout old_layout,
+                                        VkImageLayout new_layout) noexcept -> BarrierBatch& {
+        VkImageSubresourceRange subresource_range {};
+        subresource_range.aspectMask = aspect_mask;
+        subresource_range.baseMipLevel = 0;
+        subresource_range.levelCount = VK_REMAINING_MIP_LEVELS;
+        subresource_range.baseArrayLayer = 0;
+        subresource_range.layerCount = VK_REMAINING_ARRAY_LAYERS;
+
+        // Only the writes of the old layout have to be made available, reads are covered by the execution dependency
+        const auto src_usage = get_layout_usage(old_layout);
+        const auto dst_usage = get_layout_usage(new_layout);
+        constexpr VkAccessFlags2 write_access_mask =
+                VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
+                VK_ACCESS_2_TRANSFER_WRITE_BIT | VK_ACCESS_2_HOST_WRITE_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT;
+        return image_barrier(image, subresource_range, old_layout, new_layout, src_usage.stage_mask,
+                             src_usage.access_mask & write_access_mask, dst_usage.stage_mask, dst_usage.access_mask);
+    }
+
+    /**
+     * This function adds a barrier for the specified image range with explicit stages and accesses. The layout is
+     * transitioned, if the old and new layout differ.
+     *
+     * @param image             The image
+     * @param subresource_range The range of the image
+     * @param old_layout        The layout before the barrier
+     * @param new_layout        The layout after the barrier
+     * @param src_stage_mask    The stages, which are waited for
+     * @param src_access_mask   The accesses, which are made available
+     * @param dst_stage_mask    The stages, which wait for the barrier
+     * @param dst_access_mask   The accesses, which are made visible
+     * @return                  The batch itself
+     *
+     * @author                  Cedric Hammes
+     * @since                   16/10/2026
+     */
+    auto BarrierBatch::image_barrier(VkImage image, const VkImageSubresourceRange& subresource_range,
+                                     VkImageLayout old_layout, VkImageLayout new_layout,
+                                     VkPipelineStageFlags2 src_stage_mask, VkAccessFlags2 src_access_mask,
+                                     VkPipelineStageFlags2 dst_stage_mask, VkAccessFlags2 dst_access_mask) noexcept
+            -> BarrierBatch& {
+        const auto iterator = std::find_if(_image_barriers.begin(), _image_barriers.end(),
+                                           [&](const VkImageMemoryBarrier2& barrier) {
+                                               return barrier.image == image && barrier.oldLayout == old_layout &&
+                                                      barrier.newLayout == new_layout &&
+                                                      is_same_range(barrier.subresourceRange, subresource_range);
+                                           });
+        if(iterator != _image_barriers.end()) {
+            iterator->srcStageMask |= src_stage_mask;
+            iterator->srcAccessMask |= src_access_mask;
+            iterator->dstStageMask |= dst_stage_mask;
+            iterator->dstAccessMask |= dst_access_mask;
+            return *this;
+        }
+
+        VkImageMemoryBarrier2 image_memory_barrier {};
+        image_memory_barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+        image_memory_barrier.srcStageMask = src_stage_mask;
+        image_memory_barrier.srcAccessMask = src_access_mask;
+        image_memory_barrier.dstStageMask = dst_stage_mask;
+        image_memory_barrier.dstAccessMask = dst_access_mask;
+        image_memory_barrier.oldLayout = old_layout;
+        image_memory_barrier.newLayout = new_layout;
+        image_memory_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        image_memory_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        image_memory_barrier.image = image;
+        image_memory_barrier.subresourceRange = subresource_range;
+        _image_barriers.push_back(image_memory_barrier);
+        return *this;
+    }
+
+    /**
+     * This function adds a barrier for the specified buffer range.
+     *
+     * @param buffer          The buffer
+     * @param offset          The offset of the range
+     * @param size            The size of the range or VK_WHOLE_SIZE
+     * @param src_stage_mask  The stages, which are waited for
+     * @param src_access_mask The accesses, which are made available
+     * @param dst_stage_mask  The stages, which wait for the barrier
+     * @param dst_access_mask The accesses, which are made visible
+     * @return                The batch itself
+     *
+     * @author                Cedric Hammes
+     * @since                 16/10/2026
+     */
+    auto BarrierBatch::buffer_barrier(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size,
+                                      VkPipelineStageFlags2 src_stage_mask, VkAccessFlags2 src_access_mask,
+                                      VkPipelineStageFlags2 dst_stage_mask, VkAccessFlags2 dst_access_mask) noexcept
+            -> BarrierBatch& {
+        const auto iterator = std::find_if(_buffer_barriers.begin(), _buffer_barriers.end(),
+                                           [&](const VkBufferMemoryBarrier2& barrier) {
+                                               return barrier.buffer == buffer && barrier.offset == offset &&
+                                                      barrier.size == size;
+                                           });
+        if(iterator != _buffer_barriers.end()) {
+            iterator->srcStageMask |= src_stage_mask;
+            iterator->srcAccessMask |= src_access_mask;
+            iterator->dstStageMask |= dst_stage_mask;
+            iterator->dstAccessMask |= dst_access_mask;
+            return *this;
+        }
+
+        VkBufferMemoryBarrier2 buffer_memory_barrier {};
+        buffer_memory_barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2;
+        buffer_memory_barrier.srcStageMask = src_stage_mask;
+        buffer_memory_barrier.srcAccessMask = src_access_mask;
+        buffer_memory_barrier.dstStageMask = dst_stage_mask;
+        buffer_memory_barrier.dstAccessMask = dst_access_mask;
+        buffer_memory_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        buffer_memory_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        buffer_memory_barrier.buffer = buffer;
+        buffer_memory_barrier.offset = offset;
+        buffer_memory_barrier.size = size;
+        _buffer_barriers.push_back(buffer_memory_barrier);
+        return *this;
+    }
+
+    /**
+     * This function adds a global memory barrier, which applies to all resources. All global barriers of the batch
+     * are merged into a single barrier.
+     *
+     * @param src_stage_mask  The stages, which are waited for
+     * @param src_access_mask The accesses, which are made available
+     * @param dst_stage_mask  The stages, which wait for the barrier
+     * @param dst_access_mask The accesses, which are made visible
+     * @return                The batch itself
+     *
+     * @author                Cedric Hammes
+     * @since                 16/10/2026
+     */
+    auto BarrierBatch::memory_barrier(VkPipelineStageFlags2 src_stage_mask, VkAccessFlags2 src_access_mask,
+                                      VkPipelineStageFlags2 dst_stage_mask, VkAccessFlags2 dst_access_mask) noexcept
+            -> BarrierBatch& {
+        if(_memory_barriers.empty()) {
+            VkMemoryBarrier2 memory_barrier {};
+            memory_barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2;
+            _memory_barriers.push_back(memory_barrier);
+        }
+
+        auto& memory_barrier = _memory_barriers.front();
+        memory_barrier.srcStageMask |= src_stage_mask;
+        memory_barrier.srcAccessMask |= src_access_mask;
+        memory_barrier.dstStageMask |= dst_stage_mask;
+        memory_barrier.dstAccessMask |= dst_access_mask;
+        return *this;
+    }
+
+    /**
+     * This function records all barriers of the batch with a single vkCmdPipelineBarrier2 call into the specified
+     * command buffer. Nothing is recorded, if the batch is empty.
+     *
+     * @param command_buffer The command buffer
+     *
+     * @author               Cedric Hammes
+     * @since                16/10/2026
+     */
+    auto BarrierBatch::record(VkCommandBuffer command_buffer) const noexcept -> void {
+        if(is_empty()) {
+            return;
+        }
+
+        VkDependencyInfo dependency_info {};
+        dependency_info.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+        dependency_info.memoryBarrierCount = static_cast<uint32_t>(_memory_barriers.size());
+        dependency_info.pMemoryBarriers = _memory_barriers.data();
+        dependency_info.bufferMemoryBarrierCount = static_cast<uint32_t>(_buffer_barriers.size());
+        dependency_info.pBufferMemoryBarriers = _buffer_barriers.data();
+        dependency_info.imageMemoryBarrierCount = static_cast<uint32_t>(_image_barriers.size());
+        dependency_info.pImageMemoryBarriers = _image_barriers.data();
+        vkCmdPipelineBarrier2(command_buffer, &dependency_info);
+    }
+
+    /**
+     * This function records all barriers of the batch into the specified command buffer and clears the batch.
+     *
+     * @param command_buffer The command buffer
+     *
+     * @author               Cedric Hammes
+     * @since                16/10/2026
+     */
+    auto BarrierBatch::flush(VkCommandBuffer command_buffer) noexcept -> void {
+        record(command_buffer);
+        clear();
+    }
+
+    auto BarrierBatch::clear() noexcept -> void {
+        _image_barriers.clear();
+        _buffer_barriers.clear();
+        _memory_barriers.clear();
+    }
+
+    auto BarrierBatch::get_image_barriers() const noexcept -> const std::vector<VkImageMemoryBarrier2>& {
+        return _image_barriers;
+    }
+
+    auto BarrierBatch::get_barrier_count() const noexcept -> uint32_t {
+        return static_cast<uint32_t>(_image_barriers.size() + _buffer_barriers.size() + _memory_barriers.size());
+    }
+
+    auto BarrierBatch::is_empty() const noexcept -> bool {
+        return _image_barriers.empty() && _buffer_barriers.empty() && _memory_barriers.empty();
+    }
+}// namespace aetherium::renderer::vulkan
@@ -0,0 +1,345 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "aetherium/renderer/vulkan/bindless_heap.hpp"
+#include <algorithm>
+
+namespace aetherium::renderer::vulkan {
+    /**
+     * This constructor creates the descriptor pool, the descriptor set layout, the pipeline layout and the global
+     * descriptor set of the heap. The device must support descriptor indexing.
+     *
+     * @param vulkan_device    The device, on which the heap is created
+     * @param limits           The sizes of the descriptor arrays
+     * @param frames_in_flight The count of frames, which could still use a freed index
+     *
+     * @author                 Cedric Hammes
+     * @since                  16/10/2026
+     */
+    BindlessHeap::BindlessHeap(const VulkanDevice* vulkan_device, const BindlessHeapLimits& limits,
+                               uint32_t frames_in_flight) :
+            _virtual_device {vulkan_device->get_virtual_device()},
+            _descriptor_pool {VK_NULL_HANDLE},
+            _descriptor_set_layout {VK_NULL_HANDLE},
+            _pipeline_layout {VK_NULL_HANDLE},
+            _descriptor_set {VK_NULL_HANDLE},
+            _frame_index {0},
+            _frames_in_flight {frames_in_flight},
+            _push_constant_size {0} {
+        using namespace std::string_literals;
+        if(!vulkan_device->supports_descriptor_indexing()) {
+            throw std::runtime_error {
+                    "Unable to create bindless heap: The device doesn't support descriptor indexing"s};
+        }
+
+        // Clamp the sizes of the arrays to the update-after-bind limits of the device
+        VkPhysicalDeviceVulkan12Properties vulkan12_properties {};
+        vulkan12_properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES;
+        VkPhysicalDeviceProperties2 properties {};
+        properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        properties.pNext = &vulkan12_properties;
+        vkGetPhysicalDeviceProperties2(vulkan_device->get_physical_device(), &properties);
+
+        _index_pools[BINDLESS_IMAGE_BINDING].capacity =
+                std::min({limits.max_images, vulkan12_properties.maxDescriptorSetUpdateAfterBindSampledImages,
+                          vulkan12_properties.maxPerStageDescriptorUpdateAfterBindSampledImages});
+        _index_pools[BINDLESS_BUFFER_BINDING].capacity =
+                std::min({limits.max_buffers, vulkan12_properties.maxDescriptorSetUpdateAfterBindStorageBuffers,
+                          vulkan12_properties.maxPerStageDescriptorUpdateAfterBindStorageBuffers});
+        _index_pools[BINDLESS_SAMPLER_BINDING].capacity =
+                std::min({limits.max_samplers, vulkan12_properties.maxDescriptorSetUpdateAfterBindSamplers,
+                          vulkan12_properties.maxPerStageDescriptorUpdateAfterBindSamplers});
+        _push_constant_size = std::min(limits.push_constant_size, properties.properties.limits.maxPushConstantsSize);
+
+        // Create descriptor set layout with partially bound arrays, which can be updated while they're in use
+        const std::array<VkDescriptorType, 3> descriptor_types {VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+                                                                VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                                                                VK_DESCRIPTOR_TYPE_SAMPLER};
+        std::array<VkDescriptorSetLayoutBinding, 3> layout_bindings {};
+        std::array<VkDescriptorBindingFlags, 3> binding_flags {};
+        std::array<VkDescriptorPoolSize, 3> pool_sizes {};
+        for(uint32_t binding = 0; binding < layout_bindings.size(); binding++) {
+            layout_bindings[binding].binding = binding;
+            layout_bindings[binding].descriptorType = descriptor_types[binding];
+            layout_bindings[binding].descriptorCount = _index_pools[binding].capacity;
+            layout_bindings[binding].stageFlags = VK_SHADER_STAGE_ALL;
+            binding_flags[binding] =
+                    VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT;
+            pool_sizes[binding].type = descriptor_types[binding];
+            pool_sizes[binding].descriptorCount = _index_pools[binding].capacity;
+        }
+
+        VkDescriptorSetLayoutBindingFlagsCreateInfo binding_flags_create_info {};
+        binding_flags_create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+        binding_flags_create_info.bindingCount = static_cast<uint32_t>(binding_flags.size());
+        binding_flags_create_info.pBindingFlags = binding_flags.data();
+
+        VkDescriptorSetLayoutCreateInfo descriptor_set_layout_create_info {};
+        descriptor_set_layout_create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        descriptor_set_layout_create_info.pNext = &binding_flags_create_info;
+        descriptor_set_layout_create_info.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+        descriptor_set_layout_create_info.bindingCount = static_cast<uint32_t>(layout_bindings.size());
+        descriptor_set_layout_create_info.pBindings = layout_bindings.data();
+        VK_CHECK_EX(vkCreateDescriptorSetLayout(_virtual_device, &descriptor_set_layout_create_info, nullptr,
+                                                &_descriptor_set_layout),
+                    "Unable to create bindless heap: {}")
+
+        // The destructor doesn't run if the constructor throws, so the objects created so far are destroyed first
+        const auto throw_error = [this](VkResult vk_result) {
+            destroy();
+            throw std::runtime_error {
+                    fmt::format("Unable to create bindless heap: {}", get_vulkan_error_message(vk_result))};
+        };
+
+        // Create pipeline layout, which is shared by all bindless pipelines
+        VkPushConstantRange push_constant_range {VK_SHADER_STAGE_ALL, 0, _push_constant_size};
+        VkPipelineLayoutCreateInfo pipeline_layout_create_info {};
+        pipeline_layout_create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipeline_layout_create_info.setLayoutCount = 1;
+        pipeline_layout_create_info.pSetLayouts = &_descriptor_set_layout;
+        pipeline_layout_create_info.pushConstantRangeCount = _push_constant_size > 0 ? 1 : 0;
+        pipeline_layout_create_info.pPushConstantRanges = &push_constant_range;
+        if(const auto create_result =
+                   vkCreatePipelineLayout(_virtual_device, &pipeline_layout_create_info, nullptr, &_pipeline_layout);
+           create_result != VK_SUCCESS) {
+            throw_error(create_result);
+        }
+
+        // Create descriptor pool and the global descriptor set
+        VkDescriptorPoolCreateInfo descriptor_pool_create_info {};
+        descriptor_pool_create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        descriptor_pool_create_info.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+        descriptor_pool_create_info.maxSets = 1;
+        descriptor_pool_create_info.poolSizeCount = static_cast<uint32_t>(pool_sizes.size());
+        descriptor_pool_create_info.pPoolSizes = pool_sizes.data();
+        if(const auto create_result =
+                   vkCreateDescriptorPool(_virtual_device, &descriptor_pool_create_info, nullptr, &_descriptor_pool);
+           create_result != VK_SUCCESS) {
+            throw_error(create_result);
+        }
+
+        VkDescriptorSetAllocateInfo descriptor_set_allocate_info {};
+        descriptor_set_allocate_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        descriptor_set_allocate_info.descriptorPool = _descriptor_pool;
+        descriptor_set_allocate_info.descriptorSetCount = 1;
+        descriptor_set_allocate_info.pSetLayouts = &_descriptor_set_layout;
+        if(const auto allocate_result =
+                   vkAllocateDescriptorSets(_virtual_device, &descriptor_set_allocate_info, &_descriptor_set);
+           allocate_result != VK_SUCCESS) {
+            throw_error(allocate_result);
+        }
+    }
+
+    BindlessHeap::~BindlessHeap() noexcept {
+        destroy();
+    }
+
+    auto BindlessHeap::destroy() noexcept -> void {
+        if(_descriptor_pool != VK_NULL_HANDLE) {
+            vkDestroyDescriptorPool(_virtual_device, _descriptor_pool, nullptr);
+            _descriptor_pool = VK_NULL_HANDLE;
+        }
+        if(_pipeline_layout != VK_NULL_HANDLE) {
+            vkDestroyPipelineLayout(_virtual_device, _pipeline_layout, nullptr);
+            _pipeline_layout = VK_NULL_HANDLE;
+        }
+        if(_descriptor_set_layout != VK_NULL_HANDLE) {
+            vkDestroyDescriptorSetLayout(_virtual_device, _descriptor_set_layout, nullptr);
+            _descriptor_set_layout = VK_NULL_HANDLE;
+        }
+    }
+
+    auto BindlessHeap::acquire_index(uint32_t binding) noexcept -> kstd::Result<uint32_t> {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        auto& index_pool = _index_pools[binding];
+        if(!index_pool.free_indices.empty()) {
+            const auto index = index_pool.free_indices.back();
+            index_pool.free_indices.pop_back();
+            return index;
+        }
+
+        if(index_pool.next_index >= index_pool.capacity) {
+            return kstd::Error {fmt::format("Unable to register bindless resource: All {} indices of binding {} are "
+                                            "in use",
+                                            index_pool.capacity, binding)};
+        }
+        return index_pool.next_index++;
+    }
+
+    auto BindlessHeap::release_index(uint32_t binding, uint32_t index) noexcept -> void {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        _index_pools[binding].retired_indices.emplace_back(_frame_index, index);
+    }
+
+    auto BindlessHeap::write_descriptor(uint32_t binding, uint32_t index, const VkDescriptorImageInfo* image_info,
+                                        const VkDescriptorBufferInfo* buffer_info) const noexcept -> void {
+        VkWriteDescriptorSet write_descriptor_set {};
+        write_descriptor_set.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write_descriptor_set.dstSet = _descriptor_set;
+        write_descriptor_set.dstBinding = binding;
+        write_descriptor_set.dstArrayElement = index;
+        write_descriptor_set.descriptorCount = 1;
+        if(binding == BINDLESS_IMAGE_BINDING) {
+            write_descriptor_set.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+        }
+        else if(binding == BINDLESS_BUFFER_BINDING) {
+            write_descriptor_set.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        }
+        else {
+            write_descriptor_set.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
+        }
+        write_descriptor_set.pImageInfo = image_info;
+        write_descriptor_set.pBufferInfo = buffer_info;
+        vkUpdateDescriptorSets(_virtual_device, 1, &write_descriptor_set, 0, nullptr);
+    }
+
+    /**
+     * This function registers the specified image view in the sampled image array and returns its index.
+     *
+     * @param image_view   The image view
+     * @param image_layout The layout of the image, while it's read by the shaders
+     * @return             The index of the image or an error, if the array is full
+     *
+     * @author             Cedric Hammes
+     * @since              16/10/2026
+     */
+    auto BindlessHeap::register_image(VkImageView image_view, VkImageLayout image_layout) noexcept
+            -> kstd::Result<uint32_t> {
+        const auto index = acquire_index(BINDLESS_IMAGE_BINDING);
+        if(index.is_error()) {
+            return index;
+        }
+        update_image(*index, image_view, image_layout);
+        return index;
+    }
+
+    /**
+     * This function registers the specified range of a buffer in the storage buffer array and returns its index.
+     *
+     * @param buffer The buffer
+     * @param offset The offset of the range in the buffer
+     * @param range  The size of the range
+     * @return       The index of the buffer or an error, if the array is full
+     *
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto BindlessHeap::register_buffer(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize range) noexcept
+            -> kstd::Result<uint32_t> {
+        const auto index = acquire_index(BINDLESS_BUFFER_BINDING);
+        if(index.is_error()) {
+            return index;
+        }
+        update_buffer(*index, buffer, offset, range);
+        return index;
+    }
+
+    auto BindlessHeap::register_sampler(VkSampler sampler) noexcept -> kstd::Result<uint32_t> {
+        const auto index = acquire_index(BINDLESS_SAMPLER_BINDING);
+        if(index.is_error()) {
+            return index;
+        }
+
+        VkDescriptorImageInfo image_info {};
+        image_info.sampler = sampler;
+        write_descriptor(BINDLESS_SAMPLER_BINDING, *index, &image_info, nullptr);
+        return index;
+    }
+
+    /**
+     * This function replaces the image view behind an already registered index. This is used when a resource is
+     * reloaded, so the index stays stable for all users of the resource.
+     *
+     * @param index        The index of the image
+     * @param image_view   The new image view
+     * @param image_layout The layout of the image, while it's read by the shaders
+     *
+     * @author             Cedric Hammes
+     * @since              16/10/2026
+     */
+    auto BindlessHeap::update_image(uint32_t index, VkImageView image_view, VkImageLayout image_layout) const noexcept
+            -> void {
+        VkDescriptorImageInfo image_info {};
+        image_info.imageView = image_view;
+        image_info.imageLayout = image_layout;
+        write_descriptor(BINDLESS_IMAGE_BINDING, index, &image_info, nullptr);
+    }
+
+    auto BindlessHeap::update_buffer(uint32_t index, VkBuffer buffer, VkDeviceSize offset,
+                                     VkDeviceSize range) const noexcept -> void {
+        VkDescriptorBufferInfo buffer_info {};
+        buffer_info.buffer = buffer;
+        buffer_info.offset = offset;
+        buffer_info.range = range;
+        write_descriptor(BINDLESS_BUFFER_BINDING, index, nullptr, &buffer_info);
+    }
+
+    auto BindlessHeap::unregister_image(uint32_t index) noexcept -> void {
+        release_index(BINDLESS_IMAGE_BINDING, index);
+    }
+
+    auto BindlessHeap::unregister_buffer(uint32_t index) noexcept -> void {
+        release_index(BINDLESS_BUFFER_BINDING, index);
+    }
+
+    auto BindlessHeap::unregister_sampler(uint32_t index) noexcept -> void {
+        release_index(BINDLESS_SAMPLER_BINDING, index);
+    }
+
+    /**
+     * This function advances the heap to the next frame and returns the indices, which were freed before all frames in
+     * flight, back to the free lists. The renderer calls this function once per frame.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto BindlessHeap::next_frame() noexcept -> void {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        _frame_index++;
+        for(auto& index_pool : _index_pools) {
+            auto& retired_indices = index_pool.retired_indices;
+            while(!retired_indices.empty() && retired_indices.front().first + _frames_in_flight < _frame_index) {
+                index_pool.free_indices.push_back(retired_indices.front().second);
+                retired_indices.pop_front();
+            }
+        }
+    }
+
+    /**
+     * This function binds the global descriptor set to set 0 of the specified command buffer. Secondary command
+     * buffers don't inherit bound descriptor sets, so every draw recorder has to bind the heap itself.
+     *
+     * @param command_buffer The command buffer
+     * @param bind_point     The pipeline bind point, to which the set is bound
+     *
+     * @author               Cedric Hammes
+     * @since                16/10/2026
+     */
+    auto BindlessHeap::bind(VkCommandBuffer command_buffer, VkPipelineBindPoint bind_point) const noexcept -> void {
+        vkCmdBindDescriptorSets(command_buffer, bind_point, _pipeline_layout, 0, 1, &_descriptor_set, 0, nullptr);
+    }
+
+    auto BindlessHeap::get_descriptor_set_layout() const noexcept -> VkDescriptorSetLayout {
+        return _descriptor_set_layout;
+    }
+
+    auto BindlessHeap::get_pipeline_layout() const noexcept -> VkPipelineLayout {
+        return _pipeline_layout;
+    }
+
+    auto BindlessHeap::operator*() const noexcept -> VkDescriptorSet {
+        return _descriptor_set;
+    }
+}// namespace aetherium::renderer::vulkan
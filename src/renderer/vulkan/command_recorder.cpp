@@ -0,0 +1,189 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "aetherium/renderer/vulkan/command_recorder.hpp"
+
+namespace aetherium::renderer::vulkan {
+    /**
+     * This constructor creates an empty registry for the specified device.
+     *
+     * @param device The handle to the device
+     *
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    CommandPoolRegistry::CommandPoolRegistry(VkDevice device) noexcept :
+            _device {device} {
+    }
+
+    CommandPoolRegistry::~CommandPoolRegistry() noexcept {
+        for(auto& [key, pool] : _pools) {
+            vkDestroyCommandPool(_device, pool->command_pool, nullptr);
+        }
+        _pools.clear();
+    }
+
+    auto CommandPoolRegistry::get_thread_pool(uint32_t queue_family_index) noexcept
+            -> kstd::Result<ThreadCommandPool*> {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        const PoolKey key {std::this_thread::get_id(), queue_family_index};
+        if(const auto it = _pools.find(key); it != _pools.end()) {
+            return it->second.get();
+        }
+
+        VkCommandPoolCreateInfo command_pool_create_info {};
+        command_pool_create_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        command_pool_create_info.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        command_pool_create_info.queueFamilyIndex = queue_family_index;
+
+        VkCommandPool command_pool = nullptr;
+        VK_CHECK(vkCreateCommandPool(_device, &command_pool_create_info, nullptr, &command_pool),
+                 "Unable to create thread command pool: {}")
+        auto thread_pool = std::make_unique<ThreadCommandPool>();
+        thread_pool->command_pool = command_pool;
+        thread_pool->used_command_buffers = 0;
+        auto* thread_pool_pointer = thread_pool.get();
+        _pools.emplace(key, std::move(thread_pool));
+        return thread_pool_pointer;
+    }
+
+    /**
+     * This function returns a secondary command buffer from the pool of the calling thread for the specified queue
+     * family. The pool gets created on the first use by the thread.
+     *
+     * @param queue_family_index The index of the queue family
+     * @return                   The secondary command buffer or an error
+     *
+     * @author                   Cedric Hammes
+     * @since                    16/10/2026
+     */
+    auto CommandPoolRegistry::acquire_secondary_command_buffer(uint32_t queue_family_index) noexcept
+            -> kstd::Result<VkCommandBuffer> {
+        const auto thread_pool_result = get_thread_pool(queue_family_index);
+        if(thread_pool_result.is_error()) {
+            return kstd::Error {thread_pool_result.get_error()};
+        }
+
+        // Only the calling thread uses this pool, so no lock is needed from here on
+        auto* thread_pool = *thread_pool_result;
+        if(thread_pool->used_command_buffers < thread_pool->secondary_command_buffers.size()) {
+            return thread_pool->secondary_command_buffers[thread_pool->used_command_buffers++];
+        }
+
+        VkCommandBufferAllocateInfo allocate_info {};
+        allocate_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocate_info.commandPool = thread_pool->command_pool;
+        allocate_info.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+        allocate_info.commandBufferCount = 1;
+
+        VkCommandBuffer command_buffer = nullptr;
+        VK_CHECK(vkAllocateCommandBuffers(_device, &allocate_info, &command_buffer),
+                 "Unable to allocate secondary command buffer: {}")
+        thread_pool->secondary_command_buffers.push_back(command_buffer);
+        thread_pool->used_command_buffers++;
+        return command_buffer;
+    }
+
+    /**
+     * This function resets all pools of the registry and makes their command buffers available again. The GPU must be
+     * done with all command buffers of the registry and no thread must record at the same time.
+     *
+     * @return Success or error
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto CommandPoolRegistry::reset() noexcept -> kstd::Result<void> {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        for(auto& [key, pool] : _pools) {
+            if(pool->used_command_buffers == 0) {
+                continue;
+            }
+
+            VK_CHECK(vkResetCommandPool(_device, pool->command_pool, 0), "Unable to reset thread command pool: {}")
+            pool->used_command_buffers = 0;
+        }
+        return {};
+    }
+
+    /**
+     * This function records the specified functions into secondary command buffers on the worker threads of the thread
+     * pool. The secondary command buffers continue the dynamic rendering described by the rendering info, so they can
+     * be stitched into the primary command buffer with vkCmdExecuteCommands. The order of the returned command buffers
+     * matches the order of the functions.
+     *
+     * @param thread_pool        The pool, on which the functions are recorded
+     * @param registry           The registry of the per-thread command pools
+     * @param queue_family_index The index of the queue family of the primary command buffer
+     * @param rendering_info     The inheritance info of the dynamic rendering
+     * @param functions          The functions, which record the commands
+     * @return                   The recorded secondary command buffers or an error
+     *
+     * @author                   Cedric Hammes
+     * @since                    16/10/2026
+     */
+    auto record_secondary_command_buffers(ThreadPool& thread_pool, CommandPoolRegistry& registry,
+                                          uint32_t queue_family_index,
+                                          const VkCommandBufferInheritanceRenderingInfo& rendering_info,
+                                          const std::vector<RecordFunction>& functions) noexcept
+            -> kstd::Result<std::vector<VkCommandBuffer>> {
+        std::vector<std::future<kstd::Result<VkCommandBuffer>>> futures {};
+        futures.reserve(functions.size());
+        for(const auto& function : functions) {
+            futures.push_back(thread_pool.submit([&registry, &rendering_info, &function,
+                                                  queue_family_index]() -> kstd::Result<VkCommandBuffer> {
+                const auto command_buffer_result = registry.acquire_secondary_command_buffer(queue_family_index);
+                if(command_buffer_result.is_error()) {
+                    return command_buffer_result;
+                }
+                const auto command_buffer = *command_buffer_result;
+
+                VkCommandBufferInheritanceInfo inheritance_info {};
+                inheritance_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+                inheritance_info.pNext = &rendering_info;
+
+                VkCommandBufferBeginInfo command_buffer_begin_info {};
+                command_buffer_begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+                command_buffer_begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT |
+                                                  VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+                command_buffer_begin_info.pInheritanceInfo = &inheritance_info;
+                VK_CHECK(vkBeginCommandBuffer(command_buffer, &command_buffer_begin_info),
+                         "Unable to begin secondary command buffer: {}")
+                function(command_buffer);
+                VK_CHECK(vkEndCommandBuffer(command_buffer), "Unable to end secondary command buffer: {}")
+                return command_buffer;
+            }));
+        }
+
+        // Wait for all functions, so no worker references the functions after the return
+        std::vector<VkCommandBuffer> command_buffers {};
+        command_buffers.reserve(functions.size());
+        std::string error {};
+        for(auto& future : futures) {
+            const auto result = future.get();
+            if(result.is_error()) {
+                if(error.empty()) {
+                    error = result.get_error();
+                }
+                continue;
+            }
+            command_buffers.push_back(*result);
+        }
+
+        if(!error.empty()) {
+            return kstd::Error {error};
+        }
+        return command_buffers;
+    }
+}// namespace aetherium::renderer::vulkan
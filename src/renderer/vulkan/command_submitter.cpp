@@ -0,0 +1,281 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "aetherium/renderer/vulkan/command_submitter.hpp"
+#include <algorithm>
+
+namespace aetherium::renderer::vulkan {
+    /**
+     * This constructor creates an empty ticket, which is always done
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    SubmitTicket::SubmitTicket() noexcept :
+            _command_submitter {nullptr},
+            _value {0} {
+    }
+
+    /**
+     * This constructor creates a ticket for the specified timeline value of the submitter.
+     *
+     * @param command_submitter The submitter, which has recorded the command buffer
+     * @param value             The timeline value of the batch
+     *
+     * @author                  Cedric Hammes
+     * @since                   16/10/2026
+     */
+    SubmitTicket::SubmitTicket(CommandSubmitter* command_submitter, uint64_t value) noexcept :
+            _command_submitter {command_submitter},
+            _value {value} {
+    }
+
+    /**
+     * This function waits until the batch of the command buffer is executed. If the batch isn't submitted yet, the
+     * submitter gets flushed before the wait.
+     *
+     * @param timeout The maximal wait timeout
+     * @return        Success or error
+     *
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto SubmitTicket::wait(uint64_t timeout) const noexcept -> kstd::Result<void> {
+        if(_command_submitter == nullptr) {
+            return {};
+        }
+        return _command_submitter->wait(_value, timeout);
+    }
+
+    /**
+     * This function returns whether the batch of the command buffer is executed without blocking.
+     *
+     * @return Whether the command buffer is done
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto SubmitTicket::is_done() const noexcept -> bool {
+        return _command_submitter == nullptr || _command_submitter->is_done(_value);
+    }
+
+    auto SubmitTicket::get_value() const noexcept -> uint64_t {
+        return _value;
+    }
+
+    /**
+     * This function returns the timeline semaphore, which reaches the value of the ticket after the batch. Other
+     * submits wait on the semaphore with the value to be ordered after the command buffer.
+     *
+     * @return The timeline semaphore or a null handle for an empty ticket
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto SubmitTicket::get_timeline_semaphore() const noexcept -> VkSemaphore {
+        return _command_submitter == nullptr ? VK_NULL_HANDLE : _command_submitter->get_timeline_semaphore();
+    }
+
+    /**
+     * This constructor creates the transient command pool and the timeline semaphore of the submitter.
+     *
+     * @param device The handle to the device
+     * @param queue  The queue, to which the batches are submitted
+     *
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    CommandSubmitter::CommandSubmitter(VkDevice device, const Queue* queue) :
+            _device {device},
+            _queue {queue},
+            _command_pool {nullptr},
+            _timeline_semaphore {nullptr},
+            _submitted_value {0} {
+        VkCommandPoolCreateInfo command_pool_create_info {};
+        command_pool_create_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        command_pool_create_info.flags =
+                VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        command_pool_create_info.queueFamilyIndex = _queue->get_family_index();
+        VK_CHECK_EX(vkCreateCommandPool(_device, &command_pool_create_info, nullptr, &_command_pool),
+                    "Unable to create command submitter: {}")
+
+        VkSemaphoreTypeCreateInfo semaphore_type_create_info {};
+        semaphore_type_create_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        semaphore_type_create_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+        semaphore_type_create_info.initialValue = _submitted_value;
+
+        VkSemaphoreCreateInfo semaphore_create_info {};
+        semaphore_create_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphore_create_info.pNext = &semaphore_type_create_info;
+        VK_CHECK_EX(vkCreateSemaphore(_device, &semaphore_create_info, nullptr, &_timeline_semaphore),
+                    "Unable to create command submitter: {}")
+    }
+
+    CommandSubmitter::~CommandSubmitter() noexcept {
+        // Wait for all submitted batches before the command buffers get destroyed
+        if(_timeline_semaphore != nullptr) {
+            VkSemaphoreWaitInfo wait_info {};
+            wait_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+            wait_info.semaphoreCount = 1;
+            wait_info.pSemaphores = &_timeline_semaphore;
+            wait_info.pValues = &_submitted_value;
+            vkWaitSemaphores(_device, &wait_info, std::numeric_limits<uint64_t>::max());
+            vkDestroySemaphore(_device, _timeline_semaphore, nullptr);
+            _timeline_semaphore = nullptr;
+        }
+
+        if(_command_pool != nullptr) {
+            vkDestroyCommandPool(_device, _command_pool, nullptr);
+            _command_pool = nullptr;
+        }
+    }
+
+    auto CommandSubmitter::acquire_command_buffer() noexcept -> kstd::Result<VkCommandBuffer> {
+        if(_free_command_buffers.empty()) {
+            collect_command_buffers();
+        }
+
+        if(!_free_command_buffers.empty()) {
+            const auto command_buffer = _free_command_buffers.back();
+            _free_command_buffers.pop_back();
+            return command_buffer;
+        }
+
+        VkCommandBufferAllocateInfo allocate_info {};
+        allocate_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocate_info.commandPool = _command_pool;
+        allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocate_info.commandBufferCount = 1;
+
+        VkCommandBuffer command_buffer = nullptr;
+        VK_CHECK(vkAllocateCommandBuffers(_device, &allocate_info, &command_buffer),
+                 "Unable to allocate command buffer: {}")
+        return command_buffer;
+    }
+
+    auto CommandSubmitter::collect_command_buffers() noexcept -> void {
+        uint64_t completed_value = 0;
+        if(vkGetSemaphoreCounterValue(_device, _timeline_semaphore, &completed_value) != VK_SUCCESS) {
+            return;
+        }
+
+        // Move the command buffers of all finished batches into the free list
+        const auto first_in_flight = std::partition(
+                _in_flight_command_buffers.begin(), _in_flight_command_buffers.end(),
+                [completed_value](const auto& in_flight) { return in_flight.value <= completed_value; });
+        for(auto it = _in_flight_command_buffers.begin(); it != first_in_flight; ++it) {
+            _free_command_buffers.push_back(it->command_buffer);
+        }
+        _in_flight_command_buffers.erase(_in_flight_command_buffers.begin(), first_in_flight);
+    }
+
+    auto CommandSubmitter::flush_pending() noexcept -> kstd::Result<void> {
+        if(_pending_command_buffers.empty()) {
+            return {};
+        }
+
+        const auto signal_value = _submitted_value + 1;
+        VkTimelineSemaphoreSubmitInfo timeline_submit_info {};
+        timeline_submit_info.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timeline_submit_info.signalSemaphoreValueCount = 1;
+        timeline_submit_info.pSignalSemaphoreValues = &signal_value;
+
+        VkSubmitInfo submit_info {};
+        submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submit_info.pNext = &timeline_submit_info;
+        submit_info.commandBufferCount = static_cast<uint32_t>(_pending_command_buffers.size());
+        submit_info.pCommandBuffers = _pending_command_buffers.data();
+        submit_info.signalSemaphoreCount = 1;
+        submit_info.pSignalSemaphores = &_timeline_semaphore;
+        if(const auto submit_result = _queue->submit(&submit_info, 1); submit_result.is_error()) {
+            return submit_result;
+        }
+
+        for(const auto command_buffer : _pending_command_buffers) {
+            _in_flight_command_buffers.push_back({command_buffer, signal_value});
+        }
+        _pending_command_buffers.clear();
+        _submitted_value = signal_value;
+        return {};
+    }
+
+    /**
+     * This function submits all pending command buffers with a single submit and recycles the command buffers of all
+     * finished batches. This function is called once per tick.
+     *
+     * @return The ticket of the last submitted batch or an error
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto CommandSubmitter::flush() noexcept -> kstd::Result<SubmitTicket> {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        collect_command_buffers();
+        if(const auto flush_result = flush_pending(); flush_result.is_error()) {
+            return kstd::Error {flush_result.get_error()};
+        }
+        return _submitted_value == 0 ? SubmitTicket {} : SubmitTicket {this, _submitted_value};
+    }
+
+    /**
+     * This function waits until the batch with the specified timeline value is executed. If the batch isn't submitted
+     * yet, the pending command buffers are flushed before the wait.
+     *
+     * @param value   The timeline value of the batch
+     * @param timeout The maximal wait timeout
+     * @return        Success or error
+     *
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto CommandSubmitter::wait(uint64_t value, uint64_t timeout) noexcept -> kstd::Result<void> {
+        {
+            const std::lock_guard<std::mutex> lock {_mutex};
+            if(value > _submitted_value) {
+                if(const auto flush_result = flush_pending(); flush_result.is_error()) {
+                    return flush_result;
+                }
+            }
+        }
+
+        VkSemaphoreWaitInfo wait_info {};
+        wait_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+        wait_info.semaphoreCount = 1;
+        wait_info.pSemaphores = &_timeline_semaphore;
+        wait_info.pValues = &value;
+        VK_CHECK(vkWaitSemaphores(_device, &wait_info, timeout), "Unable to wait for command buffer: {}")
+        return {};
+    }
+
+    /**
+     * This function returns whether the batch with the specified timeline value is executed without blocking.
+     *
+     * @param value The timeline value of the batch
+     * @return      Whether the batch is done
+     *
+     * @author      Cedric Hammes
+     * @since       16/10/2026
+     */
+    auto CommandSubmitter::is_done(uint64_t value) const noexcept -> bool {
+        uint64_t completed_value = 0;
+        if(vkGetSemaphoreCounterValue(_device, _timeline_semaphore, &completed_value) != VK_SUCCESS) {
+            return false;
+        }
+        return completed_value >= value;
+    }
+
+    auto CommandSubmitter::get_timeline_semaphore() const noexcept -> VkSemaphore {
+        return _timeline_semaphore;
+    }
+}// namespace aetherium::renderer::vulkan
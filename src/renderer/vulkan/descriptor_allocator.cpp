@@ -0,0 +1,509 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "aetherium/renderer/vulkan/descriptor_allocator.hpp"
+#include <algorithm>
+#include <spdlog/spdlog.h>
+#include <type_traits>
+
+namespace aetherium::renderer::vulkan {
+    namespace {
+        // The size of new pools doubles until this limit is reached
+        constexpr uint32_t MAX_SETS_PER_POOL = 4096;
+
+        template<typename T>
+        auto append_key(std::string& key, const T& value) noexcept -> void {
+            key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        // Non-dispatchable handles are pointers on 64-bit platforms and 64-bit integers on 32-bit platforms
+        template<typename T>
+        auto get_handle_value(T handle) noexcept -> uint64_t {
+            if constexpr(std::is_pointer_v<T>) {
+                return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(handle));
+            }
+            else {
+                return static_cast<uint64_t>(handle);
+            }
+        }
+
+        auto is_image_descriptor(const VkDescriptorType descriptor_type) noexcept -> bool {
+            switch(descriptor_type) {
+                case VK_DESCRIPTOR_TYPE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT: return true;
+                default: return false;
+            }
+        }
+
+        auto is_texel_buffer_descriptor(const VkDescriptorType descriptor_type) noexcept -> bool {
+            return descriptor_type == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER ||
+                   descriptor_type == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;
+        }
+
+        auto is_buffer_descriptor(const VkDescriptorType descriptor_type) noexcept -> bool {
+            switch(descriptor_type) {
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC: return true;
+                default: return false;
+            }
+        }
+
+        // Descriptors like inline uniform blocks or acceleration structures need extension structs, which aren't
+        // supported by the descriptor writes
+        auto validate_writes(const std::vector<DescriptorWrite>& writes) noexcept -> kstd::Result<void> {
+            for(const auto& write : writes) {
+                if(!is_image_descriptor(write.descriptor_type) && !is_texel_buffer_descriptor(write.descriptor_type) &&
+                   !is_buffer_descriptor(write.descriptor_type)) {
+                    return kstd::Error {fmt::format("Unable to write descriptor set: Descriptor type {} of binding {} "
+                                                    "isn't supported",
+                                                    static_cast<int32_t>(write.descriptor_type), write.binding)};
+                }
+            }
+            return {};
+        }
+
+        auto write_descriptor_set(VkDevice virtual_device, VkDescriptorSet descriptor_set,
+                                  const std::vector<DescriptorWrite>& writes) noexcept -> void {
+            std::vector<VkWriteDescriptorSet> descriptor_writes {};
+            descriptor_writes.reserve(writes.size());
+            for(const auto& write : writes) {
+                VkWriteDescriptorSet descriptor_write {};
+                descriptor_write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+                descriptor_write.dstSet = descriptor_set;
+                descriptor_write.dstBinding = write.binding;
+                descriptor_write.dstArrayElement = write.array_element;
+                descriptor_write.descriptorCount = 1;
+                descriptor_write.descriptorType = write.descriptor_type;
+                if(is_image_descriptor(write.descriptor_type)) {
+                    descriptor_write.pImageInfo = &write.image_info;
+                }
+                else if(is_texel_buffer_descriptor(write.descriptor_type)) {
+                    descriptor_write.pTexelBufferView = &write.texel_buffer_view;
+                }
+                else {
+                    descriptor_write.pBufferInfo = &write.buffer_info;
+                }
+                descriptor_writes.push_back(descriptor_write);
+            }
+            vkUpdateDescriptorSets(virtual_device, static_cast<uint32_t>(descriptor_writes.size()),
+                                   descriptor_writes.data(), 0, nullptr);
+        }
+    }// namespace
+
+    /**
+     * This function returns the default count of descriptors per set and type, which are reserved in the pools of a
+     * descriptor allocator. All descriptor types, which are supported by the descriptor writes, are reserved.
+     *
+     * @return The default pool ratios
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto get_default_pool_ratios() noexcept -> std::vector<DescriptorPoolRatio> {
+        return {{VK_DESCRIPTOR_TYPE_SAMPLER, 0.5f},
+                {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 4.0f},
+                {VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 4.0f},
+                {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1.0f},
+                {VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, 1.0f},
+                {VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER, 1.0f},
+                {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 2.0f},
+                {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 2.0f},
+                {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1.0f},
+                {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1.0f},
+                {VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT, 0.5f}};
+    }
+
+    /**
+     * This constructor creates the descriptor allocator. The first pool is created with the first allocation.
+     *
+     * @param vulkan_device The device, on which the pools are created
+     * @param sets_per_pool The count of sets in the first pool
+     * @param pool_ratios   The count of descriptors per set and type, which are reserved in the pools
+     *
+     * @author              Cedric Hammes
+     * @since               16/10/2026
+     */
+    DescriptorAllocator::DescriptorAllocator(const VulkanDevice* vulkan_device, uint32_t sets_per_pool,
+                                             std::vector<DescriptorPoolRatio> pool_ratios) noexcept :
+            _virtual_device {vulkan_device->get_virtual_device()},
+            _pool_ratios {std::move(pool_ratios)},
+            _sets_per_pool {std::max(sets_per_pool, 1u)} {
+    }
+
+    DescriptorAllocator::~DescriptorAllocator() noexcept {
+        for(const auto descriptor_pool : _ready_pools) {
+            vkDestroyDescriptorPool(_virtual_device, descriptor_pool, nullptr);
+        }
+        for(const auto descriptor_pool : _full_pools) {
+            vkDestroyDescriptorPool(_virtual_device, descriptor_pool, nullptr);
+        }
+        _ready_pools.clear();
+        _full_pools.clear();
+    }
+
+    auto DescriptorAllocator::create_pool() noexcept -> kstd::Result<VkDescriptorPool> {
+        std::vector<VkDescriptorPoolSize> pool_sizes {};
+        pool_sizes.reserve(_pool_ratios.size());
+        for(const auto& pool_ratio : _pool_ratios) {
+            const auto descriptor_count = static_cast<uint32_t>(pool_ratio.ratio * static_cast<float>(_sets_per_pool));
+            pool_sizes.push_back({pool_ratio.descriptor_type, std::max(descriptor_count, 1u)});
+        }
+
+        VkDescriptorPoolCreateInfo descriptor_pool_create_info {};
+        descriptor_pool_create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        descriptor_pool_create_info.maxSets = _sets_per_pool;
+        descriptor_pool_create_info.poolSizeCount = static_cast<uint32_t>(pool_sizes.size());
+        descriptor_pool_create_info.pPoolSizes = pool_sizes.data();
+
+        VkDescriptorPool descriptor_pool {};
+        VK_CHECK(vkCreateDescriptorPool(_virtual_device, &descriptor_pool_create_info, nullptr, &descriptor_pool),
+                 "Unable to create descriptor pool: {}")
+
+        if(_statistics.pool_count > 0) {
+            ++_statistics.growths;
+            SPDLOG_DEBUG("Grew descriptor allocator to {} pools ({} sets in the new pool)",
+                         _statistics.pool_count + 1, _sets_per_pool);
+        }
+        ++_statistics.pool_count;
+        if(_sets_per_pool < MAX_SETS_PER_POOL) {
+            _sets_per_pool = std::min(_sets_per_pool * 2, MAX_SETS_PER_POOL);
+        }
+        return descriptor_pool;
+    }
+
+    /**
+     * This function allocates a descriptor set with the specified layout. If the current pool is exhausted, the
+     * allocation is retried with a new pool.
+     *
+     * @param layout The layout of the descriptor set
+     * @return       The descriptor set or an error
+     *
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto DescriptorAllocator::allocate(VkDescriptorSetLayout layout) noexcept -> kstd::Result<VkDescriptorSet> {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        if(_ready_pools.empty()) {
+            auto descriptor_pool = create_pool();
+            if(descriptor_pool.is_error()) {
+                return kstd::Error {descriptor_pool.get_error()};
+            }
+            _ready_pools.push_back(*descriptor_pool);
+        }
+
+        VkDescriptorSetAllocateInfo descriptor_set_allocate_info {};
+        descriptor_set_allocate_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        descriptor_set_allocate_info.descriptorPool = _ready_pools.back();
+        descriptor_set_allocate_info.descriptorSetCount = 1;
+        descriptor_set_allocate_info.pSetLayouts = &layout;
+
+        VkDescriptorSet descriptor_set {};
+        auto allocate_result =
+                vkAllocateDescriptorSets(_virtual_device, &descriptor_set_allocate_info, &descriptor_set);
+        if(allocate_result == VK_ERROR_OUT_OF_POOL_MEMORY || allocate_result == VK_ERROR_FRAGMENTED_POOL) {
+            ++_statistics.exhaustions;
+            _full_pools.push_back(_ready_pools.back());
+            _ready_pools.pop_back();
+            if(_ready_pools.empty()) {
+                auto descriptor_pool = create_pool();
+                if(descriptor_pool.is_error()) {
+                    return kstd::Error {descriptor_pool.get_error()};
+                }
+                _ready_pools.push_back(*descriptor_pool);
+            }
+
+            descriptor_set_allocate_info.descriptorPool = _ready_pools.back();
+            allocate_result = vkAllocateDescriptorSets(_virtual_device, &descriptor_set_allocate_info, &descriptor_set);
+        }
+        VK_CHECK(allocate_result, "Unable to allocate descriptor set: {}")
+        ++_statistics.allocated_sets;
+        return descriptor_set;
+    }
+
+    /**
+     * This function allocates a descriptor set with the specified layout and writes the specified descriptors
+     * into the set. Descriptors of a type without pool ratio are rejected before the allocation, because no new pool
+     * could ever satisfy them.
+     *
+     * @param layout The layout of the descriptor set
+     * @param writes The descriptors of the set
+     * @return       The descriptor set or an error
+     *
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto DescriptorAllocator::allocate(VkDescriptorSetLayout layout,
+                                       const std::vector<DescriptorWrite>& writes) noexcept
+            -> kstd::Result<VkDescriptorSet> {
+        if(const auto validate_result = validate_writes(writes); validate_result.is_error()) {
+            return kstd::Error {validate_result.get_error()};
+        }
+
+        // Without a pool ratio the allocation would fail with every new pool, and every retry would add a pool
+        for(const auto& write : writes) {
+            if(std::none_of(_pool_ratios.cbegin(), _pool_ratios.cend(), [&](const auto& pool_ratio) {
+                   return pool_ratio.descriptor_type == write.descriptor_type;
+               })) {
+                return kstd::Error {fmt::format("Unable to allocate descriptor set: Descriptor type {} of binding {} "
+                                                "has no pool ratio",
+                                                static_cast<int32_t>(write.descriptor_type), write.binding)};
+            }
+        }
+
+        auto descriptor_set = allocate(layout);
+        if(descriptor_set.is_error()) {
+            return descriptor_set;
+        }
+        write_descriptor_set(_virtual_device, *descriptor_set, writes);
+        return descriptor_set;
+    }
+
+    /**
+     * This function writes the specified descriptors into a descriptor set, which was allocated by this allocator.
+     * The GPU must be done with the set.
+     *
+     * @param descriptor_set The descriptor set
+     * @param writes         The descriptors of the set
+     * @return               Success or an error, if a descriptor type isn't supported
+     *
+     * @author               Cedric Hammes
+     * @since                16/10/2026
+     */
+    auto DescriptorAllocator::write(VkDescriptorSet descriptor_set, const std::vector<DescriptorWrite>& writes) noexcept
+            -> kstd::Result<void> {
+        if(const auto validate_result = validate_writes(writes); validate_result.is_error()) {
+            return validate_result;
+        }
+        write_descriptor_set(_virtual_device, descriptor_set, writes);
+        return {};
+    }
+
+    /**
+     * This function resets all pools at once and frees all descriptor sets of the allocator. The GPU must be done
+     * with all sets.
+     *
+     * @return Success or error
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto DescriptorAllocator::reset() noexcept -> kstd::Result<void> {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        _ready_pools.insert(_ready_pools.end(), _full_pools.begin(), _full_pools.end());
+        _full_pools.clear();
+        for(const auto descriptor_pool : _ready_pools) {
+            VK_CHECK(vkResetDescriptorPool(_virtual_device, descriptor_pool, 0), "Unable to reset descriptor pool: {}")
+        }
+        _statistics.allocated_sets = 0;
+        return {};
+    }
+
+    auto DescriptorAllocator::get_statistics() noexcept -> DescriptorAllocatorStatistics {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        return _statistics;
+    }
+
+    /**
+     * This constructor creates the empty descriptor set cache.
+     *
+     * @param vulkan_device The device, on which the sets are created
+     * @param sets_per_pool The count of sets in the first pool
+     * @param pool_ratios   The count of descriptors per set and type, which are reserved in the pools
+     *
+     * @author              Cedric Hammes
+     * @since               16/10/2026
+     */
+    DescriptorSetCache::DescriptorSetCache(const VulkanDevice* vulkan_device, uint32_t sets_per_pool,
+                                           std::vector<DescriptorPoolRatio> pool_ratios) noexcept :
+            _descriptor_allocator {vulkan_device, sets_per_pool, std::move(pool_ratios)} {
+    }
+
+    /**
+     * This function returns the descriptor set with the specified layout and descriptors. If the set doesn't
+     * exist yet, it's allocated and written.
+     *
+     * @param layout The layout of the descriptor set
+     * @param writes The descriptors of the set
+     * @return       The descriptor set or an error
+     *
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto DescriptorSetCache::get_or_create(VkDescriptorSetLayout layout,
+                                           const std::vector<DescriptorWrite>& writes) noexcept
+            -> kstd::Result<VkDescriptorSet> {
+        // The fields are appended one by one, because the info structs contain padding bytes
+        // The image views, buffers and texel buffer views are remembered, so the sets can be evicted by them
+        std::string key {};
+        std::vector<HandleKey> handle_keys {};
+        append_key(key, layout);
+        for(const auto& write : writes) {
+            append_key(key, write.binding);
+            append_key(key, write.array_element);
+            append_key(key, write.descriptor_type);
+
+            if(is_image_descriptor(write.descriptor_type)) {
+                append_key(key, write.image_info.sampler);
+                append_key(key, write.image_info.imageView);
+                append_key(key, write.image_info.imageLayout);
+                handle_keys.emplace_back(VK_OBJECT_TYPE_IMAGE_VIEW, get_handle_value(write.image_info.imageView));
+            }
+            else if(is_texel_buffer_descriptor(write.descriptor_type)) {
+                append_key(key, write.texel_buffer_view);
+                handle_keys.emplace_back(VK_OBJECT_TYPE_BUFFER_VIEW, get_handle_value(write.texel_buffer_view));
+            }
+            else {
+                append_key(key, write.buffer_info.buffer);
+                append_key(key, write.buffer_info.offset);
+                append_key(key, write.buffer_info.range);
+                handle_keys.emplace_back(VK_OBJECT_TYPE_BUFFER, get_handle_value(write.buffer_info.buffer));
+            }
+        }
+        // Null handles, like the image view of a sampler descriptor, are never evicted
+        handle_keys.erase(std::remove_if(handle_keys.begin(), handle_keys.end(),
+                                         [](const auto& handle_key) { return handle_key.second == 0; }),
+                          handle_keys.end());
+        std::sort(handle_keys.begin(), handle_keys.end());
+        handle_keys.erase(std::unique(handle_keys.begin(), handle_keys.end()), handle_keys.end());
+
+        const std::lock_guard<std::mutex> lock {_mutex};
+        if(const auto iterator = _descriptor_sets.find(key); iterator != _descriptor_sets.end()) {
+            return iterator->second.descriptor_set;
+        }
+
+        // Evicted sets of the same layout are rewritten before a new set is allocated
+        VkDescriptorSet descriptor_set {};
+        if(auto free_sets = _free_sets.find(layout); free_sets != _free_sets.end() && !free_sets->second.empty()) {
+            if(const auto write_result = _descriptor_allocator.write(free_sets->second.back(), writes);
+               write_result.is_error()) {
+                return kstd::Error {write_result.get_error()};
+            }
+            descriptor_set = free_sets->second.back();
+            free_sets->second.pop_back();
+        }
+        else {
+            const auto allocate_result = _descriptor_allocator.allocate(layout, writes);
+            if(allocate_result.is_error()) {
+                return allocate_result;
+            }
+            descriptor_set = *allocate_result;
+        }
+
+        for(const auto& handle_key : handle_keys) {
+            _keys_by_handle[handle_key].push_back(key);
+        }
+        _descriptor_sets.emplace(std::move(key), CachedSet {descriptor_set, layout, std::move(handle_keys)});
+        return descriptor_set;
+    }
+
+    auto DescriptorSetCache::evict_handle(const HandleKey& handle_key) noexcept -> void {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        const auto iterator = _keys_by_handle.find(handle_key);
+        if(iterator == _keys_by_handle.end()) {
+            return;
+        }
+
+        // The evicted sets are removed from the lists of their other handles, so the lists don't keep stale keys
+        auto keys = std::move(iterator->second);
+        _keys_by_handle.erase(iterator);
+        for(const auto& key : keys) {
+            const auto cached_set = _descriptor_sets.find(key);
+            if(cached_set == _descriptor_sets.end()) {
+                continue;
+            }
+
+            for(const auto& other_handle_key : cached_set->second.handle_keys) {
+                const auto other_keys = _keys_by_handle.find(other_handle_key);
+                if(other_keys == _keys_by_handle.end()) {
+                    continue;
+                }
+                auto& other_key_list = other_keys->second;
+                other_key_list.erase(std::remove(other_key_list.begin(), other_key_list.end(), key),
+                                     other_key_list.end());
+                if(other_key_list.empty()) {
+                    _keys_by_handle.erase(other_keys);
+                }
+            }
+            _free_sets[cached_set->second.layout].push_back(cached_set->second.descriptor_set);
+            _descriptor_sets.erase(cached_set);
+        }
+    }
+
+    /**
+     * This function removes all cached sets, which reference the specified image view. It has to be called before the
+     * image view is destroyed, because the driver may reuse the handle for a new view. The GPU must be done with the
+     * evicted sets, because they're rewritten by later sets with the same layout.
+     *
+     * @param image_view The image view, which is destroyed
+     *
+     * @author           Cedric Hammes
+     * @since            16/10/2026
+     */
+    auto DescriptorSetCache::evict_image_view(VkImageView image_view) noexcept -> void {
+        evict_handle({VK_OBJECT_TYPE_IMAGE_VIEW, get_handle_value(image_view)});
+    }
+
+    /**
+     * This function removes all cached sets, which reference the specified buffer. It has to be called before the
+     * buffer is destroyed, because the driver may reuse the handle for a new buffer.
+     *
+     * @param buffer The buffer, which is destroyed
+     *
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto DescriptorSetCache::evict_buffer(VkBuffer buffer) noexcept -> void {
+        evict_handle({VK_OBJECT_TYPE_BUFFER, get_handle_value(buffer)});
+    }
+
+    /**
+     * This function removes all cached sets, which reference the specified texel buffer view. It has to be called
+     * before the view is destroyed, because the driver may reuse the handle for a new view.
+     *
+     * @param buffer_view The texel buffer view, which is destroyed
+     *
+     * @author            Cedric Hammes
+     * @since             16/10/2026
+     */
+    auto DescriptorSetCache::evict_buffer_view(VkBufferView buffer_view) noexcept -> void {
+        evict_handle({VK_OBJECT_TYPE_BUFFER_VIEW, get_handle_value(buffer_view)});
+    }
+
+    /**
+     * This function removes all cached sets and resets the pools of the cache, for example after a hot reload
+     * destroyed the resources of the sets. The GPU must be done with all sets of the cache.
+     *
+     * @return Success or error
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto DescriptorSetCache::clear() noexcept -> kstd::Result<void> {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        _descriptor_sets.clear();
+        _keys_by_handle.clear();
+        _free_sets.clear();
+        return _descriptor_allocator.reset();
+    }
+
+    auto DescriptorSetCache::get_statistics() noexcept -> DescriptorAllocatorStatistics {
+        return _descriptor_allocator.get_statistics();
+    }
+}// namespace aetherium::renderer::vulkan
@@ -13,9 +13,63 @@
 // limitations under the License.
 
 #include "aetherium/renderer/vulkan/device.hpp"
+#include "aetherium/renderer/vulkan/allocator.hpp"
 #include "aetherium/renderer/vulkan/fence.hpp"
+#include "aetherium/renderer/vulkan/staging_ring.hpp"
+#include <algorithm>
+#include <spdlog/spdlog.h>
 
 namespace aetherium::renderer::vulkan {
+    namespace {
+        constexpr auto invalid_queue_family = std::numeric_limits<uint32_t>::max();
+
+        auto find_queue_family(const std::vector<VkQueueFamilyProperties>& queue_families, VkQueueFlags required_flags,
+                               VkQueueFlags excluded_flags) -> uint32_t {
+            for(uint32_t i = 0; i < queue_families.size(); i++) {
+                const auto flags = queue_families[i].queueFlags;
+                if(queue_families[i].queueCount > 0 && (flags & required_flags) == required_flags &&
+                   (flags & excluded_flags) == 0) {
+                    return i;
+                }
+            }
+            return invalid_queue_family;
+        }
+
+        auto select_queue_families(VkPhysicalDevice physical_device) -> std::array<uint32_t, 3> {
+            using namespace std::string_literals;
+
+            uint32_t family_count = 0;
+            vkGetPhysicalDeviceQueueFamilyProperties(physical_device, &family_count, nullptr);
+            std::vector<VkQueueFamilyProperties> queue_families {family_count};
+            vkGetPhysicalDeviceQueueFamilyProperties(physical_device, &family_count, queue_families.data());
+
+            std::array<uint32_t, 3> family_indices {};
+            family_indices[GRAPHICS] = find_queue_family(queue_families, VK_QUEUE_GRAPHICS_BIT, 0);
+            if(family_indices[GRAPHICS] == invalid_queue_family) {
+                throw std::runtime_error {"Unable to create device: No graphics queue family available"s};
+            }
+
+            // Prefer a compute family without graphics support for async compute
+            family_indices[COMPUTE] = find_queue_family(queue_families, VK_QUEUE_COMPUTE_BIT, VK_QUEUE_GRAPHICS_BIT);
+            if(family_indices[COMPUTE] == invalid_queue_family) {
+                family_indices[COMPUTE] = family_indices[GRAPHICS];
+            }
+
+            // Prefer a pure transfer (DMA) family, then any non-graphics family with transfer support. Graphics and
+            // compute families support transfer operations implicitly.
+            family_indices[TRANSFER] = find_queue_family(queue_families, VK_QUEUE_TRANSFER_BIT,
+                                                         VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT);
+            if(family_indices[TRANSFER] == invalid_queue_family) {
+                family_indices[TRANSFER] =
+                        find_queue_family(queue_families, VK_QUEUE_TRANSFER_BIT, VK_QUEUE_GRAPHICS_BIT);
+            }
+            if(family_indices[TRANSFER] == invalid_queue_family) {
+                family_indices[TRANSFER] = family_indices[COMPUTE];
+            }
+            return family_indices;
+        }
+    }// namespace
+
     /**
      * This constructor creates an empty vulkan device
      *
@@ -26,7 +80,13 @@ namespace aetherium::renderer::vulkan {
             _physical_device {nullptr},
             _virtual_device {nullptr},
             _properties {},
-            _graphics_queue {nullptr} {
+            _supports_descriptor_indexing {false},
+            _queues {},
+            _queues_by_type {},
+            _command_submitters {},
+            _command_submitters_by_type {},
+            _memory_allocator {},
+            _staging_ring {} {
     }
 
     /**
@@ -38,53 +98,132 @@ namespace aetherium::renderer::vulkan {
      * @since  04/02/2024
      */
     VulkanDevice::VulkanDevice(VkPhysicalDevice physical_device) :// NOLINT
-            _physical_device {physical_device} {
+            _physical_device {physical_device},
+            _supports_descriptor_indexing {false},
+            _queues {},
+            _queues_by_type {},
+            _command_submitters {},
+            _command_submitters_by_type {} {
         constexpr auto queue_property = 1.0f;
         const std::vector<const char*> device_extensions = {VK_KHR_SWAPCHAIN_EXTENSION_NAME};
 
         vkGetPhysicalDeviceProperties(_physical_device, &_properties);
-        // TODO: Get queue family properties and generate queue store
+
+        // Select queue families and create one queue per unique family
+        const auto family_indices = select_queue_families(_physical_device);
+        std::vector<uint32_t> unique_family_indices {};
+        for(const auto family_index : family_indices) {
+            if(std::find(unique_family_indices.cbegin(), unique_family_indices.cend(), family_index) ==
+               unique_family_indices.cend()) {
+                unique_family_indices.push_back(family_index);
+            }
+        }
+        SPDLOG_DEBUG("Using queue families {} (graphics), {} (compute) and {} (transfer)", family_indices[GRAPHICS],
+                     family_indices[COMPUTE], family_indices[TRANSFER]);
+
+        std::vector<VkDeviceQueueCreateInfo> device_queue_create_infos {};
+        for(const auto family_index : unique_family_indices) {
+            VkDeviceQueueCreateInfo device_queue_create_info {};
+            device_queue_create_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+            device_queue_create_info.queueCount = 1;
+            device_queue_create_info.queueFamilyIndex = family_index;
+            device_queue_create_info.pQueuePriorities = &queue_property;
+            device_queue_create_infos.push_back(device_queue_create_info);
+        }
 
         // Create device
+        VkPhysicalDeviceVulkan12Features vulkan12_features {};
+        vulkan12_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        vulkan12_features.timelineSemaphore = VK_TRUE;
+
+        // Enable descriptor indexing for the bindless descriptor heap, if the device supports it
+        VkPhysicalDeviceVulkan12Features supported_vulkan12_features {};
+        supported_vulkan12_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        VkPhysicalDeviceFeatures2 supported_features {};
+        supported_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        supported_features.pNext = &supported_vulkan12_features;
+        vkGetPhysicalDeviceFeatures2(_physical_device, &supported_features);
+        _supports_descriptor_indexing = supported_vulkan12_features.descriptorIndexing &&
+                                        supported_vulkan12_features.runtimeDescriptorArray &&
+                                        supported_vulkan12_features.descriptorBindingPartiallyBound &&
+                                        supported_vulkan12_features.descriptorBindingSampledImageUpdateAfterBind &&
+                                        supported_vulkan12_features.descriptorBindingStorageBufferUpdateAfterBind &&
+                                        supported_vulkan12_features.shaderSampledImageArrayNonUniformIndexing &&
+                                        supported_vulkan12_features.shaderStorageBufferArrayNonUniformIndexing;
+        if(_supports_descriptor_indexing) {
+            vulkan12_features.descriptorIndexing = VK_TRUE;
+            vulkan12_features.runtimeDescriptorArray = VK_TRUE;
+            vulkan12_features.descriptorBindingPartiallyBound = VK_TRUE;
+            vulkan12_features.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+            vulkan12_features.descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+            vulkan12_features.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+            vulkan12_features.shaderStorageBufferArrayNonUniformIndexing = VK_TRUE;
+        }
+
         VkPhysicalDeviceVulkan13Features vulkan13_features {};
         vulkan13_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES;
+        vulkan13_features.pNext = &vulkan12_features;
         vulkan13_features.dynamicRendering = VK_TRUE;
+        vulkan13_features.synchronization2 = VK_TRUE;
 
         VkPhysicalDeviceFeatures2 features {};
         features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
         features.pNext = &vulkan13_features;
 
-        VkDeviceQueueCreateInfo device_queue_create_info {};
-        device_queue_create_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-        device_queue_create_info.queueCount = 1;
-        device_queue_create_info.queueFamilyIndex = 0;
-        device_queue_create_info.pQueuePriorities = &queue_property;
-
         VkDeviceCreateInfo device_create_info {};
         device_create_info.pNext = &features;
         device_create_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-        device_create_info.pQueueCreateInfos = &device_queue_create_info;
-        device_create_info.queueCreateInfoCount = 1;
+        device_create_info.pQueueCreateInfos = device_queue_create_infos.data();
+        device_create_info.queueCreateInfoCount = static_cast<uint32_t>(device_queue_create_infos.size());
         device_create_info.enabledLayerCount = 0;
         device_create_info.enabledExtensionCount = device_extensions.size();
         device_create_info.ppEnabledExtensionNames = device_extensions.data();
         VK_CHECK_EX(vkCreateDevice(_physical_device, &device_create_info, nullptr, &_virtual_device),
                     "Unable to create device: {}")
         volkLoadDevice(_virtual_device);
-        vkGetDeviceQueue(_virtual_device, 0, 0, &_graphics_queue);
+
+        // Generate queue store, types without a dedicated family share the queue of the fallback family
+        for(const auto family_index : unique_family_indices) {
+            VkQueue queue_handle = nullptr;
+            vkGetDeviceQueue(_virtual_device, family_index, 0, &queue_handle);
+            _queues.push_back(std::make_unique<Queue>(queue_handle, family_index));
+            _command_submitters.push_back(std::make_unique<CommandSubmitter>(_virtual_device, _queues.back().get()));
+        }
+        for(size_t type = 0; type < family_indices.size(); type++) {
+            for(size_t i = 0; i < _queues.size(); i++) {
+                if(_queues[i]->get_family_index() == family_indices[type]) {
+                    _queues_by_type[type] = _queues[i].get();
+                    _command_submitters_by_type[type] = _command_submitters[i].get();
+                }
+            }
+        }
+        _memory_allocator = std::make_unique<MemoryAllocator>(_physical_device, _virtual_device);
+        _staging_ring = std::make_unique<StagingRing>(_virtual_device, _memory_allocator.get(),
+                                                      _command_submitters_by_type[TRANSFER]);
     }
 
     VulkanDevice::VulkanDevice(VulkanDevice&& other) noexcept :
             _physical_device {other._physical_device},
             _virtual_device {other._virtual_device},
             _properties {other._properties},
-            _graphics_queue {other._graphics_queue} {
+            _supports_descriptor_indexing {other._supports_descriptor_indexing},
+            _queues {std::move(other._queues)},
+            _queues_by_type {other._queues_by_type},
+            _command_submitters {std::move(other._command_submitters)},
+            _command_submitters_by_type {other._command_submitters_by_type},
+            _memory_allocator {std::move(other._memory_allocator)},
+            _staging_ring {std::move(other._staging_ring)} {
         other._physical_device = nullptr;
         other._virtual_device = nullptr;
-        other._graphics_queue = nullptr;
+        other._queues_by_type = {};
+        other._command_submitters_by_type = {};
     }
 
     VulkanDevice::~VulkanDevice() noexcept {
+        // The staging ring, submitters and memory blocks have to be destroyed before the device itself
+        _staging_ring.reset();
+        _command_submitters.clear();
+        _memory_allocator.reset();
         if(_virtual_device != nullptr) {
             vkDestroyDevice(_virtual_device, nullptr);
             _virtual_device = nullptr;
@@ -92,50 +231,34 @@ namespace aetherium::renderer::vulkan {
     }
 
     /**
-     * This function creates a one-time command buffer and executes the specified function. After the run, the
-     * command buffer get submitted into the queue and the program waits for the execution.
+     * This function records the enqueued uploads of the staging ring and submits the pending command buffers of all
+     * queues with a single submit per queue. The renderer calls this function once per frame and waits for the
+     * returned tickets in the submit of the frame, so the frame is ordered after the uploads.
      *
-     * @tparam F       The function type
-     * @param function The function itself
-     * @return         Nothing or an error
+     * @return The tickets of the last batch of every queue or an error
      *
-     * @author         Cedric Hammes
-     * @since          06/02/2024
+     * @author Cedric Hammes
+     * @since  16/10/2026
      */
-    template<typename F>
-    auto VulkanDevice::emit_command_buffer(F&& function) const noexcept -> kstd::Result<void> {
-        static_assert(std::is_convertible_v<F, std::function<void(CommandBuffer&)>>, "Invalid command buffer consumer");
-
-        // Create command buffer and submit fence
-        const auto command_pool = kstd::try_construct<CommandPool>(this);
-        if(command_pool.is_error()) {
-            return kstd::Error {command_pool.get_error()};
+    auto VulkanDevice::flush_command_buffers() const noexcept -> kstd::Result<std::vector<SubmitTicket>> {
+        if(const auto staging_result = _staging_ring->flush(); staging_result.is_error()) {
+            return kstd::Error {staging_result.get_error()};
         }
 
-        const auto command_buffer = std::move(command_pool->allocate_command_buffers(1).get_or_throw()[0]);
-        const auto submit_fence = VulkanFence {this};
-        const auto raw_command_buffer = *command_buffer;
-
-        // Perform operation
-        if(const auto begin_result = command_buffer.begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
-           begin_result.is_error()) {
-            return begin_result;
-        }
-        function(&command_buffer);
-        if(const auto end_result = command_buffer.end(); end_result.is_error()) {
-            return end_result;
+        std::vector<SubmitTicket> tickets {};
+        tickets.reserve(_command_submitters.size());
+        for(const auto& command_submitter : _command_submitters) {
+            const auto flush_result = command_submitter->flush();
+            if(flush_result.is_error()) {
+                return kstd::Error {flush_result.get_error()};
+            }
+            tickets.push_back(*flush_result);
         }
+        return tickets;
+    }
 
-        // Submit
-        VkSubmitInfo submit_info {};
-        submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submit_info.pCommandBuffers = &raw_command_buffer;
-        submit_info.commandBufferCount = 1;
-        vkQueueSubmit(_graphics_queue, 1, &submit_info, *submit_fence);
-        if(const auto wait_result = submit_fence.wait_for(); wait_result.is_error()) {
-            return wait_result;
-        }
-        return {};
+    auto VulkanDevice::get_command_submitter(QueueType queue_type) const noexcept -> CommandSubmitter& {
+        return *_command_submitters_by_type.at(queue_type);
     }
 
     auto VulkanDevice::get_physical_device() const noexcept -> VkPhysicalDevice {
@@ -146,18 +269,73 @@ namespace aetherium::renderer::vulkan {
         return _virtual_device;
     }
 
-    auto VulkanDevice::get_graphics_queue() const noexcept -> VkQueue {
-        return _graphics_queue;
+    auto VulkanDevice::get_properties() const noexcept -> const VkPhysicalDeviceProperties& {
+        return _properties;
+    }
+
+    /**
+     * This function returns whether the device supports the descriptor indexing features, which are needed by the
+     * bindless descriptor heap. The features are enabled on creation, if they're supported.
+     *
+     * @return Whether descriptor indexing is supported and enabled
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto VulkanDevice::supports_descriptor_indexing() const noexcept -> bool {
+        return _supports_descriptor_indexing;
+    }
+
+    /**
+     * This function returns the queue for the specified type of work. If the device doesn't provide a dedicated queue
+     * family for the type, the queue is shared with another type.
+     *
+     * @param queue_type The type of work
+     * @return           The queue for the type
+     *
+     * @author           Cedric Hammes
+     * @since            16/10/2026
+     */
+    auto VulkanDevice::get_queue(QueueType queue_type) const noexcept -> const Queue& {
+        return *_queues_by_type.at(queue_type);
+    }
+
+    auto VulkanDevice::get_graphics_queue() const noexcept -> const Queue& {
+        return get_queue(GRAPHICS);
+    }
+
+    auto VulkanDevice::get_compute_queue() const noexcept -> const Queue& {
+        return get_queue(COMPUTE);
+    }
+
+    auto VulkanDevice::get_transfer_queue() const noexcept -> const Queue& {
+        return get_queue(TRANSFER);
+    }
+
+    auto VulkanDevice::get_memory_allocator() const noexcept -> MemoryAllocator& {
+        return *_memory_allocator;
+    }
+
+    auto VulkanDevice::get_staging_ring() const noexcept -> StagingRing& {
+        return *_staging_ring;
     }
 
     auto VulkanDevice::operator=(VulkanDevice&& other) noexcept -> VulkanDevice& {
+        // The old staging ring still references the old memory allocator
+        _staging_ring = std::move(other._staging_ring);
         _physical_device = other._physical_device;
         _virtual_device = other._virtual_device;
         _properties = other._properties;
-        _graphics_queue = other._graphics_queue;
+        _supports_descriptor_indexing = other._supports_descriptor_indexing;
+        _queues = std::move(other._queues);
+        _queues_by_type = other._queues_by_type;
+        _command_submitters = std::move(other._command_submitters);
+        _command_submitters_by_type = other._command_submitters_by_type;
+        _memory_allocator = std::move(other._memory_allocator);
         other._physical_device = nullptr;
         other._virtual_device = nullptr;
-        other._graphics_queue = nullptr;
+        other._queues_by_type = {};
+        other._command_submitters_by_type = {};
         return *this;
     }
 
@@ -169,32 +347,39 @@ namespace aetherium::renderer::vulkan {
      */
     CommandBuffer::CommandBuffer() noexcept :// NOLINT
             _command_pool {nullptr},
-            _command_buffer {nullptr} {
+            _command_buffer {nullptr},
+            _is_borrowed {false} {
     }
 
     /**
-     * This constructor creates a command buffer with the specified command buffer and the command pool.
+     * This constructor creates a command buffer with the specified command buffer and the command pool. Borrowed
+     * command buffers are owned by the pool and are not freed by the destructor.
      *
      * @param command_pool   The command pool with which the buffer was allocated
      * @param command_buffer The command buffer itself
+     * @param is_borrowed    Whether the command buffer is owned by the pool
      *
      * @author               Cedric Hammes
      * @since                06/02/2024
      */
-    CommandBuffer::CommandBuffer(const CommandPool* command_pool, VkCommandBuffer command_buffer) :// NOLINT
+    CommandBuffer::CommandBuffer(const CommandPool* command_pool, VkCommandBuffer command_buffer,// NOLINT
+                                 bool is_borrowed) :
             _command_pool {command_pool},
-            _command_buffer {command_buffer} {
+            _command_buffer {command_buffer},
+            _is_borrowed {is_borrowed} {
     }
 
     CommandBuffer::CommandBuffer(CommandBuffer&& other) noexcept :// NOLINT
             _command_pool {other._command_pool},
-            _command_buffer {other._command_buffer} {
+            _command_buffer {other._command_buffer},
+            _is_borrowed {other._is_borrowed} {
         other._command_pool = nullptr;
         other._command_buffer = nullptr;
+        other._is_borrowed = false;
     }
 
     CommandBuffer::~CommandBuffer() noexcept {
-        if(_command_buffer != nullptr) {
+        if(_command_buffer != nullptr && !_is_borrowed) {
             vkFreeCommandBuffers(_command_pool->_vulkan_device->get_virtual_device(), _command_pool->_command_pool, 1,
                                  &_command_buffer);
             _command_buffer = nullptr;
@@ -219,8 +404,10 @@ namespace aetherium::renderer::vulkan {
     auto CommandBuffer::operator=(CommandBuffer&& other) noexcept -> CommandBuffer& {
         _command_pool = other._command_pool;
         _command_buffer = other._command_buffer;
+        _is_borrowed = other._is_borrowed;
         other._command_pool = nullptr;
         other._command_buffer = nullptr;
+        other._is_borrowed = false;
         return *this;
     }
 
@@ -236,24 +423,31 @@ namespace aetherium::renderer::vulkan {
      */
     CommandPool::CommandPool() noexcept :// NOLINT
             _vulkan_device {nullptr},
-            _command_pool {nullptr} {
+            _command_pool {nullptr},
+            _queue_family_index {0},
+            _used_command_buffers {0} {
     }
 
     /**
-     * This constructor creates a command pool by the specified device
+     * This constructor creates a command pool by the specified device for the queue family of the specified queue type.
      *
      * @param vulkan_device The device for the pool
+     * @param queue_type    The type of the queue, to which the command buffers are submitted
+     * @param flags         The flags, with which the pool is created
      *
      * @author              Cedric Hammes
      * @since               06/02/2024
      */
-    CommandPool::CommandPool(const VulkanDevice* vulkan_device) :// NOLINT
+    CommandPool::CommandPool(const VulkanDevice* vulkan_device, QueueType queue_type,// NOLINT
+                             VkCommandPoolCreateFlags flags) :
             _vulkan_device {vulkan_device},
-            _command_pool {} {
+            _command_pool {},
+            _queue_family_index {vulkan_device->get_queue(queue_type).get_family_index()},
+            _used_command_buffers {0} {
         VkCommandPoolCreateInfo command_pool_create_info {};
         command_pool_create_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-        command_pool_create_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-        command_pool_create_info.queueFamilyIndex = 0;
+        command_pool_create_info.flags = flags;
+        command_pool_create_info.queueFamilyIndex = _queue_family_index;
         VK_CHECK_EX(vkCreateCommandPool(vulkan_device->get_virtual_device(), &command_pool_create_info, nullptr,
                                         &_command_pool),
                     "Unable to create command pool: {}")
@@ -261,12 +455,18 @@ namespace aetherium::renderer::vulkan {
 
     CommandPool::CommandPool(CommandPool&& other) noexcept ://NOLINT
             _vulkan_device {other._vulkan_device},
-            _command_pool {other._command_pool} {
+            _command_pool {other._command_pool},
+            _queue_family_index {other._queue_family_index},
+            _recycled_command_buffers {std::move(other._recycled_command_buffers)},
+            _used_command_buffers {other._used_command_buffers} {
         other._vulkan_device = nullptr;
         other._command_pool = nullptr;
+        other._recycled_command_buffers = {};
+        other._used_command_buffers = 0;
     }
 
     CommandPool::~CommandPool() noexcept {
+        // The recycled command buffers are freed implicitly with the pool
         if(_command_pool != nullptr) {
             vkDestroyCommandPool(_vulkan_device->get_virtual_device(), _command_pool, nullptr);
             _command_pool = nullptr;
@@ -302,11 +502,65 @@ namespace aetherium::renderer::vulkan {
         return command_buffers;
     }
 
+    /**
+     * This function returns a borrowed command buffer from the free list of the pool. A new command buffer is only
+     * allocated when all recycled command buffers are in use since the last reset. Borrowed command buffers stay owned
+     * by the pool and are returned to the free list by the next reset.
+     *
+     * @return The borrowed command buffer or an error
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto CommandPool::acquire_command_buffer() noexcept -> kstd::Result<CommandBuffer> {
+        if(_used_command_buffers < _recycled_command_buffers.size()) {
+            return CommandBuffer {this, _recycled_command_buffers[_used_command_buffers++], true};
+        }
+
+        VkCommandBufferAllocateInfo allocate_info {};
+        allocate_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocate_info.commandBufferCount = 1;
+        allocate_info.commandPool = _command_pool;
+
+        VkCommandBuffer command_buffer = nullptr;
+        VK_CHECK(vkAllocateCommandBuffers(_vulkan_device->get_virtual_device(), &allocate_info, &command_buffer),
+                 "Unable to allocate buffers {}")
+        _recycled_command_buffers.push_back(command_buffer);
+        _used_command_buffers++;
+        return CommandBuffer {this, command_buffer, true};
+    }
+
+    /**
+     * This function resets all command buffers of the pool at once and returns the borrowed command buffers to the free
+     * list. The memory of the pool is kept, so the recording of the next frame doesn't hit the driver allocator. The
+     * GPU must be done with all command buffers of the pool.
+     *
+     * @return Success or error
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto CommandPool::reset() noexcept -> kstd::Result<void> {
+        VK_CHECK(vkResetCommandPool(_vulkan_device->get_virtual_device(), _command_pool, 0),
+                 "Unable to reset command pool: {}")
+        _used_command_buffers = 0;
+        return {};
+    }
+
+    auto CommandPool::get_queue_family_index() const noexcept -> uint32_t {
+        return _queue_family_index;
+    }
+
     auto CommandPool::operator=(CommandPool&& other) noexcept -> CommandPool& {
         _vulkan_device = other._vulkan_device;
         _command_pool = other._command_pool;
+        _queue_family_index = other._queue_family_index;
+        _recycled_command_buffers = std::move(other._recycled_command_buffers);
+        _used_command_buffers = other._used_command_buffers;
         other._vulkan_device = nullptr;
         other._command_pool = nullptr;
+        other._recycled_command_buffers = {};
+        other._used_command_buffers = 0;
         return *this;
     }
 
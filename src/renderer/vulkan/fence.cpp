@@ -20,16 +20,18 @@ namespace aetherium::renderer::vulkan {
      * This constructor creates the fence by the specified device. This fence is used to wait on the CPU-site for
      * operations on the GPU.
      *
-     * @param device The device on which the fence is to be created
+     * @param device   The device on which the fence is to be created
+     * @param signaled Whether the fence is created in the signaled state
      *
-     * @author       Cedric Hammes
-     * @since        09/02/2024
+     * @author         Cedric Hammes
+     * @since          09/02/2024
      */
-    VulkanFence::VulkanFence(const VulkanDevice* device) :
+    VulkanFence::VulkanFence(const VulkanDevice* device, bool signaled) :
             _device {device},
             _fence_handle {nullptr} {
         VkFenceCreateInfo fence_create_info = {};
         fence_create_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        fence_create_info.flags = signaled ? VK_FENCE_CREATE_SIGNALED_BIT : 0;
         VK_CHECK_EX(vkCreateFence(_device->get_virtual_device(), &fence_create_info, nullptr, &_fence_handle),
                     "Unable to create fence: {}")
     }
@@ -64,6 +66,19 @@ namespace aetherium::renderer::vulkan {
         return {};
     }
 
+    /**
+     * This function resets the fence into the unsignaled state, so it can be reused for the next submit.
+     *
+     * @return Success or error
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto VulkanFence::reset() const noexcept -> kstd::Result<void> {
+        VK_CHECK(vkResetFences(_device->get_virtual_device(), 1, &_fence_handle), "Unable to reset fence: {}")
+        return {};
+    }
+
     auto VulkanFence::operator=(VulkanFence&& other) noexcept -> VulkanFence& {
         _device = other._device;
         _fence_handle = other._fence_handle;
@@ -0,0 +1,436 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "aetherium/renderer/vulkan/pipeline.hpp"
+#include <array>
+#include <cstring>
+#include <memory>
+#include <spdlog/spdlog.h>
+
+namespace aetherium::renderer::vulkan {
+    namespace {
+        template<typename T>
+        auto hash_values(const T* values, size_t count, uint64_t hash) noexcept -> uint64_t {
+            return fnv1a_hash({reinterpret_cast<const char*>(values), sizeof(T) * count}, hash);
+        }
+
+        // All Vulkan descriptions in the state are plain 32-bit fields without padding, so they're compared by bytes
+        template<typename T>
+        auto are_values_equal(const std::vector<T>& values, const std::vector<T>& other_values) noexcept -> bool {
+            return values.size() == other_values.size() &&
+                   (values.empty() || std::memcmp(values.data(), other_values.data(), sizeof(T) * values.size()) == 0);
+        }
+    }// namespace
+
+    /**
+     * This function hashes the complete state into a single key.
+     *
+     * @return The hash of the state
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto GraphicsPipelineState::get_hash() const noexcept -> uint64_t {
+        auto hash = FNV_OFFSET_BASIS;
+        for(const auto& shader_stage : shader_stages) {
+            hash = hash_values(&shader_stage.stage, 1, hash);
+            hash = hash_values(&shader_stage.module, 1, hash);
+            hash = hash_values(&shader_stage.module_id, 1, hash);
+            hash = fnv1a_hash(shader_stage.entry_point, hash);
+        }
+        hash = hash_values(vertex_bindings.data(), vertex_bindings.size(), hash);
+        hash = hash_values(vertex_attributes.data(), vertex_attributes.size(), hash);
+
+        const uint32_t depth_flags = (depth_test ? 1U : 0U) | (depth_write ? 2U : 0U);
+        const std::array<uint32_t, 8> fixed_state {static_cast<uint32_t>(topology),
+                                                   static_cast<uint32_t>(polygon_mode),
+                                                   static_cast<uint32_t>(cull_mode),
+                                                   static_cast<uint32_t>(front_face),
+                                                   static_cast<uint32_t>(sample_count),
+                                                   depth_flags,
+                                                   static_cast<uint32_t>(depth_compare_op),
+                                                   static_cast<uint32_t>(depth_format)};
+        hash = hash_values(fixed_state.data(), fixed_state.size(), hash);
+        hash = hash_values(&stencil_format, 1, hash);
+        hash = hash_values(color_formats.data(), color_formats.size(), hash);
+        hash = hash_values(color_blend_attachments.data(), color_blend_attachments.size(), hash);
+        hash = hash_values(&layout, 1, hash);
+        return hash_values(dynamic_states.data(), dynamic_states.size(), hash);
+    }
+
+    auto GraphicsPipelineState::operator==(const GraphicsPipelineState& other) const noexcept -> bool {
+        if(shader_stages.size() != other.shader_stages.size()) {
+            return false;
+        }
+        for(size_t i = 0; i < shader_stages.size(); i++) {
+            const auto& shader_stage = shader_stages[i];
+            const auto& other_shader_stage = other.shader_stages[i];
+            if(shader_stage.stage != other_shader_stage.stage || shader_stage.module != other_shader_stage.module ||
+               shader_stage.module_id != other_shader_stage.module_id ||
+               shader_stage.entry_point != other_shader_stage.entry_point) {
+                return false;
+            }
+        }
+
+        return topology == other.topology && polygon_mode == other.polygon_mode && cull_mode == other.cull_mode &&
+               front_face == other.front_face && sample_count == other.sample_count &&
+               depth_test == other.depth_test && depth_write == other.depth_write &&
+               depth_compare_op == other.depth_compare_op && depth_format == other.depth_format &&
+               stencil_format == other.stencil_format && layout == other.layout &&
+               are_values_equal(vertex_bindings, other.vertex_bindings) &&
+               are_values_equal(vertex_attributes, other.vertex_attributes) &&
+               are_values_equal(color_formats, other.color_formats) &&
+               are_values_equal(color_blend_attachments, other.color_blend_attachments) &&
+               are_values_equal(dynamic_states, other.dynamic_states);
+    }
+
+    auto GraphicsPipelineBuilder::with_shader_stage(VkShaderStageFlagBits stage, VkShaderModule module,
+                                                    std::string entry_point) noexcept -> GraphicsPipelineBuilder& {
+        return with_shader_stage(stage, module, 0, std::move(entry_point));
+    }
+
+    /**
+     * This function adds a shader stage with the specified shader module to the pipeline. The module id is part of
+     * the pipeline key, so the pipelines of a reloaded shader are never shared with the old module.
+     *
+     * @param stage       The stage of the shader
+     * @param module      The shader module
+     * @param module_id   The unique id of the shader module
+     * @param entry_point The name of the entry point function
+     * @return            The builder itself
+     *
+     * @author            Cedric Hammes
+     * @since             16/10/2026
+     */
+    auto GraphicsPipelineBuilder::with_shader_stage(VkShaderStageFlagBits stage, VkShaderModule module,
+                                                    uint64_t module_id, std::string entry_point) noexcept
+            -> GraphicsPipelineBuilder& {
+        _state.shader_stages.push_back({stage, module, module_id, std::move(entry_point)});
+        return *this;
+    }
+
+    auto GraphicsPipelineBuilder::with_vertex_binding(uint32_t binding, uint32_t stride,
+                                                      VkVertexInputRate input_rate) noexcept
+            -> GraphicsPipelineBuilder& {
+        _state.vertex_bindings.push_back({binding, stride, input_rate});
+        return *this;
+    }
+
+    auto GraphicsPipelineBuilder::with_vertex_attribute(uint32_t location, uint32_t binding, VkFormat format,
+                                                        uint32_t offset) noexcept -> GraphicsPipelineBuilder& {
+        _state.vertex_attributes.push_back({location, binding, format, offset});
+        return *this;
+    }
+
+    auto GraphicsPipelineBuilder::with_topology(VkPrimitiveTopology topology) noexcept -> GraphicsPipelineBuilder& {
+        _state.topology = topology;
+        return *this;
+    }
+
+    auto GraphicsPipelineBuilder::with_polygon_mode(VkPolygonMode polygon_mode) noexcept -> GraphicsPipelineBuilder& {
+        _state.polygon_mode = polygon_mode;
+        return *this;
+    }
+
+    auto GraphicsPipelineBuilder::with_cull_mode(VkCullModeFlags cull_mode, VkFrontFace front_face) noexcept
+            -> GraphicsPipelineBuilder& {
+        _state.cull_mode = cull_mode;
+        _state.front_face = front_face;
+        return *this;
+    }
+
+    auto GraphicsPipelineBuilder::with_sample_count(VkSampleCountFlagBits sample_count) noexcept
+            -> GraphicsPipelineBuilder& {
+        _state.sample_count = sample_count;
+        return *this;
+    }
+
+    auto GraphicsPipelineBuilder::with_depth_test(bool depth_write, VkCompareOp depth_compare_op) noexcept
+            -> GraphicsPipelineBuilder& {
+        _state.depth_test = true;
+        _state.depth_write = depth_write;
+        _state.depth_compare_op = depth_compare_op;
+        return *this;
+    }
+
+    auto GraphicsPipelineBuilder::with_color_attachment(VkFormat format,
+                                                        const VkPipelineColorBlendAttachmentState& blend_state) noexcept
+            -> GraphicsPipelineBuilder& {
+        _state.color_formats.push_back(format);
+        _state.color_blend_attachments.push_back(blend_state);
+        return *this;
+    }
+
+    auto GraphicsPipelineBuilder::with_color_attachment(VkFormat format) noexcept -> GraphicsPipelineBuilder& {
+        VkPipelineColorBlendAttachmentState blend_state {};
+        blend_state.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT |
+                                     VK_COLOR_COMPONENT_A_BIT;
+        return with_color_attachment(format, blend_state);
+    }
+
+    auto GraphicsPipelineBuilder::with_depth_attachment(VkFormat format) noexcept -> GraphicsPipelineBuilder& {
+        _state.depth_format = format;
+        return *this;
+    }
+
+    auto GraphicsPipelineBuilder::with_stencil_attachment(VkFormat format) noexcept -> GraphicsPipelineBuilder& {
+        _state.stencil_format = format;
+        return *this;
+    }
+
+    auto GraphicsPipelineBuilder::with_dynamic_state(VkDynamicState dynamic_state) noexcept
+            -> GraphicsPipelineBuilder& {
+        _state.dynamic_states.push_back(dynamic_state);
+        return *this;
+    }
+
+    auto GraphicsPipelineBuilder::with_layout(VkPipelineLayout layout) noexcept -> GraphicsPipelineBuilder& {
+        _state.layout = layout;
+        return *this;
+    }
+
+    /**
+     * This function creates the pipeline by the state of the builder. The pipeline isn't shared, so the caller is
+     * responsible for the destruction. Pipelines should be created by the pipeline manager instead.
+     *
+     * @param virtual_device The device, on which the pipeline is created
+     * @param pipeline_cache The pipeline cache, which is used for the creation
+     * @return               The pipeline or an error
+     *
+     * @author               Cedric Hammes
+     * @since                16/10/2026
+     */
+    auto GraphicsPipelineBuilder::build(VkDevice virtual_device, VkPipelineCache pipeline_cache) const noexcept
+            -> kstd::Result<VkPipeline> {
+        using namespace std::string_literals;
+        if(_state.shader_stages.empty()) {
+            return kstd::Error {"Unable to create graphics pipeline: No shader stage was specified"s};
+        }
+        if(_state.layout == VK_NULL_HANDLE) {
+            return kstd::Error {"Unable to create graphics pipeline: No pipeline layout was specified"s};
+        }
+
+        std::vector<VkPipelineShaderStageCreateInfo> shader_stages {};
+        shader_stages.reserve(_state.shader_stages.size());
+        for(const auto& shader_stage : _state.shader_stages) {
+            VkPipelineShaderStageCreateInfo shader_stage_create_info {};
+            shader_stage_create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+            shader_stage_create_info.stage = shader_stage.stage;
+            shader_stage_create_info.module = shader_stage.module;
+            shader_stage_create_info.pName = shader_stage.entry_point.c_str();
+            shader_stages.push_back(shader_stage_create_info);
+        }
+
+        VkPipelineVertexInputStateCreateInfo vertex_input_state {};
+        vertex_input_state.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+        vertex_input_state.vertexBindingDescriptionCount = static_cast<uint32_t>(_state.vertex_bindings.size());
+        vertex_input_state.pVertexBindingDescriptions = _state.vertex_bindings.data();
+        vertex_input_state.vertexAttributeDescriptionCount = static_cast<uint32_t>(_state.vertex_attributes.size());
+        vertex_input_state.pVertexAttributeDescriptions = _state.vertex_attributes.data();
+
+        VkPipelineInputAssemblyStateCreateInfo input_assembly_state {};
+        input_assembly_state.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+        input_assembly_state.topology = _state.topology;
+
+        VkPipelineViewportStateCreateInfo viewport_state {};
+        viewport_state.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+        viewport_state.viewportCount = 1;
+        viewport_state.scissorCount = 1;
+
+        VkPipelineRasterizationStateCreateInfo rasterization_state {};
+        rasterization_state.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+        rasterization_state.polygonMode = _state.polygon_mode;
+        rasterization_state.cullMode = _state.cull_mode;
+        rasterization_state.frontFace = _state.front_face;
+        rasterization_state.lineWidth = 1.0f;
+
+        VkPipelineMultisampleStateCreateInfo multisample_state {};
+        multisample_state.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+        multisample_state.rasterizationSamples = _state.sample_count;
+
+        VkPipelineDepthStencilStateCreateInfo depth_stencil_state {};
+        depth_stencil_state.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+        depth_stencil_state.depthTestEnable = _state.depth_test ? VK_TRUE : VK_FALSE;
+        depth_stencil_state.depthWriteEnable = _state.depth_write ? VK_TRUE : VK_FALSE;
+        depth_stencil_state.depthCompareOp = _state.depth_compare_op;
+
+        VkPipelineColorBlendStateCreateInfo color_blend_state {};
+        color_blend_state.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+        color_blend_state.attachmentCount = static_cast<uint32_t>(_state.color_blend_attachments.size());
+        color_blend_state.pAttachments = _state.color_blend_attachments.data();
+
+        VkPipelineDynamicStateCreateInfo dynamic_state {};
+        dynamic_state.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+        dynamic_state.dynamicStateCount = static_cast<uint32_t>(_state.dynamic_states.size());
+        dynamic_state.pDynamicStates = _state.dynamic_states.data();
+
+        // The pipeline is created for dynamic rendering, so the attachment formats replace the render pass
+        VkPipelineRenderingCreateInfo rendering_create_info {};
+        rendering_create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO;
+        rendering_create_info.colorAttachmentCount = static_cast<uint32_t>(_state.color_formats.size());
+        rendering_create_info.pColorAttachmentFormats = _state.color_formats.data();
+        rendering_create_info.depthAttachmentFormat = _state.depth_format;
+        rendering_create_info.stencilAttachmentFormat = _state.stencil_format;
+
+        VkGraphicsPipelineCreateInfo pipeline_create_info {};
+        pipeline_create_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        pipeline_create_info.pNext = &rendering_create_info;
+        pipeline_create_info.stageCount = static_cast<uint32_t>(shader_stages.size());
+        pipeline_create_info.pStages = shader_stages.data();
+        pipeline_create_info.pVertexInputState = &vertex_input_state;
+        pipeline_create_info.pInputAssemblyState = &input_assembly_state;
+        pipeline_create_info.pViewportState = &viewport_state;
+        pipeline_create_info.pRasterizationState = &rasterization_state;
+        pipeline_create_info.pMultisampleState = &multisample_state;
+        pipeline_create_info.pDepthStencilState = &depth_stencil_state;
+        pipeline_create_info.pColorBlendState = &color_blend_state;
+        pipeline_create_info.pDynamicState = &dynamic_state;
+        pipeline_create_info.layout = _state.layout;
+
+        VkPipeline pipeline {};
+        VK_CHECK(vkCreateGraphicsPipelines(virtual_device, pipeline_cache, 1, &pipeline_create_info, nullptr,
+                                           &pipeline),
+                 "Unable to create graphics pipeline: {}")
+        return pipeline;
+    }
+
+    auto GraphicsPipelineBuilder::get_state() const noexcept -> const GraphicsPipelineState& {
+        return _state;
+    }
+
+    /**
+     * This constructor creates the pipeline manager, which creates the pipelines with the specified cache.
+     *
+     * @param vulkan_device  The device, on which the pipelines are created
+     * @param pipeline_cache The pipeline cache, which is used for all creations
+     *
+     * @author               Cedric Hammes
+     * @since                16/10/2026
+     */
+    PipelineManager::PipelineManager(const VulkanDevice* vulkan_device, PipelineCache* pipeline_cache) noexcept :
+            _virtual_device {vulkan_device->get_virtual_device()},
+            _pipeline_cache {pipeline_cache} {
+    }
+
+    PipelineManager::~PipelineManager() noexcept {
+        // Wait for the pipelines, which are still compiled in the background, before they're destroyed
+        std::vector<std::shared_future<VkPipeline>> pending_pipelines {};
+        {
+            const std::lock_guard<std::mutex> lock {_mutex};
+            pending_pipelines.reserve(_pipelines.size());
+            for(const auto& [key, pipeline] : _pipelines) {
+                pending_pipelines.push_back(pipeline);
+            }
+        }
+        for(const auto& pipeline : pending_pipelines) {
+            pipeline.wait();
+        }
+
+        for(auto& [key, pipeline] : _pipelines) {
+            if(const auto pipeline_handle = pipeline.get(); pipeline_handle != VK_NULL_HANDLE) {
+                vkDestroyPipeline(_virtual_device, pipeline_handle, nullptr);
+            }
+        }
+        _pipelines.clear();
+    }
+
+    auto PipelineManager::reserve(const PipelineKeyView& key, std::promise<VkPipeline>& promise) noexcept
+            -> std::pair<std::shared_future<VkPipeline>, bool> {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        if(const auto iterator = _pipelines.find(key); iterator != _pipelines.end()) {
+            return {iterator->second, false};
+        }
+
+        // The future is inserted before the creation, so concurrent requests wait instead of creating a duplicate
+        auto future = promise.get_future().share();
+        _pipelines.emplace(PipelineKey {key.hash, *key.state}, future);
+        return {future, true};
+    }
+
+    auto PipelineManager::complete(const PipelineKeyView& key, std::promise<VkPipeline>& promise,
+                                   const kstd::Result<VkPipeline>& result) noexcept -> void {
+        if(result.is_error()) {
+            // Failed pipelines are removed, so a later request can retry the creation
+            SPDLOG_WARN("{}", result.get_error());
+            {
+                const std::lock_guard<std::mutex> lock {_mutex};
+                if(const auto iterator = _pipelines.find(key); iterator != _pipelines.end()) {
+                    _pipelines.erase(iterator);
+                }
+            }
+            promise.set_value(VK_NULL_HANDLE);
+            return;
+        }
+        promise.set_value(*result);
+    }
+
+    /**
+     * This function returns the pipeline with the state of the specified builder. If the pipeline doesn't exist, it
+     * is created on the calling thread. If the pipeline is created by another thread, the function waits for the
+     * creation.
+     *
+     * @param builder The builder with the state of the pipeline
+     * @return        The pipeline or an error
+     *
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto PipelineManager::get_or_create(const GraphicsPipelineBuilder& builder) noexcept -> kstd::Result<VkPipeline> {
+        using namespace std::string_literals;
+        std::promise<VkPipeline> promise {};
+        const PipelineKeyView key {builder.get_state().get_hash(), &builder.get_state()};
+        const auto [future, is_creator] = reserve(key, promise);
+        if(is_creator) {
+            const auto result = builder.build(_virtual_device, **_pipeline_cache);
+            complete(key, promise, result);
+            return result;
+        }
+
+        const auto pipeline = future.get();
+        if(pipeline == VK_NULL_HANDLE) {
+            return kstd::Error {"Unable to create graphics pipeline: The creation on another thread failed"s};
+        }
+        return pipeline;
+    }
+
+    /**
+     * This function creates the pipeline with the state of the specified builder on the compile threads of the
+     * pipeline cache, if it doesn't exist yet. This should be used while loading, so the pipeline already exists when
+     * it's requested by the first frame.
+     *
+     * @param builder The builder with the state of the pipeline
+     *
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto PipelineManager::precompile(const GraphicsPipelineBuilder& builder) noexcept -> void {
+        auto promise = std::make_shared<std::promise<VkPipeline>>();
+        const auto hash = builder.get_state().get_hash();
+        if(const auto [future, is_creator] = reserve({hash, &builder.get_state()}, *promise); !is_creator) {
+            return;
+        }
+
+        // The result is delivered through the promise, so the future of the compile thread isn't needed
+        static_cast<void>(
+                _pipeline_cache->compile_async([this, builder, promise, hash](VkPipelineCache pipeline_cache) {
+                    complete({hash, &builder.get_state()}, *promise, builder.build(_virtual_device, pipeline_cache));
+                }));
+    }
+
+    auto PipelineManager::get_pipeline_count() noexcept -> size_t {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        return _pipelines.size();
+    }
+}// namespace aetherium::renderer::vulkan
@@ -0,0 +1,145 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "aetherium/renderer/vulkan/pipeline_cache.hpp"
+#include <cstring>
+#include <fstream>
+#include <spdlog/spdlog.h>
+#include <vector>
+
+namespace aetherium::renderer::vulkan {
+    namespace {
+        auto read_cache_data(const std::filesystem::path& cache_path,
+                             const VkPhysicalDeviceProperties& properties) noexcept -> std::vector<char> {
+            std::ifstream stream {cache_path, std::ios::binary};
+            if(!stream) {
+                return {};
+            }
+            std::vector<char> cache_data {std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+
+            // Only pass the data to the driver, if it was written by the same driver on the same device
+            VkPipelineCacheHeaderVersionOne header {};
+            if(cache_data.size() < sizeof(header)) {
+                SPDLOG_WARN("Ignoring pipeline cache '{}': The file is too small", cache_path.string());
+                return {};
+            }
+            std::memcpy(&header, cache_data.data(), sizeof(header));
+            if(header.headerSize < sizeof(header) || header.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+               header.vendorID != properties.vendorID || header.deviceID != properties.deviceID ||
+               std::memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) != 0) {
+                SPDLOG_WARN("Ignoring pipeline cache '{}': The cache was written by another device or driver",
+                            cache_path.string());
+                return {};
+            }
+            return cache_data;
+        }
+    }// namespace
+
+    /**
+     * This constructor creates the pipeline cache and fills it with the data of the cache file, if the file exists and
+     * was written by the same device and driver. If the cache path is empty, the cache isn't persisted.
+     *
+     * @param vulkan_device The device, on which the cache is created
+     * @param cache_path    The path of the cache file
+     * @param thread_count  The count of compile threads or zero for one thread per hardware thread
+     *
+     * @author              Cedric Hammes
+     * @since               16/10/2026
+     */
+    PipelineCache::PipelineCache(const VulkanDevice* vulkan_device, std::filesystem::path cache_path,
+                                 uint32_t thread_count) :
+            _virtual_device {vulkan_device->get_virtual_device()},
+            _pipeline_cache {VK_NULL_HANDLE},
+            _cache_path {std::move(cache_path)},
+            _compile_pool {std::make_unique<ThreadPool>(thread_count)} {
+        std::vector<char> cache_data {};
+        if(!_cache_path.empty()) {
+            cache_data = read_cache_data(_cache_path, vulkan_device->get_properties());
+        }
+
+        VkPipelineCacheCreateInfo pipeline_cache_create_info {};
+        pipeline_cache_create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        pipeline_cache_create_info.initialDataSize = cache_data.size();
+        pipeline_cache_create_info.pInitialData = cache_data.data();
+        VK_CHECK_EX(vkCreatePipelineCache(_virtual_device, &pipeline_cache_create_info, nullptr, &_pipeline_cache),
+                    "Unable to create pipeline cache: {}")
+        SPDLOG_DEBUG("Created pipeline cache with {} bytes of initial data", cache_data.size());
+    }
+
+    PipelineCache::~PipelineCache() noexcept {
+        // The compile threads drain the pending pipelines first, so their results are part of the saved cache
+        _compile_pool.reset();
+
+        if(_pipeline_cache != VK_NULL_HANDLE) {
+            if(const auto save_result = save(); save_result.is_error()) {
+                SPDLOG_WARN("Unable to save pipeline cache: {}", save_result.get_error());
+            }
+            vkDestroyPipelineCache(_virtual_device, _pipeline_cache, nullptr);
+            _pipeline_cache = VK_NULL_HANDLE;
+        }
+    }
+
+    /**
+     * This function writes the data of the pipeline cache into the cache file. The file is replaced atomically, so a
+     * crash while writing never leaves a broken cache behind.
+     *
+     * @return Success or error
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto PipelineCache::save() const noexcept -> kstd::Result<void> {
+        if(_cache_path.empty()) {
+            return {};
+        }
+
+        size_t cache_size = 0;
+        VK_CHECK(vkGetPipelineCacheData(_virtual_device, _pipeline_cache, &cache_size, nullptr),
+                 "Unable to get size of pipeline cache data: {}")
+        std::vector<char> cache_data(cache_size);
+        VK_CHECK(vkGetPipelineCacheData(_virtual_device, _pipeline_cache, &cache_size, cache_data.data()),
+                 "Unable to get pipeline cache data: {}")
+
+        std::error_code error_code {};
+        if(_cache_path.has_parent_path()) {
+            std::filesystem::create_directories(_cache_path.parent_path(), error_code);
+        }
+
+        const auto temporary_path = std::filesystem::path {_cache_path}.concat(".tmp");
+        {
+            std::ofstream stream {temporary_path, std::ios::binary | std::ios::trunc};
+            stream.write(cache_data.data(), static_cast<std::streamsize>(cache_size));
+            if(!stream) {
+                return kstd::Error {fmt::format("Unable to write pipeline cache '{}'", temporary_path.string())};
+            }
+        }
+
+        std::filesystem::rename(temporary_path, _cache_path, error_code);
+        if(error_code) {
+            std::filesystem::remove(temporary_path, error_code);
+            return kstd::Error {fmt::format("Unable to replace pipeline cache '{}'", _cache_path.string())};
+        }
+        SPDLOG_DEBUG("Saved {} bytes of pipeline cache data into '{}'", cache_size, _cache_path.string());
+        return {};
+    }
+
+    auto PipelineCache::get_cache_path() const noexcept -> const std::filesystem::path& {
+        return _cache_path;
+    }
+
+    auto PipelineCache::operator*() const noexcept -> VkPipelineCache {
+        return _pipeline_cache;
+    }
+}// namespace aetherium::renderer::vulkan
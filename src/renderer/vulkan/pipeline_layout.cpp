@@ -0,0 +1,176 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "aetherium/renderer/vulkan/pipeline_layout.hpp"
+
+namespace aetherium::renderer::vulkan {
+    namespace {
+        // The key of a layout is the raw content, so equal layouts always share the key without hash collisions
+        template<typename T>
+        auto append_key(std::string& key, const T& value) noexcept -> void {
+            key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        // Set layouts with different stage flags are incompatible, so a set used by the vertex shader of one pipeline
+        // and the fragment shader of another pipeline would need two layouts. Widening the graphics stages avoids it.
+        auto get_shared_stage_flags(VkShaderStageFlags stage_flags) noexcept -> VkShaderStageFlags {
+            if((stage_flags & VK_SHADER_STAGE_ALL_GRAPHICS) != 0) {
+                stage_flags |= VK_SHADER_STAGE_ALL_GRAPHICS;
+            }
+            return stage_flags;
+        }
+    }// namespace
+
+    /**
+     * This constructor creates the empty layout cache for the specified device.
+     *
+     * @param vulkan_device The device, on which the layouts are created
+     *
+     * @author              Cedric Hammes
+     * @since               16/10/2026
+     */
+    PipelineLayoutCache::PipelineLayoutCache(const VulkanDevice* vulkan_device) noexcept :
+            _virtual_device {vulkan_device->get_virtual_device()} {
+    }
+
+    PipelineLayoutCache::~PipelineLayoutCache() noexcept {
+        for(const auto& [key, pipeline_layout] : _pipeline_layouts) {
+            vkDestroyPipelineLayout(_virtual_device, pipeline_layout.layout, nullptr);
+        }
+        for(const auto& [key, descriptor_set_layout] : _descriptor_set_layouts) {
+            vkDestroyDescriptorSetLayout(_virtual_device, descriptor_set_layout, nullptr);
+        }
+        _pipeline_layouts.clear();
+        _descriptor_set_layouts.clear();
+    }
+
+    auto PipelineLayoutCache::get_or_create_set_layout(const std::vector<DescriptorBinding>& bindings) noexcept
+            -> kstd::Result<VkDescriptorSetLayout> {
+        std::string key {};
+        std::vector<VkDescriptorSetLayoutBinding> layout_bindings {};
+        layout_bindings.reserve(bindings.size());
+        for(const auto& binding : bindings) {
+            if(binding.descriptor_count == 0) {
+                return kstd::Error {fmt::format("Unable to create descriptor set layout: Binding {} is a runtime array",
+                                                binding.binding)};
+            }
+
+            append_key(key, binding.binding);
+            append_key(key, binding.descriptor_type);
+            append_key(key, binding.descriptor_count);
+            const auto stage_flags = get_shared_stage_flags(binding.stage_flags);
+            append_key(key, stage_flags);
+
+            VkDescriptorSetLayoutBinding layout_binding {};
+            layout_binding.binding = binding.binding;
+            layout_binding.descriptorType = binding.descriptor_type;
+            layout_binding.descriptorCount = binding.descriptor_count;
+            layout_binding.stageFlags = stage_flags;
+            layout_bindings.push_back(layout_binding);
+        }
+
+        if(const auto iterator = _descriptor_set_layouts.find(key); iterator != _descriptor_set_layouts.end()) {
+            return iterator->second;
+        }
+
+        VkDescriptorSetLayoutCreateInfo descriptor_set_layout_create_info {};
+        descriptor_set_layout_create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        descriptor_set_layout_create_info.bindingCount = static_cast<uint32_t>(layout_bindings.size());
+        descriptor_set_layout_create_info.pBindings = layout_bindings.data();
+
+        VkDescriptorSetLayout descriptor_set_layout {};
+        VK_CHECK(vkCreateDescriptorSetLayout(_virtual_device, &descriptor_set_layout_create_info, nullptr,
+                                             &descriptor_set_layout),
+                 "Unable to create descriptor set layout: {}")
+        _descriptor_set_layouts.emplace(std::move(key), descriptor_set_layout);
+        return descriptor_set_layout;
+    }
+
+    /**
+     * This function returns the descriptor set layout with the specified bindings and creates it, if it doesn't exist
+     * yet. The set numbers of the bindings are ignored.
+     *
+     * @param bindings The bindings of the descriptor set
+     * @return         The descriptor set layout or an error
+     *
+     * @author         Cedric Hammes
+     * @since          16/10/2026
+     */
+    auto PipelineLayoutCache::get_or_create_descriptor_set_layout(
+            const std::vector<DescriptorBinding>& bindings) noexcept -> kstd::Result<VkDescriptorSetLayout> {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        return get_or_create_set_layout(bindings);
+    }
+
+    /**
+     * This function merges the reflections of the stages of a pipeline and returns the pipeline layout for the merged
+     * interface. The layout and the descriptor set layouts are only created, if they don't exist yet.
+     *
+     * @param reflections The reflections of all stages of the pipeline
+     * @return            The pipeline layout or an error
+     *
+     * @author            Cedric Hammes
+     * @since             16/10/2026
+     */
+    auto PipelineLayoutCache::get_or_create_pipeline_layout(
+            const std::vector<const ShaderReflection*>& reflections) noexcept -> kstd::Result<PipelineLayout> {
+        const auto merged_reflection = merge_reflections(reflections);
+        if(merged_reflection.is_error()) {
+            return kstd::Error {merged_reflection.get_error()};
+        }
+
+        // Split the sorted bindings into sets, sets without bindings get an empty layout
+        std::vector<std::vector<DescriptorBinding>> set_bindings {};
+        for(const auto& binding : merged_reflection->descriptor_bindings) {
+            if(set_bindings.size() <= binding.set) {
+                set_bindings.resize(binding.set + 1);
+            }
+            set_bindings[binding.set].push_back(binding);
+        }
+
+        const std::lock_guard<std::mutex> lock {_mutex};
+        PipelineLayout pipeline_layout {VK_NULL_HANDLE, {}, merged_reflection->push_constant_ranges};
+        std::string key {};
+        for(const auto& bindings : set_bindings) {
+            const auto descriptor_set_layout = get_or_create_set_layout(bindings);
+            if(descriptor_set_layout.is_error()) {
+                return kstd::Error {descriptor_set_layout.get_error()};
+            }
+            pipeline_layout.descriptor_set_layouts.push_back(*descriptor_set_layout);
+            append_key(key, *descriptor_set_layout);
+        }
+        for(const auto& push_constant_range : pipeline_layout.push_constant_ranges) {
+            append_key(key, push_constant_range);
+        }
+
+        if(const auto iterator = _pipeline_layouts.find(key); iterator != _pipeline_layouts.end()) {
+            return iterator->second;
+        }
+
+        VkPipelineLayoutCreateInfo pipeline_layout_create_info {};
+        pipeline_layout_create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipeline_layout_create_info.setLayoutCount =
+                static_cast<uint32_t>(pipeline_layout.descriptor_set_layouts.size());
+        pipeline_layout_create_info.pSetLayouts = pipeline_layout.descriptor_set_layouts.data();
+        pipeline_layout_create_info.pushConstantRangeCount =
+                static_cast<uint32_t>(pipeline_layout.push_constant_ranges.size());
+        pipeline_layout_create_info.pPushConstantRanges = pipeline_layout.push_constant_ranges.data();
+        VK_CHECK(vkCreatePipelineLayout(_virtual_device, &pipeline_layout_create_info, nullptr,
+                                        &pipeline_layout.layout),
+                 "Unable to create pipeline layout: {}")
+        _pipeline_layouts.emplace(std::move(key), pipeline_layout);
+        return pipeline_layout;
+    }
+}// namespace aetherium::renderer::vulkan
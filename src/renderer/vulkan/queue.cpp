@@ -0,0 +1,91 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "aetherium/renderer/vulkan/queue.hpp"
+
+namespace aetherium::renderer::vulkan {
+    /**
+     * This constructor creates the queue wrapper by the specified queue handle and the index of the family.
+     *
+     * @param queue_handle The handle to the queue
+     * @param family_index The index of the queue family of the queue
+     *
+     * @author             Cedric Hammes
+     * @since              16/10/2026
+     */
+    Queue::Queue(VkQueue queue_handle, uint32_t family_index) noexcept :
+            _queue_handle {queue_handle},
+            _family_index {family_index} {
+    }
+
+    /**
+     * This function submits the specified submit infos into the queue and signals the fence after the execution.
+     *
+     * @param submit_infos The submit infos
+     * @param count        The count of submit infos
+     * @param fence        The fence, which gets signaled or a null handle
+     * @return             Success or error
+     *
+     * @author             Cedric Hammes
+     * @since              16/10/2026
+     */
+    auto Queue::submit(const VkSubmitInfo* submit_infos, uint32_t count, VkFence fence) const noexcept
+            -> kstd::Result<void> {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        VK_CHECK(vkQueueSubmit(_queue_handle, count, submit_infos, fence), "Unable to submit: {}")
+        return {};
+    }
+
+    /**
+     * This function presents the swapchain images specified in the present info. An out of date or suboptimal
+     * swapchain isn't an error, the result is returned, so the swapchain can be recreated.
+     *
+     * @param present_info The present info
+     * @return             The result of the present or an error
+     *
+     * @author             Cedric Hammes
+     * @since              16/10/2026
+     */
+    auto Queue::present(const VkPresentInfoKHR& present_info) const noexcept -> kstd::Result<VkResult> {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        const auto present_result = vkQueuePresentKHR(_queue_handle, &present_info);
+        if(present_result == VK_ERROR_OUT_OF_DATE_KHR || present_result == VK_SUBOPTIMAL_KHR) {
+            return present_result;
+        }
+        VK_CHECK(present_result, "Unable to present queue: {}")
+        return present_result;
+    }
+
+    /**
+     * This function waits until all submitted work of the queue is done.
+     *
+     * @return Success or error
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto Queue::wait_idle() const noexcept -> kstd::Result<void> {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        VK_CHECK(vkQueueWaitIdle(_queue_handle), "Unable to wait for queue: {}")
+        return {};
+    }
+
+    auto Queue::get_family_index() const noexcept -> uint32_t {
+        return _family_index;
+    }
+
+    auto Queue::operator*() const noexcept -> VkQueue {
+        return _queue_handle;
+    }
+}// namespace aetherium::renderer::vulkan
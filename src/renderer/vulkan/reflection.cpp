@@ -0,0 +1,454 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "aetherium/renderer/vulkan/reflection.hpp"
+#include <algorithm>
+#include <array>
+#include <spirv/unified1/spirv.hpp>
+
+namespace aetherium::renderer::vulkan {
+    namespace {
+        constexpr uint32_t MAX_STRUCT_MEMBERS = 16383;
+
+        struct MemberDecorations {
+            uint32_t offset = 0;
+            uint32_t matrix_stride = 0;
+        };
+
+        // Everything, which is known about a single SPIR-V ID. The instruction is the word index of the type or
+        // constant instruction, which defines the ID.
+        struct IdInfo {
+            uint32_t instruction = 0;
+            uint32_t set = 0;
+            uint32_t binding = 0;
+            uint32_t location = 0;
+            uint32_t array_stride = 0;
+            bool has_binding = false;
+            bool has_location = false;
+            bool is_built_in = false;
+            bool is_buffer_block = false;
+            std::vector<MemberDecorations> members {};
+        };
+
+        struct Variable {
+            uint32_t id;
+            uint32_t type_id;
+            uint32_t storage_class;
+        };
+
+        class SpirvModule final {
+            const std::vector<uint32_t>& _spirv;
+            std::vector<IdInfo> _ids;
+
+            public:
+            SpirvModule(const std::vector<uint32_t>& spirv, uint32_t bound) :
+                    _spirv {spirv},
+                    _ids(bound) {
+            }
+
+            [[nodiscard]] auto get_id(uint32_t id) noexcept -> IdInfo* {
+                return id < _ids.size() ? &_ids[id] : nullptr;
+            }
+
+            [[nodiscard]] auto get_opcode(uint32_t id) const noexcept -> uint32_t {
+                if(id >= _ids.size() || _ids[id].instruction == 0) {
+                    return spv::OpNop;
+                }
+                return _spirv[_ids[id].instruction] & spv::OpCodeMask;
+            }
+
+            [[nodiscard]] auto get_operand(uint32_t id, uint32_t index) const noexcept -> uint32_t {
+                if(id >= _ids.size() || _ids[id].instruction == 0) {
+                    return 0;
+                }
+                const auto instruction = _ids[id].instruction;
+                const auto word_count = _spirv[instruction] >> spv::WordCountShift;
+                return index < word_count ? _spirv[instruction + index] : 0;
+            }
+
+            [[nodiscard]] auto get_info(uint32_t id) const noexcept -> const IdInfo& {
+                static const IdInfo empty_info {};
+                return id < _ids.size() ? _ids[id] : empty_info;
+            }
+
+            [[nodiscard]] auto is_constant(uint32_t id) const noexcept -> bool {
+                return get_opcode(id) == spv::OpConstant || get_opcode(id) == spv::OpSpecConstant;
+            }
+
+            // Specialization constants are read with their default value, which is used without specialization
+            [[nodiscard]] auto get_constant(uint32_t id) const noexcept -> uint32_t {
+                return is_constant(id) ? get_operand(id, 3) : 0;
+            }
+
+            [[nodiscard]] auto get_type_size(uint32_t type_id, uint32_t matrix_stride = 0) const noexcept -> uint32_t {
+                switch(get_opcode(type_id)) {
+                    case spv::OpTypeInt:
+                    case spv::OpTypeFloat: return get_operand(type_id, 2) / 8;
+                    case spv::OpTypeVector: return get_operand(type_id, 3) * get_type_size(get_operand(type_id, 2));
+                    case spv::OpTypeMatrix: {
+                        const auto column_size =
+                                matrix_stride != 0 ? matrix_stride : get_type_size(get_operand(type_id, 2));
+                        return get_operand(type_id, 3) * column_size;
+                    }
+                    case spv::OpTypeArray: {
+                        const auto element_size = _ids[type_id].array_stride != 0
+                                                          ? _ids[type_id].array_stride
+                                                          : get_type_size(get_operand(type_id, 2), matrix_stride);
+                        return get_constant(get_operand(type_id, 3)) * element_size;
+                    }
+                    case spv::OpTypeStruct: {
+                        const auto& members = _ids[type_id].members;
+                        const auto word_count = _spirv[_ids[type_id].instruction] >> spv::WordCountShift;
+                        uint32_t size = 0;
+                        for(uint32_t i = 0; i < members.size() && i + 2 < word_count; i++) {
+                            const auto member_type_id = get_operand(type_id, i + 2);
+                            const auto member_size = get_type_size(member_type_id, members[i].matrix_stride);
+                            size = std::max(size, members[i].offset + member_size);
+                        }
+                        return size;
+                    }
+                    default: return 0;
+                }
+            }
+        };
+
+        auto get_shader_stage(uint32_t execution_model) noexcept -> VkShaderStageFlagBits {
+            switch(execution_model) {
+                case spv::ExecutionModelVertex: return VK_SHADER_STAGE_VERTEX_BIT;
+                case spv::ExecutionModelTessellationControl: return VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT;
+                case spv::ExecutionModelTessellationEvaluation: return VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
+                case spv::ExecutionModelGeometry: return VK_SHADER_STAGE_GEOMETRY_BIT;
+                case spv::ExecutionModelFragment: return VK_SHADER_STAGE_FRAGMENT_BIT;
+                case spv::ExecutionModelGLCompute: return VK_SHADER_STAGE_COMPUTE_BIT;
+                default: return VK_SHADER_STAGE_ALL;
+            }
+        }
+
+        auto get_descriptor_type(const SpirvModule& module, uint32_t type_id, uint32_t storage_class) noexcept
+                -> kstd::Result<VkDescriptorType> {
+            using namespace std::string_literals;
+            switch(storage_class) {
+                case spv::StorageClassUniform:
+                    return module.get_info(type_id).is_buffer_block ? VK_DESCRIPTOR_TYPE_STORAGE_BUFFER
+                                                                    : VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+                case spv::StorageClassStorageBuffer: return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                case spv::StorageClassUniformConstant: break;
+                default: return kstd::Error {"Unable to reflect SPIR-V: Unsupported storage class of resource"s};
+            }
+
+            auto image_type_id = type_id;
+            switch(module.get_opcode(type_id)) {
+                case spv::OpTypeSampler: return VK_DESCRIPTOR_TYPE_SAMPLER;
+                case spv::OpTypeAccelerationStructureKHR: return VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR;
+                case spv::OpTypeSampledImage: {
+                    image_type_id = module.get_operand(type_id, 2);
+                    if(module.get_operand(image_type_id, 3) == spv::DimBuffer) {
+                        return VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
+                    }
+                    return VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+                }
+                case spv::OpTypeImage: {
+                    const auto dimension = module.get_operand(image_type_id, 3);
+                    const auto is_storage = module.get_operand(image_type_id, 7) == 2;
+                    if(dimension == spv::DimSubpassData) {
+                        return VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT;
+                    }
+                    if(dimension == spv::DimBuffer) {
+                        return is_storage ? VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER
+                                          : VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
+                    }
+                    return is_storage ? VK_DESCRIPTOR_TYPE_STORAGE_IMAGE : VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+                }
+                default: return kstd::Error {"Unable to reflect SPIR-V: Unsupported type of resource"s};
+            }
+        }
+
+        auto get_vertex_format(const SpirvModule& module, uint32_t type_id) noexcept -> VkFormat {
+            constexpr std::array<VkFormat, 4> float_formats {VK_FORMAT_R32_SFLOAT, VK_FORMAT_R32G32_SFLOAT,
+                                                             VK_FORMAT_R32G32B32_SFLOAT, VK_FORMAT_R32G32B32A32_SFLOAT};
+            constexpr std::array<VkFormat, 4> int_formats {VK_FORMAT_R32_SINT, VK_FORMAT_R32G32_SINT,
+                                                           VK_FORMAT_R32G32B32_SINT, VK_FORMAT_R32G32B32A32_SINT};
+            constexpr std::array<VkFormat, 4> uint_formats {VK_FORMAT_R32_UINT, VK_FORMAT_R32G32_UINT,
+                                                            VK_FORMAT_R32G32B32_UINT, VK_FORMAT_R32G32B32A32_UINT};
+
+            uint32_t component_count = 1;
+            auto component_type_id = type_id;
+            if(module.get_opcode(type_id) == spv::OpTypeVector) {
+                component_type_id = module.get_operand(type_id, 2);
+                component_count = module.get_operand(type_id, 3);
+            }
+            if(component_count < 1 || component_count > 4 || module.get_operand(component_type_id, 2) != 32) {
+                return VK_FORMAT_UNDEFINED;
+            }
+
+            switch(module.get_opcode(component_type_id)) {
+                case spv::OpTypeFloat: return float_formats[component_count - 1];
+                case spv::OpTypeInt:
+                    return module.get_operand(component_type_id, 3) != 0 ? int_formats[component_count - 1]
+                                                                         : uint_formats[component_count - 1];
+                default: return VK_FORMAT_UNDEFINED;
+            }
+        }
+    }// namespace
+
+    /**
+     * This function parses the specified SPIR-V and reflects the stage, the descriptor bindings, the push constant
+     * ranges and the vertex inputs of the shader.
+     *
+     * @param spirv The SPIR-V words of the shader
+     * @return      The reflection of the shader or an error
+     *
+     * @author      Cedric Hammes
+     * @since       16/10/2026
+     */
+    auto reflect_spirv(const std::vector<uint32_t>& spirv) noexcept -> kstd::Result<ShaderReflection> {
+        using namespace std::string_literals;
+        if(spirv.size() < 5 || spirv[0] != spv::MagicNumber) {
+            return kstd::Error {"Unable to reflect SPIR-V: Invalid header"s};
+        }
+
+        // Collect the types, constants and decorations of all IDs and the global variables in the first pass
+        ShaderReflection reflection {};
+        SpirvModule module {spirv, spirv[3]};
+        std::vector<Variable> variables {};
+        for(size_t i = 5; i < spirv.size();) {
+            const auto word_count = spirv[i] >> spv::WordCountShift;
+            const auto opcode = spirv[i] & spv::OpCodeMask;
+            if(word_count == 0 || i + word_count > spirv.size()) {
+                return kstd::Error {"Unable to reflect SPIR-V: Invalid instruction"s};
+            }
+
+            const auto get_word = [&](uint32_t index) { return index < word_count ? spirv[i + index] : 0; };
+            switch(opcode) {
+                case spv::OpEntryPoint: {
+                    if(reflection.stage == VK_SHADER_STAGE_ALL) {
+                        reflection.stage = get_shader_stage(get_word(1));
+                    }
+                    break;
+                }
+                case spv::OpDecorate: {
+                    if(auto* info = module.get_id(get_word(1)); info != nullptr) {
+                        switch(get_word(2)) {
+                            case spv::DecorationDescriptorSet: info->set = get_word(3); break;
+                            case spv::DecorationBinding:
+                                info->binding = get_word(3);
+                                info->has_binding = true;
+                                break;
+                            case spv::DecorationLocation:
+                                info->location = get_word(3);
+                                info->has_location = true;
+                                break;
+                            case spv::DecorationArrayStride: info->array_stride = get_word(3); break;
+                            case spv::DecorationBuiltIn: info->is_built_in = true; break;
+                            case spv::DecorationBufferBlock: info->is_buffer_block = true; break;
+                            default: break;
+                        }
+                    }
+                    break;
+                }
+                case spv::OpMemberDecorate: {
+                    auto* info = module.get_id(get_word(1));
+                    const auto member_index = get_word(2);
+                    if(info == nullptr || member_index >= MAX_STRUCT_MEMBERS) {
+                        break;
+                    }
+                    if(info->members.size() <= member_index) {
+                        info->members.resize(member_index + 1);
+                    }
+                    if(get_word(3) == spv::DecorationOffset) {
+                        info->members[member_index].offset = get_word(4);
+                    }
+                    else if(get_word(3) == spv::DecorationMatrixStride) {
+                        info->members[member_index].matrix_stride = get_word(4);
+                    }
+                    break;
+                }
+                case spv::OpTypeInt:
+                case spv::OpTypeFloat:
+                case spv::OpTypeVector:
+                case spv::OpTypeMatrix:
+                case spv::OpTypeImage:
+                case spv::OpTypeSampler:
+                case spv::OpTypeSampledImage:
+                case spv::OpTypeArray:
+                case spv::OpTypeRuntimeArray:
+                case spv::OpTypeStruct:
+                case spv::OpTypePointer:
+                case spv::OpTypeAccelerationStructureKHR: {
+                    if(auto* info = module.get_id(get_word(1)); info != nullptr) {
+                        info->instruction = static_cast<uint32_t>(i);
+                    }
+                    break;
+                }
+                case spv::OpConstant:
+                case spv::OpSpecConstant: {
+                    if(auto* info = module.get_id(get_word(2)); info != nullptr) {
+                        info->instruction = static_cast<uint32_t>(i);
+                    }
+                    break;
+                }
+                case spv::OpVariable: {
+                    variables.push_back({get_word(2), get_word(1), get_word(3)});
+                    break;
+                }
+                default: break;
+            }
+            i += word_count;
+        }
+
+        // Reflect the interface by the global variables in the second pass
+        for(const auto& variable : variables) {
+            if(module.get_opcode(variable.type_id) != spv::OpTypePointer || module.get_id(variable.id) == nullptr) {
+                continue;
+            }
+            const auto& variable_info = module.get_info(variable.id);
+            auto type_id = module.get_operand(variable.type_id, 3);
+
+            switch(variable.storage_class) {
+                case spv::StorageClassUniform:
+                case spv::StorageClassUniformConstant:
+                case spv::StorageClassStorageBuffer: {
+                    if(!variable_info.has_binding) {
+                        continue;
+                    }
+
+                    // Arrays of resources are a single binding with multiple descriptors. The length of an array
+                    // can't be zero, so a descriptor count of zero always means a runtime array.
+                    uint32_t descriptor_count = 1;
+                    while(module.get_opcode(type_id) == spv::OpTypeArray ||
+                          module.get_opcode(type_id) == spv::OpTypeRuntimeArray) {
+                        if(module.get_opcode(type_id) == spv::OpTypeRuntimeArray) {
+                            descriptor_count = 0;
+                        }
+                        else if(const auto length_id = module.get_operand(type_id, 3); module.is_constant(length_id)) {
+                            descriptor_count *= module.get_constant(length_id);
+                        }
+                        else {
+                            return kstd::Error {fmt::format("Unable to reflect SPIR-V: The array length of binding {} "
+                                                            "of set {} is a specialization constant expression",
+                                                            variable_info.binding, variable_info.set)};
+                        }
+                        type_id = module.get_operand(type_id, 2);
+                    }
+
+                    const auto descriptor_type = get_descriptor_type(module, type_id, variable.storage_class);
+                    if(descriptor_type.is_error()) {
+                        return kstd::Error {descriptor_type.get_error()};
+                    }
+                    reflection.descriptor_bindings.push_back({variable_info.set, variable_info.binding,
+                                                              *descriptor_type, descriptor_count,
+                                                              static_cast<VkShaderStageFlags>(reflection.stage)});
+                    break;
+                }
+                case spv::StorageClassPushConstant: {
+                    const auto& members = module.get_info(type_id).members;
+                    uint32_t offset = 0;
+                    if(!members.empty()) {
+                        offset = std::min_element(members.cbegin(), members.cend(), [](const auto& a, const auto& b) {
+                                     return a.offset < b.offset;
+                                 })->offset;
+                    }
+                    const auto size = module.get_type_size(type_id);
+                    if(size > offset) {
+                        reflection.push_constant_ranges.push_back(
+                                {static_cast<VkShaderStageFlags>(reflection.stage), offset, size - offset});
+                    }
+                    break;
+                }
+                case spv::StorageClassInput: {
+                    if(reflection.stage != VK_SHADER_STAGE_VERTEX_BIT || !variable_info.has_location ||
+                       variable_info.is_built_in) {
+                        continue;
+                    }
+                    reflection.vertex_inputs.push_back({variable_info.location, get_vertex_format(module, type_id)});
+                    break;
+                }
+                default: break;
+            }
+        }
+
+        std::sort(reflection.descriptor_bindings.begin(), reflection.descriptor_bindings.end(),
+                  [](const auto& a, const auto& b) { return a.set != b.set ? a.set < b.set : a.binding < b.binding; });
+        std::sort(reflection.vertex_inputs.begin(), reflection.vertex_inputs.end(),
+                  [](const auto& a, const auto& b) { return a.location < b.location; });
+        return reflection;
+    }
+
+    /**
+     * This function merges the reflections of all stages of a pipeline into a single interface. Bindings, which are
+     * used by multiple stages, are merged into one binding with the flags of all stages. The push constant ranges are
+     * kept per stage, so the pipeline layout matches the ranges, which are declared by the stages, instead of widening
+     * a single range to all stages.
+     *
+     * @param reflections The reflections of the stages
+     * @return            The merged reflection or an error, if the stages declare a binding with different types
+     *
+     * @author            Cedric Hammes
+     * @since             16/10/2026
+     */
+    auto merge_reflections(const std::vector<const ShaderReflection*>& reflections) noexcept
+            -> kstd::Result<ShaderReflection> {
+        ShaderReflection merged_reflection {};
+        for(const auto* reflection : reflections) {
+            for(const auto& binding : reflection->descriptor_bindings) {
+                auto& merged_bindings = merged_reflection.descriptor_bindings;
+                const auto merged_binding =
+                        std::find_if(merged_bindings.begin(), merged_bindings.end(), [&](const auto& other) {
+                            return other.set == binding.set && other.binding == binding.binding;
+                        });
+                if(merged_binding == merged_bindings.end()) {
+                    merged_bindings.push_back(binding);
+                    continue;
+                }
+                if(merged_binding->descriptor_type != binding.descriptor_type) {
+                    return kstd::Error {fmt::format("Unable to merge reflections: Binding {} of set {} is declared "
+                                                    "with different descriptor types",
+                                                    binding.binding, binding.set)};
+                }
+                merged_binding->stage_flags |= binding.stage_flags;
+                if(binding.descriptor_count == 0 || merged_binding->descriptor_count == 0) {
+                    merged_binding->descriptor_count = 0;
+                }
+                else {
+                    merged_binding->descriptor_count =
+                            std::max(merged_binding->descriptor_count, binding.descriptor_count);
+                }
+            }
+
+            // Vulkan allows only one range per stage, so multiple ranges of the same stage are merged into one
+            for(const auto& range : reflection->push_constant_ranges) {
+                auto& merged_ranges = merged_reflection.push_constant_ranges;
+                const auto merged_range =
+                        std::find_if(merged_ranges.begin(), merged_ranges.end(),
+                                     [&](const auto& other) { return other.stageFlags == range.stageFlags; });
+                if(merged_range == merged_ranges.end()) {
+                    merged_ranges.push_back(range);
+                    continue;
+                }
+                const auto end = std::max(merged_range->offset + merged_range->size, range.offset + range.size);
+                merged_range->offset = std::min(merged_range->offset, range.offset);
+                merged_range->size = end - merged_range->offset;
+            }
+
+            if(reflection->stage == VK_SHADER_STAGE_VERTEX_BIT) {
+                merged_reflection.vertex_inputs = reflection->vertex_inputs;
+            }
+        }
+
+        std::sort(merged_reflection.descriptor_bindings.begin(), merged_reflection.descriptor_bindings.end(),
+                  [](const auto& a, const auto& b) { return a.set != b.set ? a.set < b.set : a.binding < b.binding; });
+        return merged_reflection;
+    }
+}// namespace aetherium::renderer::vulkan
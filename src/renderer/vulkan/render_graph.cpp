@@ -0,0 +1,701 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "aetherium/renderer/vulkan/render_graph.hpp"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace aetherium::renderer::vulkan {
+    namespace {
+        constexpr uint32_t NO_PASS = std::numeric_limits<uint32_t>::max();
+        constexpr uint32_t NO_RESOURCE = std::numeric_limits<uint32_t>::max();
+        constexpr VkAccessFlags2 WRITE_ACCESS_MASK =
+                VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
+                VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT | VK_ACCESS_2_TRANSFER_WRITE_BIT;
+
+        struct UsageInfo {
+            VkImageLayout layout;
+            VkPipelineStageFlags2 stage_mask;
+            VkAccessFlags2 access_mask;
+            VkImageUsageFlags image_usage;
+        };
+
+        // The state of an image between the passes. The visible masks contain the stages and accesses, for which
+        // the last write was already made visible, so following reads in these stages don't need another barrier.
+        struct ResourceState {
+            VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED;
+            VkPipelineStageFlags2 write_stage_mask = VK_PIPELINE_STAGE_2_NONE;
+            VkAccessFlags2 write_access_mask = VK_ACCESS_2_NONE;
+            VkPipelineStageFlags2 read_stage_mask = VK_PIPELINE_STAGE_2_NONE;
+            VkPipelineStageFlags2 visible_stage_mask = VK_PIPELINE_STAGE_2_NONE;
+            VkAccessFlags2 visible_access_mask = VK_ACCESS_2_NONE;
+        };
+
+        struct MergedAccess {
+            RenderGraphResource resource;
+            UsageInfo usage_info;
+            bool is_write;
+        };
+
+        template<typename T>
+        auto append_key(std::string& key, const T& value) noexcept -> void {
+            key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        auto get_layout_usage_info(const VkImageLayout layout, const VkImageUsageFlags image_usage) noexcept
+                -> UsageInfo {
+            const auto layout_usage = get_layout_usage(layout);
+            return {layout, layout_usage.stage_mask, layout_usage.access_mask, image_usage};
+        }
+
+        // The stages and accesses are the ones of the layout, which are also used by the barrier batch. Only the
+        // storage accesses are narrowed down to the shaders of the pass, because the general layout can be used by
+        // every stage.
+        auto get_usage_info(const RenderGraphUsage usage, const RenderGraphPassType pass_type) noexcept -> UsageInfo {
+            const VkPipelineStageFlags2 shader_stage_mask =
+                    pass_type == COMPUTE_PASS ? VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT
+                                              : VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT |
+                                                        VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT;
+            switch(usage) {
+                case COLOR_ATTACHMENT:
+                    return get_layout_usage_info(VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                                                 VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT);
+                case DEPTH_STENCIL_ATTACHMENT:
+                    return get_layout_usage_info(VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+                                                 VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT);
+                case DEPTH_STENCIL_READ:
+                    return get_layout_usage_info(VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL,
+                                                 VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT |
+                                                         VK_IMAGE_USAGE_SAMPLED_BIT);
+                case SHADER_READ:
+                    return get_layout_usage_info(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_USAGE_SAMPLED_BIT);
+                case STORAGE_READ:
+                    return {VK_IMAGE_LAYOUT_GENERAL, shader_stage_mask, VK_ACCESS_2_SHADER_STORAGE_READ_BIT,
+                            VK_IMAGE_USAGE_STORAGE_BIT};
+                case STORAGE_WRITE:
+                    return {VK_IMAGE_LAYOUT_GENERAL, shader_stage_mask,
+                            VK_ACCESS_2_SHADER_STORAGE_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT,
+                            VK_IMAGE_USAGE_STORAGE_BIT};
+                case TRANSFER_SOURCE:
+                    return get_layout_usage_info(VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_USAGE_TRANSFER_SRC_BIT);
+                case TRANSFER_DESTINATION:
+                    return get_layout_usage_info(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+            }
+            return get_layout_usage_info(VK_IMAGE_LAYOUT_GENERAL, 0);
+        }
+
+        auto get_subresource_range(const VkFormat format) noexcept -> VkImageSubresourceRange {
+            VkImageSubresourceRange subresource_range {};
+            subresource_range.aspectMask = get_aspect_mask(format);
+            subresource_range.baseMipLevel = 0;
+            subresource_range.levelCount = VK_REMAINING_MIP_LEVELS;
+            subresource_range.baseArrayLayer = 0;
+            subresource_range.layerCount = VK_REMAINING_ARRAY_LAYERS;
+            return subresource_range;
+        }
+    }// namespace
+
+    /**
+     * This constructor creates the pass without any reads or writes.
+     *
+     * @param name The name of the pass
+     * @param type The type of the pass
+     *
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    RenderGraphPass::RenderGraphPass(std::string name, RenderGraphPassType type) noexcept :
+            _name {std::move(name)},
+            _type {type},
+            _has_side_effects {false} {
+    }
+
+    auto RenderGraphPass::read(RenderGraphResource resource, RenderGraphUsage usage) noexcept -> RenderGraphPass& {
+        _accesses.push_back({resource, usage, false});
+        return *this;
+    }
+
+    auto RenderGraphPass::write(RenderGraphResource resource, RenderGraphUsage usage) noexcept -> RenderGraphPass& {
+        _accesses.push_back({resource, usage, true});
+        return *this;
+    }
+
+    /**
+     * This function sets the function, which records the commands of the pass. The barriers of the pass are recorded
+     * before the function is called.
+     *
+     * @param execute_function The function, which records the pass
+     * @return                 The pass itself
+     *
+     * @author                 Cedric Hammes
+     * @since                  16/10/2026
+     */
+    auto RenderGraphPass::set_execute_function(RenderGraphExecuteFunction execute_function) noexcept
+            -> RenderGraphPass& {
+        _execute_function = std::move(execute_function);
+        return *this;
+    }
+
+    /**
+     * This function marks the pass as pass with side effects outside of the graph, like writes into a buffer, which
+     * is read by the CPU. Passes with side effects are never culled.
+     *
+     * @return The pass itself
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto RenderGraphPass::set_side_effects() noexcept -> RenderGraphPass& {
+        _has_side_effects = true;
+        return *this;
+    }
+
+    auto RenderGraphPass::get_name() const noexcept -> const std::string& {
+        return _name;
+    }
+
+    /**
+     * This constructor creates the empty render graph. A graph without a device only plans the passes, the
+     * placement of the transient images and the barriers, so the transient images have no Vulkan objects.
+     *
+     * @param vulkan_device The device, on which the transient images are created, or nullptr
+     *
+     * @author              Cedric Hammes
+     * @since               16/10/2026
+     */
+    RenderGraph::RenderGraph(const VulkanDevice* vulkan_device) noexcept :
+            _vulkan_device {vulkan_device},
+            _is_compiled {false} {
+    }
+
+    RenderGraph::~RenderGraph() noexcept {
+        destroy_transient_images();
+    }
+
+    /**
+     * This function declares a transient image, which is created by the graph. The usage flags of the image are
+     * derived from the passes, which use the image.
+     *
+     * @param name       The name of the image
+     * @param image_info The format and extent of the image
+     * @return           The identifier of the image
+     *
+     * @author           Cedric Hammes
+     * @since            16/10/2026
+     */
+    auto RenderGraph::create_image(std::string name, const RenderGraphImageInfo& image_info) noexcept
+            -> RenderGraphResource {
+        _is_compiled = false;
+        _resources.push_back({std::move(name), VK_NULL_HANDLE, VK_NULL_HANDLE, image_info.format, image_info.extent, 0,
+                              false, VK_IMAGE_LAYOUT_UNDEFINED, VK_PIPELINE_STAGE_2_NONE, VK_IMAGE_LAYOUT_UNDEFINED,
+                              NO_PASS, NO_PASS, 0});
+        return static_cast<RenderGraphResource>(_resources.size() - 1);
+    }
+
+    /**
+     * This function imports an image, which is owned outside of the graph, into the graph. Writes into imported
+     * images are the output of the graph.
+     *
+     * @param name        The name of the image
+     * @param import_info The image and its state before and after the graph
+     * @return            The identifier of the image
+     *
+     * @author            Cedric Hammes
+     * @since             16/10/2026
+     */
+    auto RenderGraph::import_image(std::string name, const RenderGraphImportInfo& import_info) noexcept
+            -> RenderGraphResource {
+        _is_compiled = false;
+        _resources.push_back({std::move(name), import_info.image, import_info.image_view, import_info.format,
+                              import_info.extent, 0, true, import_info.initial_layout, import_info.initial_stage,
+                              import_info.final_layout, NO_PASS, NO_PASS, 0});
+        return static_cast<RenderGraphResource>(_resources.size() - 1);
+    }
+
+    /**
+     * This function adds a pass to the graph. The passes are executed in the order of insertion.
+     *
+     * @param name The name of the pass
+     * @param type The type of the pass
+     * @return     The pass, which declares its reads and writes
+     *
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    auto RenderGraph::add_pass(std::string name, RenderGraphPassType type) noexcept -> RenderGraphPass& {
+        _is_compiled = false;
+        _passes.push_back(std::make_unique<RenderGraphPass>(std::move(name), type));
+        return *_passes.back();
+    }
+
+    auto RenderGraph::cull_passes() noexcept -> void {
+        // Walk backwards from the outputs of the graph, a pass is needed if another needed pass reads one of its
+        // writes or if it writes an imported image. Writes don't end the lifetime of an image, because the pass may
+        // load the previous content.
+        std::vector<bool> is_required(_resources.size(), false);
+        std::vector<bool> is_needed(_passes.size(), false);
+        for(auto pass_index = _passes.size(); pass_index > 0; pass_index--) {
+            const auto& pass = *_passes[pass_index - 1];
+            auto is_pass_needed = pass._has_side_effects;
+            for(const auto& access : pass._accesses) {
+                if(access.is_write && (is_required[access.resource] || _resources[access.resource].is_imported)) {
+                    is_pass_needed = true;
+                }
+            }
+            if(!is_pass_needed) {
+                continue;
+            }
+
+            is_needed[pass_index - 1] = true;
+            for(const auto& access : pass._accesses) {
+                is_required[access.resource] = true;
+            }
+        }
+
+        _compiled_passes.clear();
+        for(uint32_t pass_index = 0; pass_index < _passes.size(); pass_index++) {
+            if(is_needed[pass_index]) {
+                _compiled_passes.push_back(pass_index);
+            }
+        }
+
+        // Calculate the lifetime of the images over the remaining passes
+        for(auto& resource : _resources) {
+            resource.usage = 0;
+            resource.first_pass = NO_PASS;
+            resource.last_pass = NO_PASS;
+        }
+        for(uint32_t compiled_index = 0; compiled_index < _compiled_passes.size(); compiled_index++) {
+            const auto& pass = *_passes[_compiled_passes[compiled_index]];
+            for(const auto& access : pass._accesses) {
+                auto& resource = _resources[access.resource];
+                resource.usage |= get_usage_info(access.usage, pass._type).image_usage;
+                if(resource.first_pass == NO_PASS) {
+                    resource.first_pass = compiled_index;
+                }
+                resource.last_pass = compiled_index;
+            }
+        }
+    }
+
+    auto RenderGraph::create_transient_images() noexcept -> kstd::Result<void> {
+        // The transient images are only recreated, if an image or the lifetime of an image has changed
+        std::vector<uint32_t> transient_resources {};
+        std::string transient_key {};
+        for(uint32_t resource_index = 0; resource_index < _resources.size(); resource_index++) {
+            const auto& resource = _resources[resource_index];
+            if(resource.is_imported || resource.first_pass == NO_PASS) {
+                continue;
+            }
+
+            transient_resources.push_back(resource_index);
+            append_key(transient_key, resource.format);
+            append_key(transient_key, resource.extent.width);
+            append_key(transient_key, resource.extent.height);
+            append_key(transient_key, resource.usage);
+            append_key(transient_key, resource.first_pass);
+            append_key(transient_key, resource.last_pass);
+        }
+
+        if(transient_key != _transient_key) {
+            destroy_transient_images();
+            std::vector<VkMemoryRequirements> memory_requirements(transient_resources.size());
+            for(size_t i = 0; i < transient_resources.size(); i++) {
+                const auto& resource = _resources[transient_resources[i]];
+
+                // Without a device, the graph only plans the placement of the images. The size of an image is
+                // estimated by its pixel count.
+                if(_vulkan_device == nullptr) {
+                    memory_requirements[i] = {VkDeviceSize {resource.extent.width} * resource.extent.height, 1, ~0U};
+                    _transient_images.push_back({VK_NULL_HANDLE, VK_NULL_HANDLE});
+                    continue;
+                }
+
+                const auto virtual_device = _vulkan_device->get_virtual_device();
+                VkImageCreateInfo image_create_info {};
+                image_create_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+                image_create_info.imageType = VK_IMAGE_TYPE_2D;
+                image_create_info.format = resource.format;
+                image_create_info.extent = {resource.extent.width, resource.extent.height, 1};
+                image_create_info.mipLevels = 1;
+                image_create_info.arrayLayers = 1;
+                image_create_info.samples = VK_SAMPLE_COUNT_1_BIT;
+                image_create_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+                image_create_info.usage = resource.usage;
+                image_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+                image_create_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+                VkImage image {};
+                VK_CHECK(vkCreateImage(virtual_device, &image_create_info, nullptr, &image),
+                         "Unable to create transient image: {}")
+                _transient_images.push_back({image, VK_NULL_HANDLE});
+                vkGetImageMemoryRequirements(virtual_device, image, &memory_requirements[i]);
+            }
+
+            // Place the largest images first, every image shares the memory with the images in the same slot, so
+            // the lifetime of an image must not overlap with the lifetime of any other image in the slot
+            std::vector<uint32_t> placement_order(transient_resources.size());
+            std::iota(placement_order.begin(), placement_order.end(), 0);
+            std::sort(placement_order.begin(), placement_order.end(), [&](const uint32_t left, const uint32_t right) {
+                return memory_requirements[left].size > memory_requirements[right].size;
+            });
+
+            _transient_slots.assign(transient_resources.size(), 0);
+            for(const auto transient_index : placement_order) {
+                const auto& resource = _resources[transient_resources[transient_index]];
+                const auto& requirements = memory_requirements[transient_index];
+                auto slot_index = static_cast<uint32_t>(_memory_slots.size());
+                for(uint32_t i = 0; i < _memory_slots.size(); i++) {
+                    const auto& memory_slot = _memory_slots[i];
+                    if((memory_slot.requirements.memoryTypeBits & requirements.memoryTypeBits) == 0) {
+                        continue;
+                    }
+
+                    const auto is_overlapping = std::any_of(
+                            memory_slot.resources.begin(), memory_slot.resources.end(), [&](const uint32_t other) {
+                                const auto& other_resource = _resources[transient_resources[other]];
+                                return resource.first_pass <= other_resource.last_pass &&
+                                       other_resource.first_pass <= resource.last_pass;
+                            });
+                    if(!is_overlapping) {
+                        slot_index = i;
+                        break;
+                    }
+                }
+
+                if(slot_index == _memory_slots.size()) {
+                    _memory_slots.push_back({Allocation {}, requirements, {}});
+                }
+                else {
+                    auto& slot_requirements = _memory_slots[slot_index].requirements;
+                    slot_requirements.size = std::max(slot_requirements.size, requirements.size);
+                    slot_requirements.alignment = std::max(slot_requirements.alignment, requirements.alignment);
+                    slot_requirements.memoryTypeBits &= requirements.memoryTypeBits;
+                }
+                _memory_slots[slot_index].resources.push_back(transient_index);
+                _transient_slots[transient_index] = slot_index;
+            }
+
+            if(_vulkan_device != nullptr) {
+                if(const auto bind_result = bind_transient_images(transient_resources); bind_result.is_error()) {
+                    return bind_result;
+                }
+            }
+
+            VkDeviceSize transient_memory_size = 0;
+            for(const auto& memory_slot : _memory_slots) {
+                transient_memory_size += memory_slot.requirements.size;
+            }
+            VkDeviceSize image_memory_size = 0;
+            for(const auto& requirements : memory_requirements) {
+                image_memory_size += requirements.size;
+            }
+            _statistics.transient_memory_size = transient_memory_size;
+            _statistics.aliased_memory_size = image_memory_size - transient_memory_size;
+            _transient_key = std::move(transient_key);
+        }
+
+        for(size_t i = 0; i < transient_resources.size(); i++) {
+            auto& resource = _resources[transient_resources[i]];
+            resource.image = _transient_images[i].image;
+            resource.image_view = _transient_images[i].image_view;
+            resource.memory_slot = _transient_slots[i];
+        }
+        _statistics.transient_image_count = static_cast<uint32_t>(transient_resources.size());
+        return {};
+    }
+
+    auto RenderGraph::bind_transient_images(const std::vector<uint32_t>& transient_resources) noexcept
+            -> kstd::Result<void> {
+        // Allocate the memory slots and bind the images into them
+        const auto virtual_device = _vulkan_device->get_virtual_device();
+        auto& memory_allocator = _vulkan_device->get_memory_allocator();
+        AllocationCreateInfo allocation_create_info {};
+        allocation_create_info.is_linear = false;
+        for(auto& memory_slot : _memory_slots) {
+            auto allocation = memory_allocator.allocate(memory_slot.requirements, allocation_create_info);
+            if(allocation.is_error()) {
+                return kstd::Error {allocation.get_error()};
+            }
+            memory_slot.allocation = *allocation;
+        }
+
+        for(size_t i = 0; i < transient_resources.size(); i++) {
+            const auto& resource = _resources[transient_resources[i]];
+            const auto& allocation = _memory_slots[_transient_slots[i]].allocation;
+            auto& transient_image = _transient_images[i];
+            VK_CHECK(vkBindImageMemory(virtual_device, transient_image.image, allocation.memory, allocation.offset),
+                     "Unable to bind memory of transient image: {}")
+
+            // Views of depth stencil images contain both aspects, because the view is also the stencil attachment
+            VkImageViewCreateInfo image_view_create_info {};
+            image_view_create_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+            image_view_create_info.image = transient_image.image;
+            image_view_create_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+            image_view_create_info.format = resource.format;
+            image_view_create_info.subresourceRange.aspectMask = get_aspect_mask(resource.format);
+            image_view_create_info.subresourceRange.levelCount = 1;
+            image_view_create_info.subresourceRange.layerCount = 1;
+            VK_CHECK(vkCreateImageView(virtual_device, &image_view_create_info, nullptr, &transient_image.image_view),
+                     "Unable to create view of transient image: {}")
+        }
+        return {};
+    }
+
+    auto RenderGraph::build_barriers() noexcept -> void {
+        std::vector<ResourceState> states(_resources.size());
+        for(size_t i = 0; i < _resources.size(); i++) {
+            if(_resources[i].is_imported) {
+                states[i].layout = _resources[i].initial_layout;
+                states[i].write_stage_mask = _resources[i].initial_stage;
+            }
+        }
+
+        std::vector<uint32_t> slot_owners(_memory_slots.size(), NO_RESOURCE);
+        std::vector<MergedAccess> merged_accesses {};
+        _pass_barriers.assign(_compiled_passes.size(), BarrierBatch {});
+        _statistics.barrier_count = 0;
+        for(uint32_t compiled_index = 0; compiled_index < _compiled_passes.size(); compiled_index++) {
+            const auto& pass = *_passes[_compiled_passes[compiled_index]];
+            auto& barriers = _pass_barriers[compiled_index];
+
+            // Merge all accesses of the pass to the same image, so the image is only synchronized once per pass
+            merged_accesses.clear();
+            for(const auto& access : pass._accesses) {
+                const auto usage_info = get_usage_info(access.usage, pass._type);
+                const auto iterator =
+                        std::find_if(merged_accesses.begin(), merged_accesses.end(),
+                                     [&](const MergedAccess& merged) { return merged.resource == access.resource; });
+                if(iterator == merged_accesses.end()) {
+                    merged_accesses.push_back({access.resource, usage_info, access.is_write});
+                    continue;
+                }
+
+                iterator->usage_info.stage_mask |= usage_info.stage_mask;
+                iterator->usage_info.access_mask |= usage_info.access_mask;
+                if(access.is_write) {
+                    iterator->usage_info.layout = usage_info.layout;
+                    iterator->is_write = true;
+                }
+            }
+
+            for(const auto& merged : merged_accesses) {
+                const auto& resource = _resources[merged.resource];
+                const auto& usage_info = merged.usage_info;
+                auto& state = states[merged.resource];
+
+                // The first use of a transient image waits for the last use of the previous image in the same memory
+                if(!resource.is_imported && resource.first_pass == compiled_index) {
+                    auto& slot_owner = slot_owners[resource.memory_slot];
+                    if(slot_owner != NO_RESOURCE) {
+                        const auto& owner_state = states[slot_owner];
+                        state.write_stage_mask = owner_state.write_stage_mask | owner_state.read_stage_mask;
+                        state.write_access_mask = owner_state.write_access_mask;
+                    }
+                    slot_owner = merged.resource;
+                }
+
+                if(merged.is_write || state.layout != usage_info.layout) {
+                    // Writes and layout transitions wait for all previous reads and writes of the image
+                    if(state.layout != usage_info.layout || state.write_stage_mask != VK_PIPELINE_STAGE_2_NONE ||
+                       state.read_stage_mask != VK_PIPELINE_STAGE_2_NONE) {
+                        barriers.image_barrier(resource.image, get_subresource_range(resource.format), state.layout,
+                                               usage_info.layout, state.write_stage_mask | state.read_stage_mask,
+                                               state.write_access_mask, usage_info.stage_mask,
+                                               usage_info.access_mask);
+                    }
+                    state.layout = usage_info.layout;
+                    state.write_stage_mask = usage_info.stage_mask;
+                    state.write_access_mask =
+                            merged.is_write ? usage_info.access_mask & WRITE_ACCESS_MASK : VK_ACCESS_2_NONE;
+                    state.read_stage_mask = VK_PIPELINE_STAGE_2_NONE;
+
+                    // A write isn't visible to any later read yet. A transition for a read makes the previous write
+                    // visible to the stages and accesses of the read.
+                    state.visible_stage_mask = merged.is_write ? VK_PIPELINE_STAGE_2_NONE : usage_info.stage_mask;
+                    state.visible_access_mask = merged.is_write ? VK_ACCESS_2_NONE : usage_info.access_mask;
+                    continue;
+                }
+
+                // Reads only wait for the last write, if it isn't visible to the stages and accesses of the read yet
+                if(state.write_stage_mask != VK_PIPELINE_STAGE_2_NONE &&
+                   ((usage_info.stage_mask & ~state.visible_stage_mask) != 0 ||
+                    (usage_info.access_mask & ~state.visible_access_mask) != 0)) {
+                    barriers.image_barrier(resource.image, get_subresource_range(resource.format), state.layout,
+                                           state.layout, state.write_stage_mask, state.write_access_mask,
+                                           usage_info.stage_mask, usage_info.access_mask);
+                    state.visible_stage_mask |= usage_info.stage_mask;
+                    state.visible_access_mask |= usage_info.access_mask;
+                }
+                state.read_stage_mask |= usage_info.stage_mask;
+            }
+            _statistics.barrier_count += barriers.get_barrier_count();
+        }
+
+        // Transition the imported images into their final layout after the last pass
+        _final_barriers.clear();
+        for(size_t i = 0; i < _resources.size(); i++) {
+            const auto& resource = _resources[i];
+            const auto& state = states[i];
+            if(!resource.is_imported || resource.first_pass == NO_PASS ||
+               resource.final_layout == VK_IMAGE_LAYOUT_UNDEFINED || resource.final_layout == state.layout) {
+                continue;
+            }
+            _final_barriers.image_barrier(resource.image, get_subresource_range(resource.format), state.layout,
+                                          resource.final_layout, state.write_stage_mask | state.read_stage_mask,
+                                          state.write_access_mask, VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE);
+        }
+        _statistics.barrier_count += _final_barriers.get_barrier_count();
+    }
+
+    auto RenderGraph::destroy_transient_images() noexcept -> void {
+        // Graphs without a device only plan the transient images, so there are no Vulkan objects to destroy
+        if(_vulkan_device != nullptr) {
+            const auto virtual_device = _vulkan_device->get_virtual_device();
+            for(const auto& transient_image : _transient_images) {
+                if(transient_image.image_view != VK_NULL_HANDLE) {
+                    vkDestroyImageView(virtual_device, transient_image.image_view, nullptr);
+                }
+                vkDestroyImage(virtual_device, transient_image.image, nullptr);
+            }
+            for(const auto& memory_slot : _memory_slots) {
+                if(memory_slot.allocation.memory != VK_NULL_HANDLE) {
+                    _vulkan_device->get_memory_allocator().free(memory_slot.allocation);
+                }
+            }
+        }
+        _transient_images.clear();
+        _transient_slots.clear();
+        _memory_slots.clear();
+        _transient_key.clear();
+    }
+
+    /**
+     * This function compiles the graph. The unused passes are culled, the transient images are placed into memory
+     * and the barriers of all passes are generated.
+     *
+     * @return Success or error
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto RenderGraph::compile() noexcept -> kstd::Result<void> {
+        for(const auto& pass : _passes) {
+            for(const auto& access : pass->_accesses) {
+                if(access.resource >= _resources.size()) {
+                    return kstd::Error {fmt::format("Unable to compile render graph: Pass '{}' uses unknown image {}",
+                                                    pass->_name, access.resource)};
+                }
+            }
+        }
+        cull_passes();
+
+        // Transient images have no content before their first write
+        std::vector<bool> is_written(_resources.size(), false);
+        for(const auto pass_index : _compiled_passes) {
+            const auto& pass = *_passes[pass_index];
+            for(const auto& access : pass._accesses) {
+                const auto& resource = _resources[access.resource];
+                if(!access.is_write && !resource.is_imported && !is_written[access.resource]) {
+                    return kstd::Error {fmt::format(
+                            "Unable to compile render graph: Pass '{}' reads image '{}' before it is written",
+                            pass._name, resource.name)};
+                }
+            }
+            for(const auto& access : pass._accesses) {
+                if(access.is_write) {
+                    is_written[access.resource] = true;
+                }
+            }
+        }
+
+        if(const auto create_result = create_transient_images(); create_result.is_error()) {
+            return create_result;
+        }
+        build_barriers();
+        _statistics.pass_count = static_cast<uint32_t>(_passes.size());
+        _statistics.culled_pass_count = static_cast<uint32_t>(_passes.size() - _compiled_passes.size());
+        _is_compiled = true;
+        return {};
+    }
+
+    /**
+     * This function records all passes, which weren't culled, into the specified command buffer. The barriers of each
+     * pass are recorded with a single vkCmdPipelineBarrier2 call before the pass.
+     *
+     * @param command_buffer The command buffer
+     * @return               Success or error
+     *
+     * @author               Cedric Hammes
+     * @since                16/10/2026
+     */
+    auto RenderGraph::execute(VkCommandBuffer command_buffer) const noexcept -> kstd::Result<void> {
+        using namespace std::string_literals;
+        if(!_is_compiled) {
+            return kstd::Error {"Unable to execute render graph: The graph isn't compiled"s};
+        }
+
+        for(size_t compiled_index = 0; compiled_index < _compiled_passes.size(); compiled_index++) {
+            _pass_barriers[compiled_index].record(command_buffer);
+            const auto& pass = *_passes[_compiled_passes[compiled_index]];
+            if(pass._execute_function) {
+                pass._execute_function(command_buffer, *this);
+            }
+        }
+        _final_barriers.record(command_buffer);
+        return {};
+    }
+
+    /**
+     * This function removes all passes and images from the graph. The transient images are kept for the next
+     * compilation.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto RenderGraph::reset() noexcept -> void {
+        _resources.clear();
+        _passes.clear();
+        _compiled_passes.clear();
+        _pass_barriers.clear();
+        _final_barriers.clear();
+        _is_compiled = false;
+    }
+
+    auto RenderGraph::get_image(RenderGraphResource resource) const noexcept -> VkImage {
+        return _resources.at(resource).image;
+    }
+
+    auto RenderGraph::get_image_view(RenderGraphResource resource) const noexcept -> VkImageView {
+        return _resources.at(resource).image_view;
+    }
+
+    auto RenderGraph::get_format(RenderGraphResource resource) const noexcept -> VkFormat {
+        return _resources.at(resource).format;
+    }
+
+    auto RenderGraph::get_extent(RenderGraphResource resource) const noexcept -> VkExtent2D {
+        return _resources.at(resource).extent;
+    }
+
+    auto RenderGraph::get_pass_barriers(uint32_t compiled_index) const noexcept -> const BarrierBatch& {
+        return _pass_barriers.at(compiled_index);
+    }
+
+    auto RenderGraph::get_statistics() const noexcept -> const RenderGraphStatistics& {
+        return _statistics;
+    }
+}// namespace aetherium::renderer::vulkan
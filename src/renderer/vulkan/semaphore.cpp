@@ -0,0 +1,135 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "aetherium/renderer/vulkan/semaphore.hpp"
+
+namespace aetherium::renderer::vulkan {
+    /**
+     * This constructor creates an empty timeline semaphore
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    TimelineSemaphore::TimelineSemaphore() noexcept :// NOLINT
+            _device {nullptr},
+            _semaphore_handle {nullptr} {
+    }
+
+    /**
+     * This constructor creates the timeline semaphore by the specified device and the initial counter value.
+     *
+     * @param device        The device on which the semaphore is to be created
+     * @param initial_value The initial value of the counter
+     *
+     * @author              Cedric Hammes
+     * @since               16/10/2026
+     */
+    TimelineSemaphore::TimelineSemaphore(const VulkanDevice* device, uint64_t initial_value) :
+            _device {device},
+            _semaphore_handle {nullptr} {
+        VkSemaphoreTypeCreateInfo semaphore_type_create_info {};
+        semaphore_type_create_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        semaphore_type_create_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+        semaphore_type_create_info.initialValue = initial_value;
+
+        VkSemaphoreCreateInfo semaphore_create_info {};
+        semaphore_create_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphore_create_info.pNext = &semaphore_type_create_info;
+        VK_CHECK_EX(vkCreateSemaphore(_device->get_virtual_device(), &semaphore_create_info, nullptr,
+                                      &_semaphore_handle),
+                    "Unable to create timeline semaphore: {}")
+    }
+
+    TimelineSemaphore::TimelineSemaphore(TimelineSemaphore&& other) noexcept :
+            _device {other._device},
+            _semaphore_handle {other._semaphore_handle} {
+        other._device = nullptr;
+        other._semaphore_handle = nullptr;
+    }
+
+    TimelineSemaphore::~TimelineSemaphore() noexcept {
+        if(_semaphore_handle != nullptr) {
+            vkDestroySemaphore(_device->get_virtual_device(), _semaphore_handle, nullptr);
+            _semaphore_handle = nullptr;
+        }
+    }
+
+    /**
+     * This function sets the counter of the semaphore to the specified value from the CPU-side. The value has to be
+     * greater than the current value of the counter.
+     *
+     * @param value The new value of the counter
+     * @return      Success or error
+     *
+     * @author      Cedric Hammes
+     * @since       16/10/2026
+     */
+    auto TimelineSemaphore::signal(uint64_t value) const noexcept -> kstd::Result<void> {
+        VkSemaphoreSignalInfo signal_info {};
+        signal_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO;
+        signal_info.semaphore = _semaphore_handle;
+        signal_info.value = value;
+        VK_CHECK(vkSignalSemaphore(_device->get_virtual_device(), &signal_info), "Unable to signal semaphore: {}")
+        return {};
+    }
+
+    /**
+     * This function waits until the counter of the semaphore reaches the specified value. We are waiting based on the
+     * specified timeout.
+     *
+     * @param value   The value to wait for
+     * @param timeout The maximal wait timeout
+     * @return        Success or error
+     *
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto TimelineSemaphore::wait(uint64_t value, uint64_t timeout) const noexcept -> kstd::Result<void> {
+        VkSemaphoreWaitInfo wait_info {};
+        wait_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+        wait_info.semaphoreCount = 1;
+        wait_info.pSemaphores = &_semaphore_handle;
+        wait_info.pValues = &value;
+        VK_CHECK(vkWaitSemaphores(_device->get_virtual_device(), &wait_info, timeout),
+                 "Unable to wait for semaphore: {}")
+        return {};
+    }
+
+    /**
+     * This function returns the current value of the counter without blocking.
+     *
+     * @return The current counter value or an error
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto TimelineSemaphore::query() const noexcept -> kstd::Result<uint64_t> {
+        uint64_t value = 0;
+        VK_CHECK(vkGetSemaphoreCounterValue(_device->get_virtual_device(), _semaphore_handle, &value),
+                 "Unable to query semaphore: {}")
+        return value;
+    }
+
+    auto TimelineSemaphore::operator=(TimelineSemaphore&& other) noexcept -> TimelineSemaphore& {
+        _device = other._device;
+        _semaphore_handle = other._semaphore_handle;
+        other._device = nullptr;
+        other._semaphore_handle = nullptr;
+        return *this;
+    }
+
+    auto TimelineSemaphore::operator*() const noexcept -> VkSemaphore {
+        return _semaphore_handle;
+    }
+}// namespace aetherium::renderer::vulkan
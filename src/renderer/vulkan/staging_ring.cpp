@@ -0,0 +1,323 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "aetherium/renderer/vulkan/staging_ring.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+namespace aetherium::renderer::vulkan {
+    /**
+     * This constructor creates the staging buffer with the specified capacity and maps it persistently.
+     *
+     * @param device            The device, on which the buffer is created
+     * @param memory_allocator  The allocator of the buffer memory
+     * @param command_submitter The submitter of the transfer queue
+     * @param capacity          The size of the ring in bytes
+     *
+     * @author                  Cedric Hammes
+     * @since                   16/10/2026
+     */
+    StagingRing::StagingRing(VkDevice device, MemoryAllocator* memory_allocator, CommandSubmitter* command_submitter,
+                             VkDeviceSize capacity) :
+            _device {device},
+            _memory_allocator {memory_allocator},
+            _command_submitter {command_submitter},
+            _buffer {VK_NULL_HANDLE},
+            _allocation {},
+            _capacity {capacity},
+            _head {0},
+            _tail {0} {
+        VkBufferCreateInfo buffer_create_info {};
+        buffer_create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        buffer_create_info.size = _capacity;
+        buffer_create_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        buffer_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        VK_CHECK_EX(vkCreateBuffer(_device, &buffer_create_info, nullptr, &_buffer),
+                    "Unable to create staging ring: {}")
+
+        const auto allocation_result = _memory_allocator->allocate_for_buffer(_buffer, CPU_TO_GPU);
+        if(allocation_result.is_error()) {
+            vkDestroyBuffer(_device, _buffer, nullptr);
+            throw std::runtime_error {fmt::format("Unable to create staging ring: {}", allocation_result.get_error())};
+        }
+        _allocation = *allocation_result;
+    }
+
+    StagingRing::~StagingRing() noexcept {
+        if(_buffer != VK_NULL_HANDLE) {
+            // The copies of the last flush read from the buffer, so the batch of the last flush and with it all earlier
+            // batches have to be executed before the buffer is destroyed
+            static_cast<void>(_last_ticket.wait());
+            vkDestroyBuffer(_device, _buffer, nullptr);
+            _memory_allocator->free(_allocation);
+            _buffer = VK_NULL_HANDLE;
+        }
+    }
+
+    auto StagingRing::try_allocate(VkDeviceSize size, VkDeviceSize alignment) noexcept
+            -> kstd::Result<VkDeviceSize> {
+        using namespace std::string_literals;
+
+        // Without any live region, the ring starts again at the beginning
+        if(_pending_regions.empty() && _in_flight_regions.empty()) {
+            _head = 0;
+            _tail = 0;
+        }
+
+        // The head stays strictly behind the tail after a wrap, so a full ring is never mistaken for an empty one
+        const auto offset = (_head + alignment - 1) & ~(alignment - 1);
+        if(_head >= _tail) {
+            if(offset + size <= _capacity) {
+                _head = offset + size;
+                return offset;
+            }
+            if(size < _tail) {
+                _head = size;
+                return VkDeviceSize {0};
+            }
+        }
+        else if(offset + size < _tail) {
+            _head = offset + size;
+            return offset;
+        }
+        return kstd::Error {"Unable to allocate staging region: Staging ring is full"s};
+    }
+
+    auto StagingRing::reclaim() noexcept -> void {
+        while(!_in_flight_regions.empty() && _in_flight_regions.front().ticket.is_done()) {
+            _tail = _in_flight_regions.front().end;
+            _in_flight_regions.pop_front();
+        }
+    }
+
+    auto StagingRing::mark_done(VkDeviceSize offset) noexcept -> void {
+        // The copies are usually enqueued for the most recent regions, so the search starts at the back
+        const auto region = std::find_if(_pending_regions.rbegin(), _pending_regions.rend(),
+                                         [&](const PendingRegion& pending_region) {
+                                             return pending_region.offset == offset;
+                                         });
+        if(region != _pending_regions.rend()) {
+            region->is_done = true;
+        }
+    }
+
+    auto StagingRing::allocate_locked(VkDeviceSize size, VkDeviceSize alignment) noexcept
+            -> kstd::Result<StagingRegion> {
+        using namespace std::string_literals;
+        if(size == 0 || size > _capacity) {
+            return kstd::Error {fmt::format("Unable to allocate staging region: Invalid size {}", size)};
+        }
+
+        while(true) {
+            reclaim();
+            if(const auto offset = try_allocate(size, alignment); !offset.is_error()) {
+                _pending_regions.push_back({*offset, _head, false});
+                return StagingRegion {static_cast<uint8_t*>(_allocation.mapped_data) + *offset, *offset, size};
+            }
+
+            // Only regions, which are not flushed yet, block the allocation, so they are flushed first
+            if(_in_flight_regions.empty()) {
+                if(const auto flush_result = flush_locked(); flush_result.is_error()) {
+                    return kstd::Error {flush_result.get_error()};
+                }
+                if(_in_flight_regions.empty()) {
+                    return kstd::Error {"Unable to allocate staging region: Staging ring is full of regions, which "
+                                        "are neither copied nor released"s};
+                }
+            }
+
+            if(const auto wait_result = _in_flight_regions.front().ticket.wait(); wait_result.is_error()) {
+                return kstd::Error {wait_result.get_error()};
+            }
+        }
+    }
+
+    auto StagingRing::flush_locked() noexcept -> kstd::Result<SubmitTicket> {
+        if(_buffer_copies.empty() && _image_copies.empty()) {
+            release_done_regions();
+            return SubmitTicket {};
+        }
+
+        // Sort the copies by the destination, so the copies of a destination are merged into a single command
+        const auto compare_buffer = [](const BufferCopy& left, const BufferCopy& right) {
+            return left.buffer < right.buffer;
+        };
+        const auto compare_image = [](const ImageCopy& left, const ImageCopy& right) {
+            return left.image < right.image;
+        };
+        std::stable_sort(_buffer_copies.begin(), _buffer_copies.end(), compare_buffer);
+        std::stable_sort(_image_copies.begin(), _image_copies.end(), compare_image);
+
+        const auto ticket = _command_submitter->record([&](VkCommandBuffer command_buffer) {
+            std::vector<VkBufferCopy> buffer_regions {};
+            for(auto begin = _buffer_copies.cbegin(); begin != _buffer_copies.cend();) {
+                const auto end = std::upper_bound(begin, _buffer_copies.cend(), *begin, compare_buffer);
+                buffer_regions.clear();
+                std::transform(begin, end, std::back_inserter(buffer_regions),
+                               [](const BufferCopy& buffer_copy) { return buffer_copy.copy; });
+                vkCmdCopyBuffer(command_buffer, _buffer, begin->buffer, static_cast<uint32_t>(buffer_regions.size()),
+                                buffer_regions.data());
+                begin = end;
+            }
+
+            std::vector<VkBufferImageCopy> image_regions {};
+            for(auto begin = _image_copies.cbegin(); begin != _image_copies.cend();) {
+                const auto end = std::upper_bound(begin, _image_copies.cend(), *begin, compare_image);
+                image_regions.clear();
+                std::transform(begin, end, std::back_inserter(image_regions),
+                               [](const ImageCopy& image_copy) { return image_copy.copy; });
+                vkCmdCopyBufferToImage(command_buffer, _buffer, begin->image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                       static_cast<uint32_t>(image_regions.size()), image_regions.data());
+                begin = end;
+            }
+        });
+        if(ticket.is_error()) {
+            return ticket;
+        }
+
+        _last_ticket = *ticket;
+        _buffer_copies.clear();
+        _image_copies.clear();
+        release_done_regions();
+        return ticket;
+    }
+
+    auto StagingRing::release_done_regions() noexcept -> void {
+        // Only release the space up to the first region, which is neither copied nor released, the producer may still
+        // write into it. The released regions are reused after the last flush, because their copies may be part of
+        // any earlier flush.
+        auto has_released_regions = false;
+        VkDeviceSize released_end = 0;
+        while(!_pending_regions.empty() && _pending_regions.front().is_done) {
+            released_end = _pending_regions.front().end;
+            has_released_regions = true;
+            _pending_regions.pop_front();
+        }
+        if(has_released_regions) {
+            _in_flight_regions.push_back({_last_ticket, released_end});
+        }
+    }
+
+    /**
+     * This function allocates a region of the ring. If the ring is full, the function waits until the oldest flush is
+     * done.
+     *
+     * @param size      The size of the region
+     * @param alignment The alignment of the region in the staging buffer
+     * @return          The region or an error
+     *
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto StagingRing::allocate(VkDeviceSize size, VkDeviceSize alignment) noexcept -> kstd::Result<StagingRegion> {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        return allocate_locked(size, alignment);
+    }
+
+    /**
+     * This function enqueues a copy of the specified region into the buffer. Copies into the same buffer are merged
+     * into a single copy command.
+     *
+     * @param region The region with the data
+     * @param buffer The destination buffer
+     * @param offset The offset in the destination buffer
+     *
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto StagingRing::copy_to_buffer(const StagingRegion& region, VkBuffer buffer, VkDeviceSize offset) noexcept
+            -> void {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        _buffer_copies.push_back({buffer, {region.offset, offset, region.size}});
+        mark_done(region.offset);
+    }
+
+    /**
+     * This function enqueues a copy of the specified region into the image. The buffer offset of the copy is relative
+     * to the region.
+     *
+     * @param region The region with the data
+     * @param image  The destination image
+     * @param copy   The description of the copy
+     *
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto StagingRing::copy_to_image(const StagingRegion& region, VkImage image, const VkBufferImageCopy& copy) noexcept
+            -> void {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        auto image_copy = copy;
+        image_copy.bufferOffset += region.offset;
+        _image_copies.push_back({image, image_copy});
+        mark_done(region.offset);
+    }
+
+    /**
+     * This function gives a region, which isn't copied, back to the ring. The producer must not write into the region
+     * anymore, the space is released with the next flush.
+     *
+     * @param region The region, which was allocated from this ring
+     *
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto StagingRing::release(const StagingRegion& region) noexcept -> void {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        mark_done(region.offset);
+    }
+
+    /**
+     * This function copies the specified data into the ring and enqueues the copy into the buffer.
+     *
+     * @param buffer The destination buffer
+     * @param offset The offset in the destination buffer
+     * @param data   The data
+     * @param size   The size of the data
+     * @return       Success or error
+     *
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto StagingRing::upload(VkBuffer buffer, VkDeviceSize offset, const void* data, VkDeviceSize size) noexcept
+            -> kstd::Result<void> {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        const auto region = allocate_locked(size, 16);
+        if(region.is_error()) {
+            return kstd::Error {region.get_error()};
+        }
+        std::memcpy(region->data, data, size);
+        _buffer_copies.push_back({buffer, {region->offset, offset, size}});
+        _pending_regions.back().is_done = true;
+        return {};
+    }
+
+    /**
+     * This function records all enqueued copies into a single command buffer of the transfer queue. The command buffer
+     * is submitted with the next flush of the transfer queue. The returned ticket is done when the copies are done.
+     *
+     * @return The ticket of the copies or an error
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto StagingRing::flush() noexcept -> kstd::Result<SubmitTicket> {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        return flush_locked();
+    }
+
+    auto StagingRing::get_capacity() const noexcept -> VkDeviceSize {
+        return _capacity;
+    }
+}// namespace aetherium::renderer::vulkan
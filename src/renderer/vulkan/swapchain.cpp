@@ -13,58 +13,185 @@
 // limitations under the License.
 
 #include "aetherium/renderer/vulkan/swapchain.hpp"
+#include "SDL2/SDL_vulkan.h"
+#include <algorithm>
+#include <limits>
 
 namespace aetherium::renderer::vulkan {
     Swapchain::Swapchain() noexcept :// NOLINT
+            _vulkan_context {nullptr},
             _vulkan_device {nullptr},
             _swapchain {nullptr},
+            _format {VK_FORMAT_UNDEFINED},
+            _extent {0, 0},
+            _drawable_extent {0, 0},
+            _present_mode {VK_PRESENT_MODE_FIFO_KHR},
             _image_views {},
-            _images {} {
+            _images {},
+            _current_image_index {0},
+            _is_out_of_date {false} {
     }
 
-    Swapchain::Swapchain(const VulkanContext& context, const VulkanDevice* vulkan_device) :// NOLINT
-            _vulkan_device {vulkan_device} {
-        // Get window bounds
+    /**
+     * This constructor creates the swapchain for the surface of the specified context. The present mode and image count
+     * are chosen by the options and the capabilities of the surface.
+     *
+     * @param context       The context with the surface
+     * @param vulkan_device The device, on which the swapchain is created
+     * @param options       The options of the swapchain
+     *
+     * @author              Cedric Hammes
+     * @since               16/10/2026
+     */
+    Swapchain::Swapchain(const VulkanContext& context, const VulkanDevice* vulkan_device,
+                         const SwapchainOptions& options) :// NOLINT
+            _vulkan_context {&context},
+            _vulkan_device {vulkan_device},
+            _options {options},
+            _swapchain {nullptr},
+            _format {VK_FORMAT_B8G8R8A8_UNORM},
+            _extent {0, 0},
+            _drawable_extent {0, 0},
+            _present_mode {VK_PRESENT_MODE_FIFO_KHR},
+            _current_image_index {0},
+            _is_out_of_date {false} {
+        create().throw_if_error();
+    }
+
+    Swapchain::~Swapchain() noexcept {
+        if(!_image_views.empty()) {
+            for(auto& image_view : _image_views) {
+                vkDestroyImageView(_vulkan_device->get_virtual_device(), image_view, nullptr);
+            }
+            _image_views = {};
+        }
+
+        if(_swapchain != nullptr) {
+            vkDestroySwapchainKHR(_vulkan_device->get_virtual_device(), _swapchain, nullptr);
+            _swapchain = nullptr;
+        }
+    }
+
+    Swapchain::Swapchain(Swapchain&& other) noexcept :// NOLINT
+            _vulkan_context {other._vulkan_context},
+            _vulkan_device {other._vulkan_device},
+            _options {other._options},
+            _swapchain {other._swapchain},
+            _format {other._format},
+            _extent {other._extent},
+            _drawable_extent {other._drawable_extent},
+            _present_mode {other._present_mode},
+            _image_views {std::move(other._image_views)},
+            _images {std::move(other._images)},
+            _current_image_index {other._current_image_index},
+            _is_out_of_date {other._is_out_of_date} {
+        other._vulkan_context = nullptr;
+        other._vulkan_device = nullptr;
+        other._swapchain = nullptr;
+        other._image_views = {};
+        other._images = {};
+    }
+
+    auto Swapchain::get_drawable_extent() const noexcept -> VkExtent2D {
         int32_t width = 0;
-        int32_t height = 1;
-        SDL_GetWindowSize(context._window->get_window_handle(), &width, &height);
-        VkExtent2D window_size {static_cast<uint32_t>(width), static_cast<uint32_t>(height)};
+        int32_t height = 0;
+        SDL_Vulkan_GetDrawableSize(_vulkan_context->_window->get_window_handle(), &width, &height);
+        return {static_cast<uint32_t>(width), static_cast<uint32_t>(height)};
+    }
 
-        // Create swapchain
+    auto Swapchain::create() noexcept -> kstd::Result<void> {
+        const auto physical_device = _vulkan_device->get_physical_device();
+        const auto virtual_device = _vulkan_device->get_virtual_device();
+        const auto surface = _vulkan_context->_surface;
+        VkSurfaceCapabilitiesKHR surface_capabilities {};
+        VK_CHECK(vkGetPhysicalDeviceSurfaceCapabilitiesKHR(physical_device, surface, &surface_capabilities),
+                 "Unable to create swapchain: {}")
+
+        // The surface defines the extent, only surfaces without a fixed extent use the size of the window. The size of
+        // the window is remembered, because the extent may differ from it and only a resize makes the swapchain out of
+        // date.
+        const auto drawable_extent = get_drawable_extent();
+        _drawable_extent = drawable_extent;
+        auto extent = surface_capabilities.currentExtent;
+        if(extent.width == std::numeric_limits<uint32_t>::max()) {
+            extent.width = std::clamp(drawable_extent.width, surface_capabilities.minImageExtent.width,
+                                      surface_capabilities.maxImageExtent.width);
+            extent.height = std::clamp(drawable_extent.height, surface_capabilities.minImageExtent.height,
+                                       surface_capabilities.maxImageExtent.height);
+        }
+
+        // A minimized window has no extent, so the swapchain stays out of date until the window is restored
+        if(extent.width == 0 || extent.height == 0) {
+            _is_out_of_date = true;
+            return {};
+        }
+
+        // Use the preferred present mode if it's supported, otherwise fall back to FIFO
+        uint32_t present_mode_count = 0;
+        VK_CHECK(vkGetPhysicalDeviceSurfacePresentModesKHR(physical_device, surface, &present_mode_count, nullptr),
+                 "Unable to create swapchain: {}")
+        std::vector<VkPresentModeKHR> present_modes(present_mode_count);
+        VK_CHECK(vkGetPhysicalDeviceSurfacePresentModesKHR(physical_device, surface, &present_mode_count,
+                                                           present_modes.data()),
+                 "Unable to create swapchain: {}")
+        const auto is_supported =
+                std::find(present_modes.begin(), present_modes.end(), _options.present_mode) != present_modes.end();
+        const auto present_mode = is_supported ? _options.present_mode : VK_PRESENT_MODE_FIFO_KHR;
+
+        auto image_count = std::max(_options.image_count, surface_capabilities.minImageCount);
+        if(surface_capabilities.maxImageCount > 0) {
+            image_count = std::min(image_count, surface_capabilities.maxImageCount);
+        }
+
+        // Create swapchain, the old swapchain is retired by the creation and destroyed afterwards
         VkSwapchainCreateInfoKHR swapchain_create_info = {};
         swapchain_create_info.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
-        swapchain_create_info.surface = context._surface;
-        swapchain_create_info.imageFormat = VK_FORMAT_B8G8R8A8_UNORM;
+        swapchain_create_info.surface = surface;
+        swapchain_create_info.imageFormat = _format;
         swapchain_create_info.imageColorSpace = VK_COLORSPACE_SRGB_NONLINEAR_KHR;
         swapchain_create_info.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
         swapchain_create_info.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
-        swapchain_create_info.preTransform = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+        swapchain_create_info.preTransform = surface_capabilities.currentTransform;
         swapchain_create_info.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
-        swapchain_create_info.presentMode = VK_PRESENT_MODE_FIFO_KHR;
-        swapchain_create_info.minImageCount = 2;
+        swapchain_create_info.presentMode = present_mode;
+        swapchain_create_info.minImageCount = image_count;
         swapchain_create_info.imageArrayLayers = 1;
-        swapchain_create_info.imageExtent = window_size;
-        VK_CHECK_EX(vkCreateSwapchainKHR(_vulkan_device->get_virtual_device(), &swapchain_create_info, nullptr,
-                                         &_swapchain),
-                    "Unable to create swapchain: {}")
+        swapchain_create_info.imageExtent = extent;
+        swapchain_create_info.clipped = VK_TRUE;
+        swapchain_create_info.oldSwapchain = _swapchain;
+
+        VkSwapchainKHR swapchain {};
+        VK_CHECK(vkCreateSwapchainKHR(virtual_device, &swapchain_create_info, nullptr, &swapchain),
+                 "Unable to create swapchain: {}")
+        for(auto& image_view : _image_views) {
+            vkDestroyImageView(virtual_device, image_view, nullptr);
+        }
+        _image_views.clear();
+        _images.clear();
+        if(_swapchain != nullptr) {
+            vkDestroySwapchainKHR(virtual_device, _swapchain, nullptr);
+        }
+        _swapchain = swapchain;
+        _extent = extent;
+        _present_mode = present_mode;
+        _current_image_index = 0;
 
         // Get images
-        uint32_t image_count = 0;
-        VK_CHECK_EX(vkGetSwapchainImagesKHR(_vulkan_device->get_virtual_device(), _swapchain, &image_count, nullptr),
-                    "Unable to get images: {}")
-        _images.resize(image_count);
-        _image_views.resize(image_count);
-        VK_CHECK_EX(
-                vkGetSwapchainImagesKHR(_vulkan_device->get_virtual_device(), _swapchain, &image_count, _images.data()),
-                "Unable to get images: {}")
+        uint32_t swapchain_image_count = 0;
+        VK_CHECK(vkGetSwapchainImagesKHR(virtual_device, _swapchain, &swapchain_image_count, nullptr),
+                 "Unable to get images: {}")
+        _images.resize(swapchain_image_count);
+        VK_CHECK(vkGetSwapchainImagesKHR(virtual_device, _swapchain, &swapchain_image_count, _images.data()),
+                 "Unable to get images: {}")
 
         // Create image views from images
-        for(auto i = 0; i < _images.size(); i++) {
+        _image_views.reserve(_images.size());
+        for(auto* image : _images) {
             VkImageViewCreateInfo image_view_create_info {};
             image_view_create_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
-            image_view_create_info.image = _images[i];
+            image_view_create_info.image = image;
             image_view_create_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
-            image_view_create_info.format = VK_FORMAT_B8G8R8A8_UNORM;
+            image_view_create_info.format = _format;
             image_view_create_info.components.r = VK_COMPONENT_SWIZZLE_IDENTITY;
             image_view_create_info.components.g = VK_COMPONENT_SWIZZLE_IDENTITY;
             image_view_create_info.components.b = VK_COMPONENT_SWIZZLE_IDENTITY;
@@ -75,43 +202,103 @@ namespace aetherium::renderer::vulkan {
             image_view_create_info.subresourceRange.levelCount = 1;
             image_view_create_info.subresourceRange.baseArrayLayer = 0;
             image_view_create_info.subresourceRange.layerCount = 1;
-            VK_CHECK_EX(vkCreateImageView(_vulkan_device->get_virtual_device(), &image_view_create_info, nullptr,
-                                          _image_views.data() + i),
-                        "Unable to create swapchain: {}")
+
+            VkImageView image_view {};
+            VK_CHECK(vkCreateImageView(virtual_device, &image_view_create_info, nullptr, &image_view),
+                     "Unable to create swapchain: {}")
+            _image_views.push_back(image_view);
         }
+        _is_out_of_date = false;
+        return {};
     }
 
-    Swapchain::~Swapchain() noexcept {
-        if(!_image_views.empty()) {
-            for(auto& image_view : _image_views) {
-                vkDestroyImageView(_vulkan_device->get_virtual_device(), image_view, nullptr);
-            }
-            _image_views = {};
+    /**
+     * This function acquires the next image of the swapchain. If the swapchain is out of date, no image is acquired
+     * and the swapchain has to be recreated. A suboptimal swapchain still returns an image, but is marked as out of
+     * date.
+     *
+     * @param image_available_semaphore The semaphore, which is signaled when the image is available
+     * @return                          Whether an image was acquired or an error
+     *
+     * @author                          Cedric Hammes
+     * @since                           16/10/2026
+     */
+    auto Swapchain::next_image(VkSemaphore image_available_semaphore) noexcept -> kstd::Result<bool> {
+        const auto acquire_result = vkAcquireNextImageKHR(_vulkan_device->get_virtual_device(), _swapchain,
+                                                          std::numeric_limits<uint64_t>::max(),
+                                                          image_available_semaphore, VK_NULL_HANDLE,
+                                                          &_current_image_index);
+        if(acquire_result == VK_ERROR_OUT_OF_DATE_KHR) {
+            _is_out_of_date = true;
+            return false;
+        }
+        if(acquire_result == VK_SUBOPTIMAL_KHR) {
+            _is_out_of_date = true;
+            return true;
         }
+        VK_CHECK(acquire_result, "Unable to acquire next image: {}")
+        return true;
+    }
 
-        if(_swapchain != nullptr) {
-            vkDestroySwapchainKHR(_vulkan_device->get_virtual_device(), _swapchain, nullptr);
-            _swapchain = nullptr;
+    /**
+     * This function presents the current image on the specified queue. An out of date or suboptimal swapchain isn't an
+     * error, instead the swapchain is marked as out of date.
+     *
+     * @param queue          The queue, which presents the image
+     * @param wait_semaphore The semaphore, which is signaled when the image is rendered
+     * @return               Success or error
+     *
+     * @author               Cedric Hammes
+     * @since                16/10/2026
+     */
+    auto Swapchain::present(const Queue& queue, VkSemaphore wait_semaphore) noexcept -> kstd::Result<void> {
+        VkPresentInfoKHR present_info {};
+        present_info.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+        present_info.waitSemaphoreCount = 1;
+        present_info.pWaitSemaphores = &wait_semaphore;
+        present_info.swapchainCount = 1;
+        present_info.pSwapchains = &_swapchain;
+        present_info.pImageIndices = &_current_image_index;
+
+        const auto present_result = queue.present(present_info);
+        if(present_result.is_error()) {
+            return kstd::Error {present_result.get_error()};
+        }
+        if(*present_result != VK_SUCCESS) {
+            _is_out_of_date = true;
         }
+        return {};
     }
 
-    Swapchain::Swapchain(Swapchain&& other) noexcept :// NOLINT
-            _vulkan_device {other._vulkan_device},
-            _swapchain {other._swapchain},
-            _image_views {std::move(other._image_views)},
-            _images {std::move(other._images)} {
-        other._vulkan_device = nullptr;
-        other._swapchain = nullptr;
-        other._image_views = {};
-        other._images = {};
+    /**
+     * This function recreates the swapchain in place with the current size of the window. The old swapchain is passed
+     * to the new one, so the presentation engine can reuse its resources. While the window is minimized, the
+     * swapchain isn't recreated and stays out of date.
+     *
+     * @return Success or error
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto Swapchain::recreate() noexcept -> kstd::Result<void> {
+        // The images of the old swapchain may still be used by the frames in flight
+        VK_CHECK(vkDeviceWaitIdle(_vulkan_device->get_virtual_device()), "Unable to recreate swapchain: {}")
+        return create();
     }
 
-    auto Swapchain::next_image(VkSemaphore image_available_semaphore) noexcept -> kstd::Result<void> {
-        VK_CHECK(vkAcquireNextImageKHR(_vulkan_device->get_virtual_device(), _swapchain,
-                                       std::numeric_limits<uint64_t>::max(), image_available_semaphore, VK_NULL_HANDLE,
-                                       &_current_image_index),
-                 "Unable to acquire next image: {}")
-        return {};
+    /**
+     * This function returns whether the swapchain has to be recreated, because the presentation engine reported it or
+     * the size of the window has changed.
+     *
+     * @return Whether the swapchain is out of date
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto Swapchain::is_out_of_date() const noexcept -> bool {
+        const auto drawable_extent = get_drawable_extent();
+        return _is_out_of_date || drawable_extent.width != _drawable_extent.width ||
+               drawable_extent.height != _drawable_extent.height;
     }
 
     auto Swapchain::current_image() const noexcept -> VkImage {
@@ -126,11 +313,45 @@ namespace aetherium::renderer::vulkan {
         return _current_image_index;
     }
 
+    /**
+     * This function returns the format of the swapchain images. The format is needed by everything, which renders
+     * into the swapchain images with dynamic rendering.
+     *
+     * @return The format of the swapchain images
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto Swapchain::get_format() const noexcept -> VkFormat {
+        return _format;
+    }
+
+    auto Swapchain::get_extent() const noexcept -> VkExtent2D {
+        return _extent;
+    }
+
+    auto Swapchain::get_present_mode() const noexcept -> VkPresentModeKHR {
+        return _present_mode;
+    }
+
+    auto Swapchain::get_image_count() const noexcept -> uint32_t {
+        return static_cast<uint32_t>(_images.size());
+    }
+
     auto Swapchain::operator=(Swapchain&& other) noexcept -> Swapchain& {
+        _vulkan_context = other._vulkan_context;
         _vulkan_device = other._vulkan_device;
+        _options = other._options;
         _swapchain = other._swapchain;
+        _format = other._format;
+        _extent = other._extent;
+        _drawable_extent = other._drawable_extent;
+        _present_mode = other._present_mode;
         _images = std::move(other._images);
         _image_views = std::move(other._image_views);
+        _current_image_index = other._current_image_index;
+        _is_out_of_date = other._is_out_of_date;
+        other._vulkan_context = nullptr;
         other._vulkan_device = nullptr;
         other._swapchain = nullptr;
         other._images = {};
@@ -0,0 +1,144 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "aetherium/renderer/vulkan/uniform_allocator.hpp"
+#include <algorithm>
+
+namespace aetherium::renderer::vulkan {
+    /**
+     * This constructor creates an empty allocator without buffer.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    UniformAllocator::UniformAllocator() noexcept :
+            _vulkan_device {nullptr},
+            _buffer {VK_NULL_HANDLE},
+            _allocation {},
+            _linear_allocator {},
+            _alignment {1} {
+    }
+
+    /**
+     * This constructor creates the buffer of the allocator with the specified size on the device.
+     *
+     * @param vulkan_device The device, on which the buffer is created
+     * @param size          The size of the buffer
+     *
+     * @author              Cedric Hammes
+     * @since               16/10/2026
+     */
+    UniformAllocator::UniformAllocator(const VulkanDevice* vulkan_device, VkDeviceSize size) :
+            _vulkan_device {vulkan_device},
+            _buffer {VK_NULL_HANDLE},
+            _allocation {},
+            _linear_allocator {size},
+            _alignment {} {
+        const auto& limits = _vulkan_device->get_properties().limits;
+        _alignment = std::max(limits.minUniformBufferOffsetAlignment, limits.minStorageBufferOffsetAlignment);
+
+        VkBufferCreateInfo buffer_create_info {};
+        buffer_create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        buffer_create_info.size = size;
+        buffer_create_info.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        buffer_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        VK_CHECK_EX(vkCreateBuffer(_vulkan_device->get_virtual_device(), &buffer_create_info, nullptr, &_buffer),
+                    "Unable to create uniform allocator: {}")
+
+        const auto allocation_result = _vulkan_device->get_memory_allocator().allocate_for_buffer(_buffer, CPU_TO_GPU);
+        if(allocation_result.is_error()) {
+            vkDestroyBuffer(_vulkan_device->get_virtual_device(), _buffer, nullptr);
+            throw std::runtime_error {
+                    fmt::format("Unable to create uniform allocator: {}", allocation_result.get_error())};
+        }
+        _allocation = *allocation_result;
+    }
+
+    UniformAllocator::UniformAllocator(UniformAllocator&& other) noexcept :
+            _vulkan_device {other._vulkan_device},
+            _buffer {other._buffer},
+            _allocation {other._allocation},
+            _linear_allocator {other._linear_allocator},
+            _alignment {other._alignment} {
+        other._vulkan_device = nullptr;
+        other._buffer = VK_NULL_HANDLE;
+        other._allocation = {};
+    }
+
+    UniformAllocator::~UniformAllocator() noexcept {
+        if(_buffer != VK_NULL_HANDLE) {
+            vkDestroyBuffer(_vulkan_device->get_virtual_device(), _buffer, nullptr);
+            _vulkan_device->get_memory_allocator().free(_allocation);
+            _buffer = VK_NULL_HANDLE;
+        }
+    }
+
+    /**
+     * This function allocates a range with the specified size behind the last allocation.
+     *
+     * @param size The size of the range
+     * @return     The range or an error
+     *
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    auto UniformAllocator::allocate(VkDeviceSize size) noexcept -> kstd::Result<UniformAllocation> {
+        const auto offset_result = _linear_allocator.allocate(size, _alignment);
+        if(offset_result.is_error()) {
+            return kstd::Error {offset_result.get_error()};
+        }
+
+        const auto offset = *offset_result;
+        return UniformAllocation {static_cast<uint8_t*>(_allocation.mapped_data) + offset, _buffer,
+                                  static_cast<uint32_t>(offset), size};
+    }
+
+    /**
+     * This function frees all allocations at once. The GPU must be done with the buffer.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto UniformAllocator::reset() noexcept -> void {
+        _linear_allocator.reset();
+    }
+
+    auto UniformAllocator::get_alignment() const noexcept -> VkDeviceSize {
+        return _alignment;
+    }
+
+    auto UniformAllocator::get_used_size() const noexcept -> VkDeviceSize {
+        return _linear_allocator.get_used_size();
+    }
+
+    auto UniformAllocator::operator=(UniformAllocator&& other) noexcept -> UniformAllocator& {
+        if(_buffer != VK_NULL_HANDLE) {
+            vkDestroyBuffer(_vulkan_device->get_virtual_device(), _buffer, nullptr);
+            _vulkan_device->get_memory_allocator().free(_allocation);
+        }
+        _vulkan_device = other._vulkan_device;
+        _buffer = other._buffer;
+        _allocation = other._allocation;
+        _linear_allocator = other._linear_allocator;
+        _alignment = other._alignment;
+        other._vulkan_device = nullptr;
+        other._buffer = VK_NULL_HANDLE;
+        other._allocation = {};
+        return *this;
+    }
+
+    auto UniformAllocator::operator*() const noexcept -> VkBuffer {
+        return _buffer;
+    }
+}// namespace aetherium::renderer::vulkan
@@ -13,18 +13,474 @@
 // limitations under the License.
 
 #include "aetherium/resource.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 
 namespace aetherium {
-    ResourceManager::ResourceManager(std::string_view base_directory) noexcept ://NOLINT
-            _base_directory {base_directory} {
+    namespace {
+        auto get_nanoseconds_since(std::chrono::steady_clock::time_point start_time) noexcept -> uint64_t {
+            return static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time)
+                            .count());
+        }
+
+        // A resource depends on another resource of the reload, if the file of the other resource is a dependency of
+        // it. Every wave contains the resources whose dependencies are reloaded by the previous waves.
+        auto get_reload_waves(const std::vector<Resource*>& resources) noexcept -> std::vector<std::vector<size_t>> {
+            phmap::flat_hash_map<std::string, size_t> resource_indices {};
+            for(size_t i = 0; i < resources.size(); i++) {
+                resource_indices[resources[i]->get_resource_path().lexically_normal().string()] = i;
+            }
+
+            std::vector<std::vector<size_t>> dependents(resources.size());
+            std::vector<uint32_t> pending_dependencies(resources.size());
+            for(size_t i = 0; i < resources.size(); i++) {
+                for(const auto& dependency : resources[i]->get_dependencies()) {
+                    const auto iterator = resource_indices.find(dependency.lexically_normal().string());
+                    if(iterator != resource_indices.end() && iterator->second != i) {
+                        dependents[iterator->second].push_back(i);
+                        pending_dependencies[i]++;
+                    }
+                }
+            }
+
+            std::vector<std::vector<size_t>> waves {};
+            std::vector<size_t> wave {};
+            for(size_t i = 0; i < resources.size(); i++) {
+                if(pending_dependencies[i] == 0) {
+                    wave.push_back(i);
+                }
+            }
+
+            size_t scheduled_count = 0;
+            while(!wave.empty()) {
+                std::vector<size_t> next_wave {};
+                for(const auto index : wave) {
+                    for(const auto dependent : dependents[index]) {
+                        if(--pending_dependencies[dependent] == 0) {
+                            next_wave.push_back(dependent);
+                        }
+                    }
+                }
+                scheduled_count += wave.size();
+                waves.push_back(std::move(wave));
+                wave = std::move(next_wave);
+            }
+
+            // Resources in a dependency cycle are reloaded together after all other resources
+            if(scheduled_count < resources.size()) {
+                for(size_t i = 0; i < resources.size(); i++) {
+                    if(pending_dependencies[i] != 0) {
+                        wave.push_back(i);
+                    }
+                }
+                waves.push_back(std::move(wave));
+            }
+            return waves;
+        }
+    }// namespace
+
+    /**
+     * This constructor creates the resource manager with the default (empty) values. The worker pool, which
+     * reloads all resources with parallel reload support, is created on first use.
+     *
+     * @param base_directory The directory with the assets and the cache
+     * @param thread_count   The count of reload workers or zero for one worker per hardware thread
+     *
+     * @author               Cedric Hammes
+     * @since                02/02/2024
+     */
+    ResourceManager::ResourceManager(std::string_view base_directory, uint32_t thread_count) ://NOLINT
+            _base_directory {base_directory},
+            _thread_count {thread_count} {
+    }
+
+    /**
+     * This function returns the worker pool and creates it on the first call, so managers without parallel
+     * reloads or asynchronous loads don't start any threads.
+     *
+     * @return The worker pool of the manager
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto ResourceManager::get_thread_pool() -> ThreadPool& {
+        std::call_once(_thread_pool_flag, [this]() { _thread_pool = std::make_unique<ThreadPool>(_thread_count); });
+        return *_thread_pool;
+    }
+
+    /**
+     * This function returns the asynchronous loader and creates it with its I/O thread on the first call.
+     *
+     * @return The asynchronous loader of the manager
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto ResourceManager::get_resource_loader() -> ResourceLoader& {
+        std::call_once(_resource_loader_flag, [this]() {
+            _resource_loader = std::make_unique<ResourceLoader>(*this, get_thread_pool());
+        });
+        return *_resource_loader;
+    }
+
+    auto ResourceManager::next_type_index() noexcept -> uint32_t {
+        static std::atomic<uint32_t> type_count {0};
+        return type_count.fetch_add(1);
+    }
+
+    /**
+     * This function adds the resource into the manager and assigns a slot in the slot array of the resource type
+     * to it. If a resource with the same key is already loaded, the slot of this resource gets released first, so
+     * handles to the replaced resource become stale.
+     *
+     * @param type_index The index of the resource type
+     * @param key        The key of the resource
+     * @param resource   The resource itself
+     * @return           The index of the assigned slot
+     *
+     * @author           Cedric Hammes
+     * @since            16/10/2026
+     */
+    auto ResourceManager::insert_resource(uint32_t type_index, ResourceKey key,
+                                          std::shared_ptr<Resource> resource) noexcept -> uint32_t {
+        if(const auto iterator = _loaded_resources.find(key); iterator != _loaded_resources.end()) {
+            release_slot(iterator->second.type_index, iterator->second.slot_index);
+        }
+
+        if(type_index >= _resource_slots.size()) {
+            _resource_slots.resize(type_index + 1);
+        }
+        auto& [slots, free_indices] = _resource_slots[type_index];
+
+        // Reuse released slots first, so the slot array of the type stays dense
+        uint32_t slot_index;
+        if(!free_indices.empty()) {
+            slot_index = free_indices.back();
+            free_indices.pop_back();
+        }
+        else {
+            slot_index = static_cast<uint32_t>(slots.size());
+            slots.push_back({nullptr, 1});
+        }
+
+        slots[slot_index].resource = resource.get();
+        update_dependencies(resource.get());
+        _loaded_resources[std::move(key)] = {std::move(resource), type_index, slot_index};
+        return slot_index;
+    }
+
+    /**
+     * This function registers the resource file and the dependencies of the specified resource in the dependency
+     * index, which maps changed files to the resources to reload. The old entries of the resource are replaced.
+     *
+     * @param resource The resource
+     *
+     * @author         Cedric Hammes
+     * @since          16/10/2026
+     */
+    auto ResourceManager::update_dependencies(Resource* resource) noexcept -> void {
+        remove_dependencies(resource);
+
+        auto& paths = _dependencies[resource];
+        paths.push_back(resource->get_resource_path().lexically_normal().string());
+        for(const auto& dependency : resource->get_dependencies()) {
+            paths.push_back(dependency.lexically_normal().string());
+        }
+        for(const auto& path : paths) {
+            _dependents[path].push_back(resource);
+        }
+    }
+
+    /**
+     * This function removes all entries of the specified resource from the dependency index.
+     *
+     * @param resource The resource
+     *
+     * @author         Cedric Hammes
+     * @since          16/10/2026
+     */
+    auto ResourceManager::remove_dependencies(Resource* resource) noexcept -> void {
+        const auto iterator = _dependencies.find(resource);
+        if(iterator == _dependencies.end()) {
+            return;
+        }
+
+        for(const auto& path : iterator->second) {
+            const auto dependents = _dependents.find(path);
+            if(dependents == _dependents.end()) {
+                continue;
+            }
+            auto& resources = dependents->second;
+            resources.erase(std::remove(resources.begin(), resources.end(), resource), resources.end());
+            if(resources.empty()) {
+                _dependents.erase(dependents);
+            }
+        }
+        _dependencies.erase(iterator);
+    }
+
+    /**
+     * This function clears the specified slot, bumps the generation of it and marks the slot as free.
+     *
+     * @param type_index The index of the resource type
+     * @param slot_index The index of the slot
+     *
+     * @author           Cedric Hammes
+     * @since            16/10/2026
+     */
+    auto ResourceManager::release_slot(uint32_t type_index, uint32_t slot_index) noexcept -> void {
+        auto& [slots, free_indices] = _resource_slots[type_index];
+        auto& slot = slots[slot_index];
+        remove_dependencies(slot.resource);
+        slot.resource = nullptr;
+
+        // The generation zero is reserved for null handles
+        if(++slot.generation == 0) {
+            slot.generation = 1;
+        }
+        free_indices.push_back(slot_index);
+    }
+
+    /**
+     * This function removes the resource with the specified key from the manager and releases the slot of it.
+     *
+     * @param key The key of the resource
+     * @return    Whether a resource was unloaded
+     *
+     * @author    Cedric Hammes
+     * @since     16/10/2026
+     */
+    auto ResourceManager::unload_resource(const ResourceKeyView& key) noexcept -> bool {
+        const auto iterator = _loaded_resources.find(key);
+        if(iterator == _loaded_resources.end()) {
+            return false;
+        }
+
+        release_slot(iterator->second.type_index, iterator->second.slot_index);
+        _loaded_resources.erase(iterator);
+        return true;
+    }
+
+    /**
+     * This function reloads the specified resources in dependency waves. The resources of a wave with parallel reload
+     * support are partitioned over the workers, the other resources are reloaded by the calling thread. All resources
+     * are reloaded even if a reload fails, the errors of all failed reloads are returned at once.
+     *
+     * @param resources The resources to reload
+     * @return          Success or an error with all failed reloads
+     *
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto ResourceManager::reload_resources(const std::vector<Resource*>& resources) noexcept -> kstd::Result<void> {
+        const auto start_time = std::chrono::steady_clock::now();
+        std::vector<std::string> errors(resources.size());
+        std::vector<uint64_t> nanoseconds(resources.size());
+        const auto reload_resource = [&](size_t index) {
+            const auto reload_start_time = std::chrono::steady_clock::now();
+            if(const auto result = resources[index]->reload(*this); result.is_error()) {
+                errors[index] = result.get_error();
+            }
+            nanoseconds[index] = get_nanoseconds_since(reload_start_time);
+        };
+
+        const auto waves = get_reload_waves(resources);
+        for(const auto& wave : waves) {
+            std::vector<size_t> parallel_indices {};
+            std::vector<size_t> serial_indices {};
+            for(const auto index : wave) {
+                (resources[index]->supports_parallel_reload() ? parallel_indices : serial_indices).push_back(index);
+            }
+
+            // Submit the parallel reloads in chunks, so large reloads don't pay one task per resource. The calling
+            // thread reloads the other resources while the workers run. The pool is only created if it's needed.
+            std::vector<std::future<void>> futures {};
+            if(!parallel_indices.empty()) {
+                auto& thread_pool = get_thread_pool();
+                const auto chunk_size = std::max<size_t>(
+                        parallel_indices.size() / (static_cast<size_t>(thread_pool.get_thread_count()) * 4), 1);
+                futures.reserve((parallel_indices.size() + chunk_size - 1) / chunk_size);
+                for(size_t begin = 0; begin < parallel_indices.size(); begin += chunk_size) {
+                    const auto end = std::min(begin + chunk_size, parallel_indices.size());
+                    futures.push_back(thread_pool.submit([&, begin, end]() {
+                        for(auto i = begin; i < end; i++) {
+                            reload_resource(parallel_indices[i]);
+                        }
+                    }));
+                }
+            }
+
+            for(const auto index : serial_indices) {
+                reload_resource(index);
+            }
+
+            // Wait for all workers before the next wave, the next wave depends on the resources of this wave
+            for(auto& future : futures) {
+                future.get();
+            }
+        }
+
+        // The reload may change the dependencies, resources which aren't added into the manager yet are skipped
+        for(auto* resource : resources) {
+            if(_dependencies.contains(resource)) {
+                update_dependencies(resource);
+            }
+        }
+
+        ResourceReloadStatistics statistics {};
+        statistics.resource_count = static_cast<uint32_t>(resources.size());
+        statistics.wave_count = static_cast<uint32_t>(waves.size());
+        statistics.milliseconds = static_cast<double>(get_nanoseconds_since(start_time)) / 1e6;
+
+        std::string error_message {};
+        for(size_t i = 0; i < resources.size(); i++) {
+            const auto* runtime_type = &resources[i]->get_runtime_type();
+            auto timing = std::find_if(
+                    statistics.type_timings.begin(), statistics.type_timings.end(),
+                    [&](const auto& type_timing) { return type_timing.runtime_type == runtime_type; });
+            if(timing == statistics.type_timings.end()) {
+                timing = statistics.type_timings.insert(timing, {runtime_type, 0, 0.0});
+            }
+            timing->resource_count++;
+            timing->milliseconds += static_cast<double>(nanoseconds[i]) / 1e6;
+
+            if(!errors[i].empty()) {
+                statistics.error_count++;
+                error_message.append(fmt::format("\n'{}': {}", resources[i]->get_resource_path().string(), errors[i]));
+            }
+        }
+        _reload_statistics = std::move(statistics);
+
+        if(!error_message.empty()) {
+            return kstd::Error {fmt::format("Unable to reload {} of {} resources:{}", _reload_statistics.error_count,
+                                            resources.size(), error_message)};
+        }
+        return {};
+    }
+
+    /**
+     * This function finalizes the decoded asynchronous loads and adds the resources into the manager. This function
+     * should be called once per frame by the thread, which owns the resource manager.
+     *
+     * @param max_count The maximum count of finalized loads, to limit the time spent per frame
+     * @return          The count of finalized loads
+     *
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto ResourceManager::finalize_loads(uint32_t max_count) noexcept -> uint32_t {
+        const auto finalize = [this](Resource& resource) -> kstd::Result<void> {
+            if(resource.supports_staged_load()) {
+                return resource.finalize(*this);
+            }
+            if(!resource.supports_parallel_reload()) {
+                return resource.reload(*this);
+            }
+            return {};
+        };
+
+        // Without an asynchronous load the loader doesn't exist yet, so there is nothing to finalize
+        if(_resource_loader == nullptr) {
+            return 0;
+        }
+
+        uint32_t finalized_count = 0;
+        for(auto& request : _resource_loader->take_decoded(max_count)) {
+            if(request->is_cancelled.load()) {
+                request->resource = nullptr;
+                request->state.store(CANCELLED, std::memory_order_release);
+                continue;
+            }
+
+            if(const auto finalize_result = finalize(*request->resource); finalize_result.is_error()) {
+                request->error = finalize_result.get_error();
+                request->resource = nullptr;
+                request->state.store(FAILED, std::memory_order_release);
+                continue;
+            }
+
+            const auto type_index = request->type_index;
+            const auto slot_index = insert_resource(
+                    type_index, ResourceKey {request->runtime_type, request->space, request->path},
+                    std::move(request->resource));
+            request->slot_index = slot_index;
+            request->generation = _resource_slots[type_index].slots[slot_index].generation;
+            request->state.store(LOADED, std::memory_order_release);
+            finalized_count++;
+        }
+        return finalized_count;
     }
 
     auto ResourceManager::reload() noexcept -> kstd::Result<uint32_t> {
-        for(auto& _loaded_resource : _loaded_resources) {
-            if(const auto result = _loaded_resource.second->reload(*this); result.is_error()) {
-                return kstd::Error {result.get_error()};
+        std::vector<Resource*> resources {};
+        resources.reserve(_loaded_resources.size());
+        for(auto& [identifier, loaded_resource] : _loaded_resources) {
+            resources.push_back(loaded_resource.resource.get());
+        }
+
+        if(const auto result = reload_resources(resources); result.is_error()) {
+            return kstd::Error {result.get_error()};
+        }
+        return static_cast<uint32_t>(resources.size());
+    }
+
+    /**
+     * This function starts watching the assets directory for changed files. The changes are reloaded by
+     * reload_changed.
+     *
+     * @param debounce_time The time without events, after which a changed file is reloaded
+     * @return              Success or an error
+     *
+     * @author              Cedric Hammes
+     * @since               16/10/2026
+     */
+    auto ResourceManager::watch(std::chrono::milliseconds debounce_time) noexcept -> kstd::Result<void> {
+        auto file_watcher = std::make_unique<FileWatcher>(debounce_time);
+        if(const auto watch_result = file_watcher->watch(fs::path {_base_directory}.append("assets"));
+           watch_result.is_error()) {
+            return watch_result;
+        }
+        _file_watcher = std::move(file_watcher);
+        return {};
+    }
+
+    /**
+     * This function takes the changed files from the watcher and reloads the resources, which are loaded from these
+     * files or depend on them, as one batch. This function should be called once per frame.
+     *
+     * @return The count of reloaded resources or an error
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto ResourceManager::reload_changed() noexcept -> kstd::Result<uint32_t> {
+        if(_file_watcher == nullptr) {
+            return 0U;
+        }
+
+        // A resource depending on multiple changed files is only reloaded once
+        std::vector<Resource*> resources {};
+        phmap::flat_hash_set<Resource*> known_resources {};
+        for(const auto& path : _file_watcher->take_changes()) {
+            const auto dependents = _dependents.find(path.string());
+            if(dependents == _dependents.end()) {
+                continue;
+            }
+            for(auto* resource : dependents->second) {
+                if(known_resources.insert(resource).second) {
+                    resources.push_back(resource);
+                }
             }
         }
-        return _loaded_resources.size();
+
+        if(resources.empty()) {
+            return 0U;
+        }
+        if(const auto result = reload_resources(resources); result.is_error()) {
+            return kstd::Error {result.get_error()};
+        }
+        return static_cast<uint32_t>(resources.size());
     }
 }// namespace aetherium
\ No newline at end of file
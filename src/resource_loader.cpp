@@ -0,0 +1,227 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "aetherium/resource_loader.hpp"
+#include "aetherium/resource.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+namespace aetherium {
+    namespace {
+        auto fail_load(ResourceLoadRequest& request, std::string error) noexcept -> void {
+            request.error = std::move(error);
+            request.resource = nullptr;
+            request.data = {};
+            request.state.store(FAILED, std::memory_order_release);
+        }
+
+        auto cancel_load(ResourceLoadRequest& request) noexcept -> void {
+            request.resource = nullptr;
+            request.data = {};
+            request.state.store(CANCELLED, std::memory_order_release);
+        }
+    }// namespace
+
+    /**
+     * This constructor creates the loader and starts the I/O thread of it.
+     *
+     * @param resource_manager The resource manager, which is passed to the resources while decoding
+     * @param thread_pool      The thread pool, which decodes the resources
+     *
+     * @author                 Cedric Hammes
+     * @since                  16/10/2026
+     */
+    ResourceLoader::ResourceLoader(const ResourceManager& resource_manager, ThreadPool& thread_pool) :
+            _resource_manager {&resource_manager},
+            _thread_pool {&thread_pool},
+            _next_sequence {0},
+            _decoding_count {0},
+            _is_stopping {false},
+            _io_thread {[this]() { run_io_thread(); }} {
+    }
+
+    ResourceLoader::~ResourceLoader() noexcept {
+        stop();
+    }
+
+    auto ResourceLoader::run_io_thread() noexcept -> void {
+        while(true) {
+            std::shared_ptr<ResourceLoadRequest> request {};
+            {
+                std::unique_lock<std::mutex> lock {_mutex};
+                _condition.wait(lock, [this]() { return _is_stopping || !_read_queue.empty(); });
+                if(_is_stopping) {
+                    return;
+                }
+                request = _read_queue.top();
+                _read_queue.pop();
+            }
+
+            if(request->is_cancelled.load()) {
+                cancel_load(*request);
+                continue;
+            }
+
+            request->state.store(READING, std::memory_order_release);
+            const auto& resource_path = request->resource->get_resource_path();
+            std::error_code error_code {};
+            if(!fs::is_regular_file(resource_path, error_code)) {
+                fail_load(*request, fmt::format("Unable to load resource '{}': The resource path doesn't exists or "
+                                                "isn't a file",
+                                                request->path));
+                continue;
+            }
+
+            const auto is_staged = request->resource->supports_staged_load();
+            if(is_staged) {
+                std::ifstream stream {resource_path, std::ios::binary};
+                if(!stream) {
+                    fail_load(*request,
+                              fmt::format("Unable to load resource '{}': Unable to read the file", request->path));
+                    continue;
+                }
+                request->data.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+            }
+
+            // Resources without staged load and parallel reload support are reloaded by the finalization
+            if(!is_staged && !request->resource->supports_parallel_reload()) {
+                queue_finalize(std::move(request));
+                continue;
+            }
+
+            request->state.store(DECODING, std::memory_order_release);
+            {
+                const std::lock_guard<std::mutex> lock {_mutex};
+                _decoding_count++;
+            }
+            static_cast<void>(_thread_pool->submit([this, request]() { decode(request); }));
+        }
+    }
+
+    auto ResourceLoader::decode(const std::shared_ptr<ResourceLoadRequest>& request) noexcept -> void {
+        if(request->is_cancelled.load()) {
+            cancel_load(*request);
+        }
+        else {
+            auto& resource = *request->resource;
+            const auto decode_result = resource.supports_staged_load()
+                                               ? resource.decode(std::move(request->data), *_resource_manager)
+                                               : resource.reload(*_resource_manager);
+            request->data = {};
+            if(decode_result.is_error()) {
+                fail_load(*request, decode_result.get_error());
+            }
+            else {
+                queue_finalize(request);
+            }
+        }
+
+        {
+            const std::lock_guard<std::mutex> lock {_mutex};
+            _decoding_count--;
+        }
+        _condition.notify_all();
+    }
+
+    auto ResourceLoader::queue_finalize(std::shared_ptr<ResourceLoadRequest> request) noexcept -> void {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        if(_is_stopping) {
+            cancel_load(*request);
+            return;
+        }
+        request->state.store(FINALIZING, std::memory_order_release);
+        _finalize_queue.push_back(std::move(request));
+    }
+
+    /**
+     * This function queues the specified load for the I/O thread.
+     *
+     * @param request The load request
+     *
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto ResourceLoader::enqueue(std::shared_ptr<ResourceLoadRequest> request) noexcept -> void {
+        {
+            const std::lock_guard<std::mutex> lock {_mutex};
+            if(_is_stopping) {
+                cancel_load(*request);
+                return;
+            }
+            request->sequence = _next_sequence++;
+            _read_queue.push(std::move(request));
+        }
+        _condition.notify_all();
+    }
+
+    /**
+     * This function removes up to the specified count of decoded loads from the finalize queue. The loads with the
+     * highest priority are returned first.
+     *
+     * @param max_count The maximum count of loads
+     * @return          The decoded loads
+     *
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto ResourceLoader::take_decoded(uint32_t max_count) noexcept
+            -> std::vector<std::shared_ptr<ResourceLoadRequest>> {
+        const std::lock_guard<std::mutex> lock {_mutex};
+        std::sort(_finalize_queue.begin(), _finalize_queue.end(), [](const auto& left, const auto& right) {
+            if(left->priority != right->priority) {
+                return left->priority > right->priority;
+            }
+            return left->sequence < right->sequence;
+        });
+
+        const auto count = std::min<size_t>(max_count, _finalize_queue.size());
+        std::vector<std::shared_ptr<ResourceLoadRequest>> requests {
+                std::make_move_iterator(_finalize_queue.begin()),
+                std::make_move_iterator(_finalize_queue.begin() + static_cast<ptrdiff_t>(count))};
+        _finalize_queue.erase(_finalize_queue.begin(), _finalize_queue.begin() + static_cast<ptrdiff_t>(count));
+        return requests;
+    }
+
+    /**
+     * This function cancels all queued and decoded loads, stops the I/O thread and waits for the loads, which are
+     * decoded by the workers. The loader can't be used after it was stopped.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto ResourceLoader::stop() noexcept -> void {
+        {
+            const std::lock_guard<std::mutex> lock {_mutex};
+            _is_stopping = true;
+            while(!_read_queue.empty()) {
+                cancel_load(*_read_queue.top());
+                _read_queue.pop();
+            }
+        }
+        _condition.notify_all();
+        if(_io_thread.joinable()) {
+            _io_thread.join();
+        }
+
+        // The workers access the resource manager while decoding, so wait for them before the manager is destroyed.
+        // The decoded loads are never finalized after the stop, so they are cancelled.
+        std::unique_lock<std::mutex> lock {_mutex};
+        _condition.wait(lock, [this]() { return _decoding_count == 0; });
+        for(const auto& request : _finalize_queue) {
+            cancel_load(*request);
+        }
+        _finalize_queue.clear();
+    }
+}// namespace aetherium
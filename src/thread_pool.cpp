@@ -0,0 +1,82 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "aetherium/thread_pool.hpp"
+#include <algorithm>
+
+namespace aetherium {
+    /**
+     * This constructor creates the thread pool with the specified count of worker threads. If the count is zero, one
+     * worker per hardware thread is created.
+     *
+     * @param thread_count The count of worker threads
+     *
+     * @author             Cedric Hammes
+     * @since              16/10/2026
+     */
+    ThreadPool::ThreadPool(uint32_t thread_count) :
+            _is_stopping {false} {
+        if(thread_count == 0) {
+            thread_count = std::max(std::thread::hardware_concurrency(), 1U);
+        }
+
+        _workers.reserve(thread_count);
+        for(uint32_t i = 0; i < thread_count; i++) {
+            _workers.emplace_back([this]() { run_worker(); });
+        }
+    }
+
+    ThreadPool::~ThreadPool() noexcept {
+        {
+            const std::lock_guard<std::mutex> lock {_mutex};
+            _is_stopping = true;
+        }
+        _condition.notify_all();
+
+        // The workers drain the remaining tasks before they exit
+        for(auto& worker : _workers) {
+            if(worker.joinable()) {
+                worker.join();
+            }
+        }
+    }
+
+    auto ThreadPool::run_worker() noexcept -> void {
+        while(true) {
+            std::function<void()> task {};
+            {
+                std::unique_lock<std::mutex> lock {_mutex};
+                _condition.wait(lock, [this]() { return _is_stopping || !_tasks.empty(); });
+                if(_tasks.empty()) {
+                    return;
+                }
+                task = std::move(_tasks.front());
+                _tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    auto ThreadPool::enqueue(std::function<void()> task) noexcept -> void {
+        {
+            const std::lock_guard<std::mutex> lock {_mutex};
+            _tasks.push_back(std::move(task));
+        }
+        _condition.notify_one();
+    }
+
+    auto ThreadPool::get_thread_count() const noexcept -> uint32_t {
+        return static_cast<uint32_t>(_workers.size());
+    }
+}// namespace aetherium
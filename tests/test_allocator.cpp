@@ -0,0 +1,96 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <aetherium/renderer/vulkan/allocator.hpp>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace aetherium::renderer::vulkan;
+
+TEST(aetherium_TlsfAllocator, test_allocate_and_free) {
+    TlsfAllocator allocator {1024};
+    const auto first = allocator.allocate(100);
+    const auto second = allocator.allocate(200);
+    first.throw_if_error();
+    second.throw_if_error();
+    ASSERT_EQ(allocator.get_allocation_count(), 2);
+    ASSERT_GE(second->offset, first->offset + 100);
+
+    allocator.free(first->block_index);
+    allocator.free(second->block_index);
+    ASSERT_TRUE(allocator.is_empty());
+    ASSERT_EQ(allocator.get_used_size(), 0);
+    ASSERT_EQ(allocator.get_largest_free_size(), 1024);
+}
+
+TEST(aetherium_TlsfAllocator, test_alignment) {
+    TlsfAllocator allocator {4096};
+    allocator.allocate(16).throw_if_error();
+    const auto aligned = allocator.allocate(64, 256);
+    aligned.throw_if_error();
+    ASSERT_EQ(aligned->offset % 256, 0);
+}
+
+TEST(aetherium_TlsfAllocator, test_out_of_memory) {
+    TlsfAllocator allocator {256};
+    allocator.allocate(256).throw_if_error();
+    ASSERT_TRUE(allocator.allocate(16).is_error());
+}
+
+TEST(aetherium_TlsfAllocator, test_random_allocations) {
+    constexpr uint64_t size = 1024 * 1024;
+    TlsfAllocator allocator {size};
+    std::mt19937 random {42};
+    std::vector<std::pair<TlsfAllocation, uint64_t>> allocations {};
+    for(uint32_t i = 0; i < 10000; i++) {
+        if(allocations.empty() || random() % 3 != 0) {
+            const uint64_t allocation_size = 1 + random() % 4096;
+            const uint64_t alignment = uint64_t(1) << (random() % 10);
+            if(const auto allocation = allocator.allocate(allocation_size, alignment); !allocation.is_error()) {
+                ASSERT_EQ(allocation->offset % alignment, 0);
+                allocations.emplace_back(*allocation, allocation_size);
+            }
+        }
+        else {
+            const auto index = random() % allocations.size();
+            allocator.free(allocations[index].first.block_index);
+            allocations.erase(allocations.begin() + static_cast<ptrdiff_t>(index));
+        }
+    }
+
+    // No allocated ranges overlap
+    std::sort(allocations.begin(), allocations.end(),
+              [](const auto& left, const auto& right) { return left.first.offset < right.first.offset; });
+    for(size_t i = 1; i < allocations.size(); i++) {
+        ASSERT_LE(allocations[i - 1].first.offset + allocations[i - 1].second, allocations[i].first.offset);
+    }
+
+    // All free neighbours are merged after freeing everything
+    for(const auto& [allocation, allocation_size] : allocations) {
+        allocator.free(allocation.block_index);
+    }
+    ASSERT_EQ(allocator.get_largest_free_size(), size);
+    ASSERT_EQ(allocator.get_fragmentation(), 0.0f);
+}
+
+TEST(aetherium_LinearAllocator, test_allocate_and_reset) {
+    LinearAllocator allocator {256};
+    ASSERT_EQ(*allocator.allocate(10), 0);
+    ASSERT_EQ(*allocator.allocate(10, 64), 64);
+    ASSERT_TRUE(allocator.allocate(256).is_error());
+    allocator.reset();
+    ASSERT_EQ(allocator.get_used_size(), 0);
+    ASSERT_EQ(*allocator.allocate(256), 0);
+}
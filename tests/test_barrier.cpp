@@ -0,0 +1,58 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <aetherium/renderer/vulkan/barrier.hpp>
+#include <gtest/gtest.h>
+
+using namespace aetherium::renderer::vulkan;
+
+TEST(aetherium_BarrierBatch, test_layout_usage) {
+    const auto undefined_usage = get_layout_usage(VK_IMAGE_LAYOUT_UNDEFINED);
+    ASSERT_EQ(undefined_usage.stage_mask, VK_PIPELINE_STAGE_2_NONE);
+    ASSERT_EQ(undefined_usage.access_mask, VK_ACCESS_2_NONE);
+
+    const auto color_usage = get_layout_usage(VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+    ASSERT_EQ(color_usage.stage_mask, VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT);
+    ASSERT_NE(color_usage.access_mask & VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT, 0);
+
+    const auto transfer_usage = get_layout_usage(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    ASSERT_EQ(transfer_usage.access_mask, VK_ACCESS_2_TRANSFER_WRITE_BIT);
+    ASSERT_EQ(get_aspect_mask(VK_FORMAT_D24_UNORM_S8_UINT), VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT);
+    ASSERT_EQ(get_aspect_mask(VK_FORMAT_R8G8B8A8_UNORM), VK_IMAGE_ASPECT_COLOR_BIT);
+}
+
+TEST(aetherium_BarrierBatch, test_merge_barriers) {
+    BarrierBatch barrier_batch {};
+    ASSERT_TRUE(barrier_batch.is_empty());
+
+    // Transitions of the same image and global barriers are merged, different buffer ranges are kept apart
+    auto* image = reinterpret_cast<VkImage>(0x1000);
+    auto* buffer = reinterpret_cast<VkBuffer>(0x2000);
+    barrier_batch.transition_image(image, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_UNDEFINED,
+                                   VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+    barrier_batch.transition_image(image, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_UNDEFINED,
+                                   VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+    barrier_batch.buffer_barrier(buffer, 0, 64, VK_PIPELINE_STAGE_2_COPY_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT,
+                                 VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT, VK_ACCESS_2_VERTEX_ATTRIBUTE_READ_BIT);
+    barrier_batch.buffer_barrier(buffer, 64, 64, VK_PIPELINE_STAGE_2_COPY_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT,
+                                 VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT, VK_ACCESS_2_VERTEX_ATTRIBUTE_READ_BIT);
+    barrier_batch.memory_barrier(VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT,
+                                 VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT, VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT);
+    barrier_batch.memory_barrier(VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT,
+                                 VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, VK_ACCESS_2_SHADER_STORAGE_READ_BIT);
+    ASSERT_EQ(barrier_batch.get_barrier_count(), 4);
+
+    barrier_batch.clear();
+    ASSERT_TRUE(barrier_batch.is_empty());
+}
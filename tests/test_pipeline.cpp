@@ -0,0 +1,76 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <aetherium/renderer/vulkan/pipeline.hpp>
+#include <gtest/gtest.h>
+
+using namespace aetherium::renderer::vulkan;
+
+namespace {
+    auto create_builder(VkShaderModule module, uint64_t module_id) -> GraphicsPipelineBuilder {
+        GraphicsPipelineBuilder builder {};
+        builder.with_shader_stage(VK_SHADER_STAGE_VERTEX_BIT, module, module_id)
+                .with_vertex_binding(0, 32)
+                .with_vertex_attribute(0, 0, VK_FORMAT_R32G32B32_SFLOAT, 0)
+                .with_color_attachment(VK_FORMAT_B8G8R8A8_UNORM)
+                .with_layout(reinterpret_cast<VkPipelineLayout>(0x2000));
+        return builder;
+    }
+}// namespace
+
+TEST(aetherium_GraphicsPipelineState, test_equal_states) {
+    auto* module = reinterpret_cast<VkShaderModule>(0x1000);
+    const auto builder = create_builder(module, 1);
+    const auto other_builder = create_builder(module, 1);
+    ASSERT_TRUE(builder.get_state() == other_builder.get_state());
+    ASSERT_EQ(builder.get_state().get_hash(), other_builder.get_state().get_hash());
+}
+
+TEST(aetherium_GraphicsPipelineState, test_module_id) {
+    // A reloaded shader can get the handle of the destroyed module, only the module id tells both modules apart
+    auto* module = reinterpret_cast<VkShaderModule>(0x1000);
+    const auto builder = create_builder(module, 1);
+    const auto reloaded_builder = create_builder(module, 2);
+    ASSERT_FALSE(builder.get_state() == reloaded_builder.get_state());
+    ASSERT_NE(builder.get_state().get_hash(), reloaded_builder.get_state().get_hash());
+}
+
+TEST(aetherium_GraphicsPipelineState, test_different_states) {
+    auto* module = reinterpret_cast<VkShaderModule>(0x1000);
+    const auto builder = create_builder(module, 1);
+
+    auto attribute_builder = create_builder(module, 1);
+    attribute_builder.with_vertex_attribute(1, 0, VK_FORMAT_R32G32_SFLOAT, 12);
+    ASSERT_FALSE(builder.get_state() == attribute_builder.get_state());
+    ASSERT_NE(builder.get_state().get_hash(), attribute_builder.get_state().get_hash());
+
+    auto color_builder = create_builder(module, 1);
+    color_builder.with_color_attachment(VK_FORMAT_R16G16B16A16_SFLOAT);
+    ASSERT_FALSE(builder.get_state() == color_builder.get_state());
+    ASSERT_NE(builder.get_state().get_hash(), color_builder.get_state().get_hash());
+
+    auto depth_builder = create_builder(module, 1);
+    depth_builder.with_depth_test(true);
+    ASSERT_FALSE(builder.get_state() == depth_builder.get_state());
+    ASSERT_NE(builder.get_state().get_hash(), depth_builder.get_state().get_hash());
+
+    auto entry_point_builder = GraphicsPipelineBuilder {};
+    entry_point_builder.with_shader_stage(VK_SHADER_STAGE_VERTEX_BIT, module, 1, "vertex_main")
+            .with_vertex_binding(0, 32)
+            .with_vertex_attribute(0, 0, VK_FORMAT_R32G32B32_SFLOAT, 0)
+            .with_color_attachment(VK_FORMAT_B8G8R8A8_UNORM)
+            .with_layout(reinterpret_cast<VkPipelineLayout>(0x2000));
+    ASSERT_FALSE(builder.get_state() == entry_point_builder.get_state());
+    ASSERT_NE(builder.get_state().get_hash(), entry_point_builder.get_state().get_hash());
+}
@@ -0,0 +1,126 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <aetherium/renderer/vulkan/reflection.hpp>
+#include <gtest/gtest.h>
+#include <shaderc/shaderc.hpp>
+#include <string>
+
+using namespace aetherium::renderer::vulkan;
+
+namespace {
+    constexpr auto VERTEX_SHADER = R"(#version 450
+layout(location = 0) in vec3 position;
+layout(location = 1) in vec2 uv;
+layout(set = 0, binding = 0) uniform Camera { mat4 view_projection; } camera;
+layout(set = 1, binding = 2) uniform sampler2D textures[4];
+layout(push_constant) uniform Constants { mat4 model; vec4 color; } constants;
+layout(location = 0) out vec4 color;
+void main() {
+    color = texture(textures[1], uv) * constants.color;
+    gl_Position = camera.view_projection * constants.model * vec4(position, 1.0);
+}
+)";
+
+    constexpr auto FRAGMENT_SHADER = R"(#version 450
+layout(location = 0) in vec4 color;
+layout(location = 0) out vec4 output_color;
+layout(set = 0, binding = 0) uniform Camera { mat4 view_projection; } camera;
+layout(std430, set = 0, binding = 1) buffer Lights { vec4 lights[]; };
+void main() {
+    output_color = color * lights[0] * camera.view_projection[0];
+}
+)";
+
+    constexpr auto SPECIALIZED_SHADER = R"(#version 450
+layout(constant_id = 0) const int TEXTURE_COUNT = 8;
+layout(location = 0) in vec2 uv;
+layout(location = 0) out vec4 output_color;
+layout(set = 0, binding = 0) uniform sampler2D textures[TEXTURE_COUNT];
+layout(push_constant) uniform Constants { layout(offset = 80) uint texture_index; } constants;
+void main() {
+    output_color = texture(textures[constants.texture_index], uv);
+}
+)";
+
+    auto compile(const std::string& source, shaderc_shader_kind kind) -> std::vector<uint32_t> {
+        const shaderc::Compiler compiler {};
+        const auto result = compiler.CompileGlslToSpv(source, kind, "test.glsl");
+        if(result.GetCompilationStatus() != shaderc_compilation_status_success) {
+            throw std::runtime_error {result.GetErrorMessage()};
+        }
+        return {result.cbegin(), result.cend()};
+    }
+}// namespace
+
+TEST(aetherium_Reflection, test_reflect_vertex_shader) {
+    const auto reflection = reflect_spirv(compile(VERTEX_SHADER, shaderc_vertex_shader));
+    reflection.throw_if_error();
+    ASSERT_EQ(reflection->stage, VK_SHADER_STAGE_VERTEX_BIT);
+
+    ASSERT_EQ(reflection->descriptor_bindings.size(), 2);
+    ASSERT_EQ(reflection->descriptor_bindings[0].set, 0);
+    ASSERT_EQ(reflection->descriptor_bindings[0].descriptor_type, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+    ASSERT_EQ(reflection->descriptor_bindings[1].set, 1);
+    ASSERT_EQ(reflection->descriptor_bindings[1].binding, 2);
+    ASSERT_EQ(reflection->descriptor_bindings[1].descriptor_type, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
+    ASSERT_EQ(reflection->descriptor_bindings[1].descriptor_count, 4);
+
+    ASSERT_EQ(reflection->push_constant_ranges.size(), 1);
+    ASSERT_EQ(reflection->push_constant_ranges[0].offset, 0);
+    ASSERT_EQ(reflection->push_constant_ranges[0].size, 80);
+
+    ASSERT_EQ(reflection->vertex_inputs.size(), 2);
+    ASSERT_EQ(reflection->vertex_inputs[0].format, VK_FORMAT_R32G32B32_SFLOAT);
+    ASSERT_EQ(reflection->vertex_inputs[1].format, VK_FORMAT_R32G32_SFLOAT);
+}
+
+TEST(aetherium_Reflection, test_merge_reflections) {
+    const auto vertex_reflection = reflect_spirv(compile(VERTEX_SHADER, shaderc_vertex_shader));
+    const auto fragment_reflection = reflect_spirv(compile(FRAGMENT_SHADER, shaderc_fragment_shader));
+    const auto reflection = merge_reflections({&*vertex_reflection, &*fragment_reflection});
+    reflection.throw_if_error();
+
+    ASSERT_EQ(reflection->descriptor_bindings.size(), 3);
+    ASSERT_EQ(reflection->descriptor_bindings[0].stage_flags,
+              VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT);
+    ASSERT_EQ(reflection->descriptor_bindings[1].descriptor_type, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    ASSERT_EQ(reflection->descriptor_bindings[1].stage_flags, VK_SHADER_STAGE_FRAGMENT_BIT);
+    ASSERT_EQ(reflection->push_constant_ranges.size(), 1);
+    ASSERT_EQ(reflection->vertex_inputs.size(), 2);
+}
+
+TEST(aetherium_Reflection, test_specialization_constant_array) {
+    const auto reflection = reflect_spirv(compile(SPECIALIZED_SHADER, shaderc_fragment_shader));
+    reflection.throw_if_error();
+
+    // The array is sized by the default value of the specialization constant instead of being a runtime array
+    ASSERT_EQ(reflection->descriptor_bindings.size(), 1);
+    ASSERT_EQ(reflection->descriptor_bindings[0].descriptor_count, 8);
+}
+
+TEST(aetherium_Reflection, test_merge_push_constant_ranges) {
+    const auto vertex_reflection = reflect_spirv(compile(VERTEX_SHADER, shaderc_vertex_shader));
+    const auto fragment_reflection = reflect_spirv(compile(SPECIALIZED_SHADER, shaderc_fragment_shader));
+    const auto reflection = merge_reflections({&*vertex_reflection, &*fragment_reflection});
+    reflection.throw_if_error();
+
+    // Every stage keeps its own range instead of a single range, which is visible to both stages
+    ASSERT_EQ(reflection->push_constant_ranges.size(), 2);
+    ASSERT_EQ(reflection->push_constant_ranges[0].stageFlags, VK_SHADER_STAGE_VERTEX_BIT);
+    ASSERT_EQ(reflection->push_constant_ranges[0].size, 80);
+    ASSERT_EQ(reflection->push_constant_ranges[1].stageFlags, VK_SHADER_STAGE_FRAGMENT_BIT);
+    ASSERT_EQ(reflection->push_constant_ranges[1].offset, 80);
+}
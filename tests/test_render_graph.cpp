@@ -0,0 +1,88 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <aetherium/renderer/vulkan/render_graph.hpp>
+#include <gtest/gtest.h>
+
+using namespace aetherium::renderer::vulkan;
+
+namespace {
+    auto import_test_image(RenderGraph& render_graph, const VkImageLayout initial_layout) noexcept
+            -> RenderGraphResource {
+        return render_graph.import_image("image", {reinterpret_cast<VkImage>(0x1000), VK_NULL_HANDLE,
+                                                   VK_FORMAT_R8G8B8A8_UNORM, {64, 64}, initial_layout,
+                                                   VK_PIPELINE_STAGE_2_NONE, VK_IMAGE_LAYOUT_UNDEFINED});
+    }
+}// namespace
+
+TEST(aetherium_RenderGraph, test_write_read_barrier) {
+    RenderGraph render_graph {nullptr};
+    const auto image = import_test_image(render_graph, VK_IMAGE_LAYOUT_GENERAL);
+    render_graph.add_pass("write", COMPUTE_PASS).write(image, STORAGE_WRITE);
+    render_graph.add_pass("read", COMPUTE_PASS).read(image, STORAGE_READ).set_side_effects();
+    render_graph.add_pass("read_again", COMPUTE_PASS).read(image, STORAGE_READ).set_side_effects();
+    ASSERT_FALSE(render_graph.compile().is_error());
+
+    // The read waits for the write in the same layout, the second read is already covered by the first barrier
+    ASSERT_TRUE(render_graph.get_pass_barriers(0).is_empty());
+    const auto& barriers = render_graph.get_pass_barriers(1).get_image_barriers();
+    ASSERT_EQ(barriers.size(), 1);
+    ASSERT_EQ(barriers[0].oldLayout, VK_IMAGE_LAYOUT_GENERAL);
+    ASSERT_EQ(barriers[0].newLayout, VK_IMAGE_LAYOUT_GENERAL);
+    ASSERT_EQ(barriers[0].srcStageMask, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT);
+    ASSERT_EQ(barriers[0].srcAccessMask, VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT);
+    ASSERT_EQ(barriers[0].dstAccessMask, VK_ACCESS_2_SHADER_STORAGE_READ_BIT);
+    ASSERT_TRUE(render_graph.get_pass_barriers(2).is_empty());
+}
+
+TEST(aetherium_RenderGraph, test_write_write_barrier) {
+    RenderGraph render_graph {nullptr};
+    const auto image = import_test_image(render_graph, VK_IMAGE_LAYOUT_GENERAL);
+    render_graph.add_pass("first", COMPUTE_PASS).write(image, STORAGE_WRITE);
+    render_graph.add_pass("second", COMPUTE_PASS).write(image, STORAGE_WRITE);
+    ASSERT_FALSE(render_graph.compile().is_error());
+
+    const auto& barriers = render_graph.get_pass_barriers(1).get_image_barriers();
+    ASSERT_EQ(barriers.size(), 1);
+    ASSERT_EQ(barriers[0].srcStageMask, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT);
+    ASSERT_EQ(barriers[0].srcAccessMask, VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT);
+    ASSERT_NE(barriers[0].dstAccessMask & VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT, 0);
+    ASSERT_EQ(render_graph.get_statistics().barrier_count, 1);
+}
+
+TEST(aetherium_RenderGraph, test_aliasing_barrier) {
+    RenderGraph render_graph {nullptr};
+    const auto output = import_test_image(render_graph, VK_IMAGE_LAYOUT_UNDEFINED);
+    const auto first = render_graph.create_image("first", {VK_FORMAT_R8G8B8A8_UNORM, {64, 64}});
+    const auto second = render_graph.create_image("second", {VK_FORMAT_R8G8B8A8_UNORM, {64, 64}});
+    render_graph.add_pass("first", GRAPHICS_PASS).write(first, COLOR_ATTACHMENT);
+    render_graph.add_pass("first_resolve", GRAPHICS_PASS).read(first, SHADER_READ).write(output, COLOR_ATTACHMENT);
+    render_graph.add_pass("second", GRAPHICS_PASS).write(second, COLOR_ATTACHMENT);
+    render_graph.add_pass("second_resolve", GRAPHICS_PASS).read(second, SHADER_READ).write(output, COLOR_ATTACHMENT);
+    ASSERT_FALSE(render_graph.compile().is_error());
+
+    // Both images don't overlap in their lifetime, so they share the memory
+    const auto& statistics = render_graph.get_statistics();
+    ASSERT_EQ(statistics.transient_image_count, 2);
+    ASSERT_EQ(statistics.aliased_memory_size, statistics.transient_memory_size);
+
+    // The first use of the second image waits for the last read of the first image
+    const auto& barriers = render_graph.get_pass_barriers(2).get_image_barriers();
+    ASSERT_EQ(barriers.size(), 1);
+    ASSERT_EQ(barriers[0].oldLayout, VK_IMAGE_LAYOUT_UNDEFINED);
+    ASSERT_EQ(barriers[0].newLayout, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+    ASSERT_NE(barriers[0].srcStageMask & VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT, 0);
+    ASSERT_EQ(barriers[0].dstStageMask, VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT);
+}
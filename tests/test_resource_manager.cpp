@@ -13,8 +13,10 @@
 // limitations under the License.
 
 #include <aetherium/resource.hpp>
+#include <chrono>
 #include <fstream>
 #include <gtest/gtest.h>
+#include <thread>
 #include <utility>
 
 using namespace aetherium;
@@ -36,11 +38,30 @@ class TestResource final : public Resource {
         return {};
     }
 
+    [[nodiscard]] auto supports_parallel_reload() const noexcept -> bool final {
+        return true;
+    }
+
     [[nodiscard]] auto get_text() const noexcept -> const std::string& {
         return _text;
     }
 };
 
+class DependentResource final : public Resource {
+    public:
+    uint32_t reload_count = 0;
+
+    explicit DependentResource(fs::path path, const kstd::reflect::RTTI* runtime_type) ://NOLINT
+            Resource {std::move(path), runtime_type} {
+    }
+
+    kstd::Result<void> reload(const ResourceManager& resource_manager) noexcept final {
+        _dependencies = {_resource_path.parent_path() / "shared.txt"};
+        reload_count++;
+        return {};
+    }
+};
+
 TEST(aetherium_ResourceManager, test_load_resource) {
     ResourceManager resource_manager {TESTS_DIRECTORY};
     auto resource = resource_manager.load_resource<TestResource>("test", "resource.txt");
@@ -53,6 +74,8 @@ TEST(aetherium_ResourceManager, test_get_resource) {
     resource_manager.load_resource<TestResource>("test", "resource.txt").throw_if_error();
     ASSERT_EQ(resource_manager.get_resource<TestResource>("test", "resource.txt")->get_text(),
               "This is a test text");
+    ASSERT_TRUE(resource_manager.get_resource<TestResource>("test", "missing.txt").is_empty());
+    ASSERT_TRUE(resource_manager.get_resource<TestResource>("other", "resource.txt").is_empty());
 }
 
 TEST(aetherium_ResourceManager, test_get_or_load_resource) {
@@ -61,9 +84,111 @@ TEST(aetherium_ResourceManager, test_get_or_load_resource) {
               "This is a test text");
 }
 
+TEST(aetherium_ResourceManager, test_resource_handles) {
+    ResourceManager resource_manager {TESTS_DIRECTORY};
+    ASSERT_TRUE(resource_manager.get_handle<TestResource>("test", "resource.txt").is_null());
+    resource_manager.load_resource<TestResource>("test", "resource.txt").throw_if_error();
+
+    const auto handle = resource_manager.get_handle<TestResource>("test", "resource.txt");
+    ASSERT_FALSE(handle.is_null());
+    ASSERT_EQ(resource_manager.get(handle)->get_text(), "This is a test text");
+
+    // Replacing the resource invalidates the old handle
+    resource_manager.load_resource<TestResource>("test", "resource.txt").throw_if_error();
+    const auto new_handle = resource_manager.get_handle<TestResource>("test", "resource.txt");
+    ASSERT_NE(handle, new_handle);
+    ASSERT_TRUE(resource_manager.get(handle).is_empty());
+    ASSERT_FALSE(resource_manager.get(new_handle).is_empty());
+
+    ASSERT_TRUE(resource_manager.unload<TestResource>("test", "resource.txt"));
+    ASSERT_TRUE(resource_manager.get(new_handle).is_empty());
+    ASSERT_TRUE(resource_manager.get_resource<TestResource>("test", "resource.txt").is_empty());
+}
+
+TEST(aetherium_ResourceManager, test_load_async) {
+    ResourceManager resource_manager {TESTS_DIRECTORY, 2};
+    auto load = resource_manager.load_async<TestResource>("test", "resource.txt", HIGH_PRIORITY);
+    auto missing_load = resource_manager.load_async<TestResource>("test", "missing.txt", LOW_PRIORITY);
+    auto cancelled_load = resource_manager.load_async<TestResource>("test", "resource.txt", LOW_PRIORITY);
+    cancelled_load.cancel();
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds {5};
+    while((!load.is_done() || !missing_load.is_done() || !cancelled_load.is_done()) &&
+          std::chrono::steady_clock::now() < deadline) {
+        resource_manager.finalize_loads();
+        std::this_thread::yield();
+    }
+    ASSERT_TRUE(load.is_done() && missing_load.is_done() && cancelled_load.is_done());
+
+    auto handle = load.get_result();
+    handle.throw_if_error();
+    ASSERT_EQ(resource_manager.get(*handle)->get_text(), "This is a test text");
+    ASSERT_EQ(missing_load.get_state(), FAILED);
+    ASSERT_EQ(cancelled_load.get_state(), CANCELLED);
+}
+
+TEST(aetherium_ResourceManager, test_reload_changed) {
+    const auto base_directory = (fs::temp_directory_path() / "aetherium_test_reload_changed").string();
+    const auto asset_directory = fs::path {base_directory}.append("assets").append("test");
+    fs::remove_all(base_directory);
+    fs::create_directories(asset_directory);
+    std::ofstream {asset_directory / "resource.txt"} << "resource";
+    std::ofstream {asset_directory / "shared.txt"} << "shared";
+
+    ResourceManager resource_manager {base_directory};
+    auto resource = resource_manager.load_resource<DependentResource>("test", "resource.txt");
+    resource.throw_if_error();
+    resource_manager.watch(std::chrono::milliseconds {0}).throw_if_error();
+    ASSERT_EQ(*resource_manager.reload_changed(), 0);
+
+    // Changing the dependency reloads the dependent resource
+    std::ofstream {asset_directory / "shared.txt"} << "changed";
+    uint32_t reloaded_count = 0;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds {5};
+    while(reloaded_count == 0 && std::chrono::steady_clock::now() < deadline) {
+        reloaded_count = *resource_manager.reload_changed();
+    }
+    ASSERT_EQ(reloaded_count, 1);
+    ASSERT_GE(resource->reload_count, 2);
+    fs::remove_all(base_directory);
+}
+
+TEST(aetherium_ResourceManager, test_reload_waves) {
+    const auto base_directory = (fs::temp_directory_path() / "aetherium_test_reload_waves").string();
+    const auto asset_directory = fs::path {base_directory}.append("assets").append("test");
+    fs::remove_all(base_directory);
+    fs::create_directories(asset_directory);
+    std::ofstream {asset_directory / "resource.txt"} << "resource";
+    std::ofstream {asset_directory / "shared.txt"} << "shared";
+
+    ResourceManager resource_manager {base_directory};
+    auto resource = resource_manager.load_resource<DependentResource>("test", "resource.txt");
+    resource.throw_if_error();
+    resource_manager.load_resource<TestResource>("test", "shared.txt").throw_if_error();
+
+    // The dependency is reloaded in the wave before the dependent resource
+    ASSERT_EQ(*resource_manager.reload(), 2);
+    ASSERT_EQ(resource_manager.get_reload_statistics().wave_count, 2);
+    ASSERT_EQ(resource->reload_count, 2);
+    fs::remove_all(base_directory);
+}
+
 TEST(aetherium_ResourceManager, test_reload_resources) {
     ResourceManager resource_manager {TESTS_DIRECTORY};
     resource_manager.load_resource<TestResource>("test", "resource.txt").throw_if_error();
     resource_manager.reload_by_type<TestResource>().throw_if_error();
     resource_manager.reload().throw_if_error();
+
+    const auto& statistics = resource_manager.get_reload_statistics();
+    ASSERT_EQ(statistics.resource_count, 1);
+    ASSERT_EQ(statistics.error_count, 0);
+    ASSERT_EQ(statistics.type_timings.size(), 1);
+    ASSERT_EQ(statistics.type_timings[0].resource_count, 1);
+}
+
+TEST(aetherium_ResourceManager, test_load_all_resources) {
+    ResourceManager resource_manager {TESTS_DIRECTORY, 2};
+    ASSERT_EQ(*resource_manager.load_all<TestResource>("test", {"resource.txt"}), 1);
+    ASSERT_EQ(resource_manager.get_resource<TestResource>("test", "resource.txt")->get_text(),
+              "This is a test text");
+    ASSERT_TRUE(resource_manager.load_all<TestResource>("test", {"resource.txt", "missing.txt"}).is_error());
 }
@@ -0,0 +1,43 @@
+// Copyright 2026 Cedric Hammes/Cach30verfl0w
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <aetherium/thread_pool.hpp>
+#include <atomic>
+#include <gtest/gtest.h>
+
+using namespace aetherium;
+
+TEST(aetherium_ThreadPool, test_submit) {
+    ThreadPool thread_pool {2};
+    auto future = thread_pool.submit([]() { return 42; });
+    ASSERT_EQ(future.get(), 42);
+}
+
+TEST(aetherium_ThreadPool, test_submit_many) {
+    ThreadPool thread_pool {4};
+    std::atomic<uint32_t> counter {0};
+    std::vector<std::future<void>> futures {};
+    for(uint32_t i = 0; i < 1000; i++) {
+        futures.push_back(thread_pool.submit([&counter]() { counter++; }));
+    }
+    for(auto& future : futures) {
+        future.get();
+    }
+    ASSERT_EQ(counter.load(), 1000);
+}
+
+TEST(aetherium_ThreadPool, test_default_thread_count) {
+    ThreadPool thread_pool {};
+    ASSERT_GE(thread_pool.get_thread_count(), 1);
+}